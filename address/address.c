@@ -79,6 +79,25 @@ const char AddressSpecials[] = "\"(),.:;<>@[\\]";
 /** #AddressSpecials except ( , . [ \ ] */
 #define ROUTE_SPECIAL_MASK 0x000000015c000204ULL
 
+/**
+ * token_append - Append a string to a token, if there's room
+ * @param[out] token    Buffer for the token
+ * @param[out] tokenlen Length of the token
+ * @param[in]  tokenmax Length of the buffer
+ * @param[in]  str      String to append
+ * @param[in]  len      Length of the string
+ */
+static void token_append(char *token, size_t *tokenlen, size_t tokenmax,
+                         const char *str, size_t len)
+{
+  if (*tokenlen >= tokenmax)
+    return;
+
+  len = MIN(len, tokenmax - *tokenlen);
+  memcpy(token + *tokenlen, str, len);
+  *tokenlen += len;
+}
+
 /**
  * parse_comment - Extract a comment (parenthesised string)
  * @param[in]  s          String, just after the opening parenthesis
@@ -175,15 +194,62 @@ static const char *next_token(const char *s, char *token, size_t *tokenlen, size
       token[(*tokenlen)++] = *s;
     return s + 1;
   }
-  while (*s)
+
+  const char *start = s;
+  while (*s && !mutt_str_is_email_wsp(*s) && !is_special(*s, ADDRESS_SPECIAL_MASK))
+    s++;
+
+  token_append(token, tokenlen, tokenmax, start, s - start);
+  return s;
+}
+
+/**
+ * PlainAddrChars - Classify characters for plain_addr_len()
+ *
+ * - 0: Part of a plain address
+ * - 1: End of a plain address, e.g. NUL, whitespace, #AddressSpecials
+ * - 2: `@` separates the mailbox from the domain
+ */
+static const unsigned char PlainAddrChars[256] = {
+  // clang-format off
+  ['\0'] = 1, ['\t'] = 1, ['\n'] = 1, ['\r'] = 1, [' ']  = 1,
+  ['"']  = 1, ['(']  = 1, [')']  = 1, [',']  = 1, [':']  = 1, [';'] = 1,
+  ['<']  = 1, ['>']  = 1, ['[']  = 1, ['\\'] = 1, [']']  = 1,
+  ['@']  = 2,
+  // clang-format on
+};
+
+/**
+ * plain_addr_len - Measure a plain email address
+ * @param s String to check
+ * @retval num Length of the address
+ * @retval 0   Not a plain address
+ *
+ * A plain address is made of atoms and dots, with at most one `@`, e.g.
+ * "john.doe@example.com".  It has no quotes, comments, escapes or whitespace,
+ * so it can be copied without being tokenised.
+ */
+static size_t plain_addr_len(const char *s)
+{
+  const char *p = s;
+  bool at = false;
+
+  while (true)
   {
-    if (mutt_str_is_email_wsp(*s) || is_special(*s, ADDRESS_SPECIAL_MASK))
+    const unsigned char type = PlainAddrChars[(unsigned char) *p];
+    if (type == 1)
       break;
-    if (*tokenlen < tokenmax)
-      token[(*tokenlen)++] = *s;
-    s++;
+
+    if (type == 2)
+    {
+      if (at)
+        return 0;
+      at = true;
+    }
+    p++;
   }
-  return s;
+
+  return p - s;
 }
 
 /**
@@ -261,19 +327,30 @@ static const char *parse_address(const char *s, char *token, size_t *tokenlen,
                                  size_t tokenmax, char *comment, size_t *commentlen,
                                  size_t commentmax, struct Address *addr)
 {
-  s = parse_mailboxdomain(s, USER_SPECIAL_MASK, token, tokenlen, tokenmax,
-                          comment, commentlen, commentmax);
-  if (!s)
-    return NULL;
-
-  if (*s == '@')
+  /* Fast path for the common case, e.g. "john@example.com>" */
+  const size_t len = plain_addr_len(s);
+  if ((len != 0) && ((s[len] == '\0') || (s[len] == '>') || (s[len] == ',') ||
+                     (s[len] == ';')))
   {
-    if (*tokenlen < tokenmax)
-      token[(*tokenlen)++] = '@';
-    s = parse_mailboxdomain(s + 1, DOMAIN_SPECIAL_MASK, token, tokenlen,
-                            tokenmax, comment, commentlen, commentmax);
+    token_append(token, tokenlen, tokenmax, s, len);
+    s += len;
+  }
+  else
+  {
+    s = parse_mailboxdomain(s, USER_SPECIAL_MASK, token, tokenlen, tokenmax,
+                            comment, commentlen, commentmax);
     if (!s)
       return NULL;
+
+    if (*s == '@')
+    {
+      if (*tokenlen < tokenmax)
+        token[(*tokenlen)++] = '@';
+      s = parse_mailboxdomain(s + 1, DOMAIN_SPECIAL_MASK, token, tokenlen,
+                              tokenmax, comment, commentlen, commentmax);
+      if (!s)
+        return NULL;
+    }
   }
 
   terminate_string(token, *tokenlen, tokenmax);
@@ -300,7 +377,7 @@ static const char *parse_address(const char *s, char *token, size_t *tokenlen,
 static const char *parse_route_addr(const char *s, char *comment, size_t *commentlen,
                                     size_t commentmax, struct Address *addr)
 {
-  char token[1024] = { 0 };
+  char token[1024]; // parse_address() terminates the string
   size_t tokenlen = 0;
 
   s = mutt_str_skip_email_wsp(s);
@@ -356,7 +433,7 @@ static const char *parse_route_addr(const char *s, char *comment, size_t *commen
 static const char *parse_addr_spec(const char *s, char *comment, size_t *commentlen,
                                    size_t commentmax, struct Address *addr)
 {
-  char token[1024] = { 0 };
+  char token[1024]; // parse_address() terminates the string
   size_t tokenlen = 0;
 
   s = parse_address(s, token, &tokenlen, sizeof(token) - 1, comment, commentlen,
@@ -483,8 +560,9 @@ int mutt_addrlist_parse(struct AddressList *al, const char *s)
     return 0;
 
   int parsed = 0;
-  char comment[1024] = { 0 };
-  char phrase[1024] = { 0 };
+  /* The strings are terminated before they're used */
+  char comment[1024];
+  char phrase[1024];
   size_t phraselen = 0, commentlen = 0;
 
   bool ws_pending = mutt_str_is_email_wsp(*s);
@@ -586,6 +664,24 @@ int mutt_addrlist_parse(struct AddressList *al, const char *s)
       }
 
       default:
+      {
+        /* Fast path for a bare address, e.g. "john@example.com," */
+        const size_t len = ((phraselen == 0) && (commentlen == 0)) ? plain_addr_len(s) : 0;
+        if ((len != 0) && (len < (sizeof(phrase) - 1)))
+        {
+          const char *end = mutt_str_skip_email_wsp(s + len);
+          if ((*end == '\0') || (*end == ',') || (*end == ';'))
+          {
+            struct Address *a = mutt_addr_new();
+            a->mailbox = buf_new(NULL);
+            buf_addstr_n(a->mailbox, s, len);
+            mutt_addrlist_append(al, a);
+            parsed++;
+            s += len;
+            break;
+          }
+        }
+
         if ((phraselen != 0) && (phraselen < (sizeof(phrase) - 1)) && ws_pending)
           phrase[phraselen++] = ' ';
         if (*s == '\\')
@@ -604,6 +700,7 @@ int mutt_addrlist_parse(struct AddressList *al, const char *s)
           return 0;
         }
         break;
+      }
     } // switch (*s)
 
     ws_pending = mutt_str_is_email_wsp(*s);
@@ -862,6 +959,29 @@ bool mutt_addrlist_equal(const struct AddressList *ala, const struct AddressList
   return !(ana || anb);
 }
 
+/**
+ * mutt_addrlist_mem_size - Calculate the memory used by an Address list
+ * @param al Address list
+ * @retval num Size in bytes
+ */
+size_t mutt_addrlist_mem_size(const struct AddressList *al)
+{
+  if (!al)
+    return 0;
+
+  size_t size = 0;
+  const struct Address *a = NULL;
+  TAILQ_FOREACH(a, al, entries)
+  {
+    size += sizeof(*a);
+    if (a->personal)
+      size += sizeof(struct Buffer) + a->personal->dsize;
+    if (a->mailbox)
+      size += sizeof(struct Buffer) + a->mailbox->dsize;
+  }
+  return size;
+}
+
 /**
  * mutt_addrlist_count_recips - Count the number of Addresses with valid recipients
  * @param al Address list
@@ -78,6 +78,7 @@ void   mutt_addrlist_copy        (struct AddressList *dst, const struct AddressL
 int    mutt_addrlist_count_recips(const struct AddressList *al);
 void   mutt_addrlist_dedupe      (struct AddressList *al);
 bool   mutt_addrlist_equal       (const struct AddressList *ala, const struct AddressList *alb);
+size_t mutt_addrlist_mem_size    (const struct AddressList *al);
 int    mutt_addrlist_parse       (struct AddressList *al, const char *s);
 int    mutt_addrlist_parse2      (struct AddressList *al, const char *s);
 void   mutt_addrlist_prepend     (struct AddressList *al, struct Address *a);
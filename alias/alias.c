@@ -516,6 +516,10 @@ retry_name:
   alias_reverse_add(alias);
   TAILQ_INSERT_TAIL(&Aliases, alias, entries);
 
+  mutt_debug(LL_NOTIFY, "NT_ALIAS_ADD: %s\n", alias->name);
+  struct EventAlias ev_a = { alias };
+  notify_send(NeoMutt->notify, NT_ALIAS, NT_ALIAS_ADD, &ev_a);
+
   const char *const c_alias_file = cs_subset_path(sub, "alias_file");
   buf_strcpy(buf, c_alias_file);
 
@@ -0,0 +1,62 @@
+/**
+ * @file
+ * Benchmarks for the address library
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "address/lib.h"
+#include "bench.h"
+
+/**
+ * bench_addrlist_parse - Benchmark mutt_addrlist_parse()
+ * @param b Benchmark state
+ *
+ * One operation is parsing, then freeing, one address header.
+ */
+void bench_addrlist_parse(struct Bench *b)
+{
+  struct Rng rng = { 0 };
+  rng_init(&rng, BENCH_SEED);
+
+  char *corpus[CORPUS_SIZE] = { 0 };
+  struct Buffer *buf = buf_pool_get();
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+  {
+    buf_reset(buf);
+    corpus_address(&rng, buf);
+    corpus[i] = buf_strdup(buf);
+  }
+  buf_pool_release(&buf);
+
+  struct AddressList al = TAILQ_HEAD_INITIALIZER(al);
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    mutt_addrlist_parse(&al, corpus[i % CORPUS_SIZE]);
+    mutt_addrlist_clear(&al);
+  }
+  bench_stop(b);
+
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+    FREE(&corpus[i]);
+}
@@ -0,0 +1,176 @@
+/**
+ * @file
+ * Benchmarks for base64 decoding
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include <stddef.h>
+#include <stdio.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "bench.h"
+#include "handler.h"
+
+/// Size of the decoded data
+#define B64_SIZE 4096
+
+/// Size of the decoded attachment
+#define ATTACH_SIZE (1024 * 1024)
+
+/**
+ * bench_b64_decode - Benchmark mutt_b64_decode()
+ * @param b Benchmark state
+ *
+ * One operation is decoding 4KiB of data.
+ */
+void bench_b64_decode(struct Bench *b)
+{
+  struct Rng rng = { 0 };
+  rng_init(&rng, BENCH_SEED);
+
+  char raw[B64_SIZE] = { 0 };
+  for (size_t i = 0; i < sizeof(raw); i++)
+    raw[i] = (char) rng_next(&rng);
+
+  char *enc = mutt_mem_malloc(B64_SIZE * 2);
+  mutt_b64_encode(raw, sizeof(raw), enc, B64_SIZE * 2);
+
+  char out[B64_SIZE + 8] = { 0 };
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    mutt_b64_decode(enc, out, sizeof(out));
+  }
+  bench_stop(b);
+
+  FREE(&enc);
+}
+
+/**
+ * attach_decode - Decode an attachment repeatedly
+ * @param b        Benchmark state
+ * @param fp       File containing the encoded attachment
+ * @param encoding Encoding, e.g. #ENC_BASE64
+ * @param type     Type, e.g. #TYPE_TEXT
+ */
+static void attach_decode(struct Bench *b, FILE *fp, enum ContentEncoding encoding,
+                          enum ContentType type)
+{
+  struct Body *body = mutt_body_new();
+  body->encoding = encoding;
+  body->type = type;
+  body->subtype = mutt_str_dup((type == TYPE_TEXT) ? "plain" : "octet-stream");
+  body->disposition = DISP_INLINE;
+  body->offset = 0;
+  body->length = ftell(fp);
+
+  struct State state = { 0 };
+  state.fp_in = fp;
+  state.fp_out = fopen("/dev/null", "w");
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    mutt_decode_attachment(body, &state);
+  }
+  bench_stop(b);
+
+  mutt_file_fclose(&state.fp_out);
+  mutt_body_free(&body);
+}
+
+/**
+ * bench_decode_base64 - Benchmark decoding a base64 attachment
+ * @param b Benchmark state
+ *
+ * One operation is decoding a 1MiB binary attachment, as saving it does.
+ */
+void bench_decode_base64(struct Bench *b)
+{
+  struct Rng rng = { 0 };
+  rng_init(&rng, BENCH_SEED);
+
+  char raw[57] = { 0 };
+  char enc[80] = { 0 };
+  FILE *fp = tmpfile();
+  if (!fp)
+    return;
+
+  // 57 bytes encode to a standard 76-character line
+  for (size_t i = 0; i < ATTACH_SIZE; i += sizeof(raw))
+  {
+    for (size_t j = 0; j < sizeof(raw); j++)
+      raw[j] = (char) rng_next(&rng);
+    mutt_b64_encode(raw, sizeof(raw), enc, sizeof(enc));
+    fprintf(fp, "%s\n", enc);
+  }
+
+  attach_decode(b, fp, ENC_BASE64, TYPE_APPLICATION);
+  mutt_file_fclose(&fp);
+}
+
+/**
+ * bench_decode_quoted - Benchmark decoding a quoted-printable attachment
+ * @param b Benchmark state
+ *
+ * One operation is decoding 1MiB of mostly-ASCII text, as displaying it does.
+ */
+void bench_decode_quoted(struct Bench *b)
+{
+  struct Rng rng = { 0 };
+  rng_init(&rng, BENCH_SEED);
+
+  FILE *fp = tmpfile();
+  if (!fp)
+    return;
+
+  struct Buffer *word = buf_pool_get();
+  size_t col = 0;
+  for (size_t i = 0; i < ATTACH_SIZE;)
+  {
+    corpus_word(&rng, word);
+    if ((col + buf_len(word) + 4) > 75)
+    {
+      // Soft line break
+      fputs("=\n", fp);
+      col = 0;
+    }
+    if (rng_range(&rng, 10) == 0)
+    {
+      // Non-ASCII: e-acute
+      fputs("=C3=A9", fp);
+      col += 6;
+      i += 2;
+    }
+    fprintf(fp, "%s ", buf_string(word));
+    col += buf_len(word) + 1;
+    i += buf_len(word) + 1;
+    if (rng_range(&rng, 12) == 0)
+    {
+      fputs("\n", fp);
+      col = 0;
+    }
+  }
+  buf_pool_release(&word);
+
+  attach_decode(b, fp, ENC_QUOTED_PRINTABLE, TYPE_TEXT);
+  mutt_file_fclose(&fp);
+}
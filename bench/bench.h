@@ -0,0 +1,146 @@
+/**
+ * @file
+ * Benchmark harness
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCH_BENCH_H
+#define BENCH_BENCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "core/lib.h"
+
+struct Buffer;
+struct Email;
+
+/**
+ * struct Bench - State of a running benchmark
+ *
+ * A benchmark function performs `n` operations.  The harness keeps calling it
+ * with larger `n` until the timed part takes long enough to measure.
+ * Any setup should be done before bench_start().
+ */
+struct Bench
+{
+  size_t n;         ///< Number of operations to perform
+  uint64_t start;   ///< Time the timer was started (ns)
+  uint64_t elapsed; ///< Time taken by the operations (ns)
+};
+
+void bench_start(struct Bench *b);
+void bench_stop (struct Bench *b);
+
+/**
+ * struct Rng - Reproducible random number generator
+ *
+ * The same seed will always generate the same corpus.
+ */
+struct Rng
+{
+  uint64_t state; ///< Generator state
+};
+
+/// Seed for all the corpora
+#define BENCH_SEED 0x4e656f4d757474ULL
+
+void        rng_init  (struct Rng *rng, uint64_t seed);
+uint64_t    rng_next  (struct Rng *rng);
+size_t      rng_range (struct Rng *rng, size_t max);
+
+FILE *        corpus_mbox_file(size_t num, long *offsets);
+struct Email *corpus_mbox_read(FILE *fp, long offset);
+
+void corpus_address   (struct Rng *rng, struct Buffer *buf);
+void corpus_date      (struct Rng *rng, struct Buffer *buf);
+void corpus_email     (struct Rng *rng, struct Buffer *buf, size_t num);
+void corpus_name      (struct Rng *rng, struct Buffer *buf);
+void corpus_subject   (struct Rng *rng, struct Buffer *buf);
+void corpus_word      (struct Rng *rng, struct Buffer *buf);
+
+/// Number of items in each corpus
+#define CORPUS_SIZE 1000
+
+/**
+ * enum CorpusMime - MIME structure of generated Emails
+ */
+enum CorpusMime
+{
+  CM_PLAIN,       ///< Single text/plain part
+  CM_ALTERNATIVE, ///< multipart/alternative, text and html
+  CM_MIXED,       ///< multipart/mixed, text and a base64 attachment
+};
+
+/**
+ * struct CorpusOptions - Shape of a generated Mailbox
+ */
+struct CorpusOptions
+{
+  size_t num_emails;    ///< Number of Emails
+  int max_depth;        ///< Deepest thread, 0 for no threads
+  enum CorpusMime mime; ///< MIME structure of the Emails
+  bool charsets;        ///< Use a mix of charsets and encodings
+};
+
+bool corpus_mailbox_write(const struct CorpusOptions *opts, enum MailboxType type, const char *path);
+
+/******************************************************************************
+ * Add your benchmarks to this list.
+ *****************************************************************************/
+#define NEOMUTT_BENCH_LIST                                                     \
+  NEOMUTT_BENCH_ITEM(bench_addrlist_parse)                                     \
+  NEOMUTT_BENCH_ITEM(bench_b64_decode)                                         \
+  NEOMUTT_BENCH_ITEM(bench_charset_convert)                                    \
+  NEOMUTT_BENCH_ITEM(bench_date_parse_date)                                    \
+  NEOMUTT_BENCH_ITEM(bench_decode_base64)                                      \
+  NEOMUTT_BENCH_ITEM(bench_decode_charset)                                     \
+  NEOMUTT_BENCH_ITEM(bench_decode_quoted)                                      \
+  NEOMUTT_BENCH_ITEM(bench_hash_find)                                          \
+  NEOMUTT_BENCH_ITEM(bench_hash_find_chained)                                  \
+  NEOMUTT_BENCH_ITEM(bench_hash_insert)                                        \
+  NEOMUTT_BENCH_ITEM(bench_hash_insert_chained)                                \
+  NEOMUTT_BENCH_ITEM(bench_index_color)                                        \
+  NEOMUTT_BENCH_ITEM(bench_index_color_flags)                                  \
+  NEOMUTT_BENCH_ITEM(bench_index_format)                                       \
+  NEOMUTT_BENCH_ITEM(bench_index_line_cache)                                   \
+  NEOMUTT_BENCH_ITEM(bench_pager_color)                                        \
+  NEOMUTT_BENCH_ITEM(bench_pager_layout)                                       \
+  NEOMUTT_BENCH_ITEM(bench_rfc2047_decode)                                     \
+  NEOMUTT_BENCH_ITEM(bench_rfc822_read_field)                                  \
+  NEOMUTT_BENCH_ITEM(bench_rfc822_read_header)                                 \
+  NEOMUTT_BENCH_ITEM(bench_rfc822_read_line)                                   \
+  NEOMUTT_BENCH_HCACHE_LIST                                                    \
+  NEOMUTT_BENCH_ITEM(bench_sort_date)                                          \
+  NEOMUTT_BENCH_ITEM(bench_sort_threads)
+
+#ifdef USE_HCACHE
+#define NEOMUTT_BENCH_HCACHE_LIST                                              \
+  NEOMUTT_BENCH_ITEM(bench_serial_dump_envelope)                               \
+  NEOMUTT_BENCH_ITEM(bench_serial_restore_envelope)
+#else
+#define NEOMUTT_BENCH_HCACHE_LIST
+#endif
+
+#define NEOMUTT_BENCH_ITEM(x) void x(struct Bench *b);
+NEOMUTT_BENCH_LIST
+#undef NEOMUTT_BENCH_ITEM
+
+#endif /* BENCH_BENCH_H */
@@ -0,0 +1,139 @@
+/**
+ * @file
+ * Benchmarks for character set conversion
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include <stddef.h>
+#include <stdio.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "bench.h"
+#include "handler.h"
+
+/// Size of the decoded attachment
+#define TEXT_SIZE (1024 * 1024)
+
+/**
+ * bench_charset_convert - Benchmark mutt_ch_convert_string()
+ * @param b Benchmark state
+ *
+ * One operation is converting one Subject to utf-8, as decoding a header does.
+ * The Subjects are a mix of us-ascii, utf-8 and iso-8859-1.
+ */
+void bench_charset_convert(struct Bench *b)
+{
+  static const char *const Charsets[] = { "us-ascii", "utf-8", "iso-8859-1" };
+
+  struct Rng rng = { 0 };
+  rng_init(&rng, BENCH_SEED);
+
+  char *corpus[CORPUS_SIZE] = { 0 };
+  struct Buffer *buf = buf_pool_get();
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+  {
+    buf_reset(buf);
+    corpus_word(&rng, buf);
+    if ((i % 3) == 1)
+      buf_addstr(buf, " caf\xc3\xa9");
+    else if ((i % 3) == 2)
+      buf_addstr(buf, " caf\xe9");
+    buf_addch(buf, ' ');
+    corpus_word(&rng, buf);
+    buf_addch(buf, ' ');
+    corpus_word(&rng, buf);
+    corpus[i] = buf_strdup(buf);
+  }
+  buf_pool_release(&buf);
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    const size_t j = i % CORPUS_SIZE;
+    char *str = mutt_str_dup(corpus[j]);
+    mutt_ch_convert_string(&str, Charsets[j % 3], "utf-8", MUTT_ICONV_HOOK_FROM);
+    FREE(&str);
+  }
+  bench_stop(b);
+
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+    FREE(&corpus[i]);
+}
+
+/**
+ * bench_decode_charset - Benchmark converting a text attachment
+ * @param b Benchmark state
+ *
+ * One operation is displaying 1MiB of 8bit utf-8 text, converting it to
+ * the user's $charset.
+ */
+void bench_decode_charset(struct Bench *b)
+{
+  struct Rng rng = { 0 };
+  rng_init(&rng, BENCH_SEED);
+
+  FILE *fp = tmpfile();
+  if (!fp)
+    return;
+
+  struct Buffer *word = buf_pool_get();
+  size_t col = 0;
+  for (size_t i = 0; i < TEXT_SIZE;)
+  {
+    buf_reset(word);
+    corpus_word(&rng, word);
+    if (rng_range(&rng, 10) == 0)
+      buf_addstr(word, "\xc3\xa9");
+    if ((col + buf_len(word)) > 72)
+    {
+      fputc('\n', fp);
+      col = 0;
+    }
+    fprintf(fp, "%s ", buf_string(word));
+    col += buf_len(word) + 1;
+    i += buf_len(word) + 1;
+  }
+  buf_pool_release(&word);
+
+  struct Body *body = mutt_body_new();
+  body->encoding = ENC_8BIT;
+  body->type = TYPE_TEXT;
+  body->subtype = mutt_str_dup("plain");
+  body->disposition = DISP_INLINE;
+  body->offset = 0;
+  body->length = ftell(fp);
+  mutt_param_set(&body->parameter, "charset", "utf-8");
+
+  struct State state = { 0 };
+  state.fp_in = fp;
+  state.fp_out = fopen("/dev/null", "w");
+  state.flags = STATE_CHARCONV;
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    mutt_decode_attachment(body, &state);
+  }
+  bench_stop(b);
+
+  mutt_file_fclose(&state.fp_out);
+  mutt_body_free(&body);
+  mutt_file_fclose(&fp);
+}
@@ -0,0 +1,327 @@
+/**
+ * @file
+ * Reproducible synthetic data for benchmarks
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "bench.h"
+
+// clang-format off
+/// Words for subjects and names
+static const char *const Words[] = {
+  "account", "agenda", "budget", "build", "change", "client", "config",
+  "deadline", "design", "draft", "error", "feature", "invoice", "meeting",
+  "minutes", "notes", "patch", "plan", "project", "query", "release",
+  "report", "review", "schedule", "server", "status", "summary", "update",
+};
+
+/// First names
+static const char *const FirstNames[] = {
+  "Alice", "Bob", "Carol", "Dave", "Erin", "Frank", "Grace", "Heidi",
+  "Ivan", "Judy", "Mallory", "Niaj", "Olivia", "Peggy", "Rupert", "Sybil",
+  "Trent", "Victor", "Walter", "Zoë",
+};
+
+/// Last names
+static const char *const LastNames[] = {
+  "Anderson", "Brown", "Clark", "Davis", "Evans", "García", "Harris",
+  "Jones", "King", "Lewis", "Martin", "Nguyen", "O'Brien", "Smith",
+  "Taylor", "Walker", "White", "Young",
+};
+
+/// Mail domains
+static const char *const Domains[] = {
+  "example.com", "example.org", "mail.example.net", "lists.example.com",
+  "corp.example.co.uk", "example.de",
+};
+
+/// Time zones
+static const char *const Zones[] = {
+  "+0000", "-0500", "+0100", "+0530", "-0800", "GMT", "EST", "+1000",
+};
+
+/// Month names
+static const char *const Months[] = {
+  "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+  "Jul", "Aug", "Sep", "Oct", "Nov", "Dec",
+};
+
+/// Day names
+static const char *const Days[] = {
+  "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat",
+};
+// clang-format on
+
+/// Pick a random element from an array
+#define RNG_PICK(rng, array) array[rng_range(rng, mutt_array_size(array))]
+
+/**
+ * rng_init - Seed a random number generator
+ * @param rng  Generator
+ * @param seed Seed
+ */
+void rng_init(struct Rng *rng, uint64_t seed)
+{
+  rng->state = seed ? seed : 1;
+}
+
+/**
+ * rng_next - Get the next random number
+ * @param rng Generator
+ * @retval num Random number
+ *
+ * This is xorshift64*, which is plenty for generating test data.
+ */
+uint64_t rng_next(struct Rng *rng)
+{
+  uint64_t x = rng->state;
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  rng->state = x;
+  return x * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * rng_range - Get a random number in a range
+ * @param rng Generator
+ * @param max Upper limit (exclusive)
+ * @retval num Random number in the range [0, max)
+ */
+size_t rng_range(struct Rng *rng, size_t max)
+{
+  return (size_t) (rng_next(rng) % max);
+}
+
+/**
+ * corpus_word - Append a random word
+ * @param rng Generator
+ * @param buf Buffer for the result
+ */
+void corpus_word(struct Rng *rng, struct Buffer *buf)
+{
+  buf_addstr(buf, RNG_PICK(rng, Words));
+}
+
+/**
+ * corpus_name - Append a random personal name
+ * @param rng Generator
+ * @param buf Buffer for the result
+ */
+void corpus_name(struct Rng *rng, struct Buffer *buf)
+{
+  buf_add_printf(buf, "%s %s", RNG_PICK(rng, FirstNames), RNG_PICK(rng, LastNames));
+}
+
+/**
+ * corpus_address - Append a random list of addresses
+ * @param rng Generator
+ * @param buf Buffer for the result
+ *
+ * The list has a mix of plain, named, quoted and commented addresses, and
+ * the occasional group.
+ */
+void corpus_address(struct Rng *rng, struct Buffer *buf)
+{
+  const size_t num = 1 + rng_range(rng, 4);
+  const bool group = (rng_range(rng, 10) == 0);
+
+  if (group)
+    buf_addstr(buf, "team: ");
+
+  for (size_t i = 0; i < num; i++)
+  {
+    if (i > 0)
+      buf_addstr(buf, ", ");
+
+    const char *first = RNG_PICK(rng, FirstNames);
+    const char *last = RNG_PICK(rng, LastNames);
+    const char *domain = RNG_PICK(rng, Domains);
+
+    switch (rng_range(rng, 4))
+    {
+      case 0:
+        buf_add_printf(buf, "%s.%s@%s", first, last, domain);
+        break;
+      case 1:
+        buf_add_printf(buf, "%s %s <%s.%s@%s>", first, last, first, last, domain);
+        break;
+      case 2:
+        buf_add_printf(buf, "\"%s, %s\" <%s@%s>", last, first, last, domain);
+        break;
+      default:
+        buf_add_printf(buf, "%s@%s (%s %s)", first, domain, first, last);
+        break;
+    }
+  }
+
+  if (group)
+    buf_addstr(buf, ";");
+}
+
+/**
+ * corpus_date - Append a random date, in RFC822 format
+ * @param rng Generator
+ * @param buf Buffer for the result
+ */
+void corpus_date(struct Rng *rng, struct Buffer *buf)
+{
+  if (rng_range(rng, 4) != 0)
+    buf_add_printf(buf, "%s, ", RNG_PICK(rng, Days));
+
+  buf_add_printf(buf, "%zu %s %zu %02zu:%02zu:%02zu %s", 1 + rng_range(rng, 28),
+                 RNG_PICK(rng, Months), 1995 + rng_range(rng, 30), rng_range(rng, 24),
+                 rng_range(rng, 60), rng_range(rng, 60), RNG_PICK(rng, Zones));
+}
+
+/**
+ * corpus_subject - Append a random subject
+ * @param rng Generator
+ * @param buf Buffer for the result
+ *
+ * About a third of the subjects are RFC2047-encoded.
+ */
+void corpus_subject(struct Rng *rng, struct Buffer *buf)
+{
+  struct Buffer *plain = buf_pool_get();
+  const size_t num = 2 + rng_range(rng, 6);
+  for (size_t i = 0; i < num; i++)
+  {
+    if (i > 0)
+      buf_addch(plain, ' ');
+    corpus_word(rng, plain);
+  }
+
+  switch (rng_range(rng, 6))
+  {
+    case 0:
+    {
+      char enc[1024] = { 0 };
+      mutt_b64_encode(buf_string(plain), buf_len(plain), enc, sizeof(enc));
+      buf_add_printf(buf, "=?UTF-8?B?%s?=", enc);
+      break;
+    }
+    case 1:
+    {
+      buf_addstr(buf, "=?ISO-8859-1?Q?");
+      for (const char *p = buf_string(plain); *p; p++)
+        buf_addch(buf, (*p == ' ') ? '_' : *p);
+      buf_addstr(buf, "=E9?= ");
+      corpus_word(rng, buf);
+      break;
+    }
+    default:
+      buf_addstr(buf, buf_string(plain));
+      break;
+  }
+
+  buf_pool_release(&plain);
+}
+
+/**
+ * corpus_email - Append the headers of a random email
+ * @param rng Generator
+ * @param buf Buffer for the result
+ * @param num Number of the email in the corpus
+ *
+ * Most emails are replies to an earlier email, so a corpus of emails makes
+ * realistic threads.  The headers are followed by a short body.
+ */
+void corpus_email(struct Rng *rng, struct Buffer *buf, size_t num)
+{
+  const bool reply = (num > 0) && (rng_range(rng, 3) != 0);
+  const size_t parent = reply ? rng_range(rng, num) : 0;
+
+  buf_addstr(buf, "From: ");
+  corpus_address(rng, buf);
+  buf_addstr(buf, "\nTo: ");
+  corpus_address(rng, buf);
+  if (rng_range(rng, 2) == 0)
+  {
+    buf_addstr(buf, "\nCc: ");
+    corpus_address(rng, buf);
+  }
+  buf_addstr(buf, "\nDate: ");
+  corpus_date(rng, buf);
+  buf_addstr(buf, reply ? "\nSubject: Re: " : "\nSubject: ");
+  corpus_subject(rng, buf);
+  buf_add_printf(buf, "\nMessage-ID: <%zu@bench.example.com>", num);
+  if (reply)
+  {
+    buf_add_printf(buf, "\nIn-Reply-To: <%zu@bench.example.com>", parent);
+    buf_add_printf(buf, "\nReferences: <%zu@bench.example.com>", parent);
+  }
+  buf_addstr(buf, "\nMIME-Version: 1.0"
+                  "\nContent-Type: text/plain; charset=utf-8"
+                  "\nContent-Transfer-Encoding: 8bit"
+                  "\nX-Mailer: bench\n\n");
+  buf_addstr(buf, "Hello,\n\nThis is the body.\n\n");
+}
+
+/**
+ * corpus_mbox_file - Create a file of random emails
+ * @param[in]  num     Number of emails
+ * @param[out] offsets Offset of each email in the file
+ * @retval ptr Temporary file, rewound
+ *
+ * The emails are always the same.
+ */
+FILE *corpus_mbox_file(size_t num, long *offsets)
+{
+  FILE *fp = tmpfile();
+  if (!fp)
+    return NULL;
+
+  struct Rng rng = { 0 };
+  rng_init(&rng, BENCH_SEED);
+  struct Buffer *buf = buf_pool_get();
+
+  for (size_t i = 0; i < num; i++)
+  {
+    buf_reset(buf);
+    corpus_email(&rng, buf, i);
+    offsets[i] = ftell(fp);
+    fwrite(buf_string(buf), 1, buf_len(buf), fp);
+  }
+
+  buf_pool_release(&buf);
+  rewind(fp);
+  return fp;
+}
+
+/**
+ * corpus_mbox_read - Parse an email from a corpus file
+ * @param fp     File from corpus_mbox_file()
+ * @param offset Offset of the email
+ * @retval ptr New Email
+ */
+struct Email *corpus_mbox_read(FILE *fp, long offset)
+{
+  struct Email *e = email_new();
+  e->offset = offset;
+  fseek(fp, offset, SEEK_SET);
+  e->env = mutt_rfc822_read_header(fp, e, false, false);
+  return e;
+}
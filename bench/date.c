@@ -0,0 +1,60 @@
+/**
+ * @file
+ * Benchmarks for date parsing
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "bench.h"
+
+/**
+ * bench_date_parse_date - Benchmark mutt_date_parse_date()
+ * @param b Benchmark state
+ *
+ * One operation is parsing one date.
+ */
+void bench_date_parse_date(struct Bench *b)
+{
+  struct Rng rng = { 0 };
+  rng_init(&rng, BENCH_SEED);
+
+  char *corpus[CORPUS_SIZE] = { 0 };
+  struct Buffer *buf = buf_pool_get();
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+  {
+    buf_reset(buf);
+    corpus_date(&rng, buf);
+    corpus[i] = buf_strdup(buf);
+  }
+  buf_pool_release(&buf);
+
+  struct Tz tz = { 0 };
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    mutt_date_parse_date(corpus[i % CORPUS_SIZE], &tz);
+  }
+  bench_stop(b);
+
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+    FREE(&corpus[i]);
+}
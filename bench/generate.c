@@ -0,0 +1,332 @@
+/**
+ * @file
+ * Generate mailboxes for benchmarks
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <time.h>
+#include "mutt/lib.h"
+#include "core/lib.h"
+#include "bench.h"
+
+/// Time of the first Email
+#define CORPUS_EPOCH 1700000000
+
+/// Longest References header to generate
+#define MAX_REFERENCES 20
+
+/**
+ * struct CorpusThreads - Thread structure of a corpus
+ */
+struct CorpusThreads
+{
+  size_t *parent; ///< Parent of each Email, or SIZE_MAX
+  int *depth;     ///< Depth of each Email in its thread
+};
+
+/**
+ * corpus_body - Append the body of an email
+ * @param rng  Generator
+ * @param opts Shape of the corpus
+ * @param buf  Buffer for the result
+ *
+ * The body is preceded by its MIME headers.
+ */
+static void corpus_body(struct Rng *rng, const struct CorpusOptions *opts, struct Buffer *buf)
+{
+  const char *charset = "utf-8";
+  const char *cte = "8bit";
+  const char *text = "Hello Zoë,\n\nThis is the body of the email.\n";
+  if (opts->charsets)
+  {
+    switch (rng_range(rng, 3))
+    {
+      case 0:
+        charset = "us-ascii";
+        cte = "7bit";
+        text = "Hello Zoe,\n\nThis is the body of the email.\n";
+        break;
+      case 1:
+        charset = "iso-8859-1";
+        cte = "quoted-printable";
+        text = "Hello Zo=EB,\n\nThis is the body of the =\nemail.\n";
+        break;
+      default:
+        break;
+    }
+  }
+
+  if (opts->mime == CM_PLAIN)
+  {
+    buf_add_printf(buf, "Content-Type: text/plain; charset=%s\n"
+                        "Content-Transfer-Encoding: %s\n\n%s",
+                   charset, cte, text);
+    for (size_t i = rng_range(rng, 20); i > 0; i--)
+    {
+      corpus_subject(rng, buf);
+      buf_addch(buf, '\n');
+    }
+    buf_addch(buf, '\n');
+    return;
+  }
+
+  const char *boundary = "=-=bench-boundary=-=";
+  buf_add_printf(buf, "Content-Type: multipart/%s; boundary=\"%s\"\n\n",
+                 (opts->mime == CM_MIXED) ? "mixed" : "alternative", boundary);
+  buf_addstr(buf, "This is a multi-part message in MIME format.\n");
+
+  buf_add_printf(buf, "--%s\nContent-Type: text/plain; charset=%s\n"
+                      "Content-Transfer-Encoding: %s\n\n%s\n",
+                 boundary, charset, cte, text);
+
+  if (opts->mime == CM_ALTERNATIVE)
+  {
+    buf_add_printf(buf, "--%s\nContent-Type: text/html; charset=utf-8\n\n"
+                        "<html><body><p>Hello Zoë,</p><p>This is the body of "
+                        "the email.</p></body></html>\n\n",
+                   boundary);
+  }
+  else
+  {
+    char raw[1536] = { 0 };
+    for (size_t i = 0; i < sizeof(raw); i++)
+      raw[i] = (char) rng_next(rng);
+
+    char enc[2100] = { 0 };
+    mutt_b64_encode(raw, sizeof(raw), enc, sizeof(enc));
+
+    buf_add_printf(buf, "--%s\nContent-Type: application/octet-stream\n"
+                        "Content-Disposition: attachment; filename=\"data.bin\"\n"
+                        "Content-Transfer-Encoding: base64\n\n",
+                   boundary);
+    for (size_t i = 0, len = mutt_str_len(enc); i < len; i += 76)
+      buf_add_printf(buf, "%.76s\n", enc + i);
+    buf_addch(buf, '\n');
+  }
+
+  buf_add_printf(buf, "--%s--\n\n", boundary);
+}
+
+/**
+ * corpus_message - Append a complete email
+ * @param rng     Generator
+ * @param opts    Shape of the corpus
+ * @param threads Thread structure
+ * @param num     Number of the email in the corpus
+ * @param buf     Buffer for the result
+ */
+static void corpus_message(struct Rng *rng, const struct CorpusOptions *opts,
+                           struct CorpusThreads *threads, size_t num, struct Buffer *buf)
+{
+  size_t parent = SIZE_MAX;
+  threads->depth[num] = 0;
+  if ((num > 0) && (opts->max_depth > 0) && (rng_range(rng, 3) != 0))
+  {
+    const size_t candidate = rng_range(rng, num);
+    if (threads->depth[candidate] < opts->max_depth)
+    {
+      parent = candidate;
+      threads->depth[num] = threads->depth[candidate] + 1;
+    }
+  }
+  threads->parent[num] = parent;
+
+  char date[64] = { 0 };
+  time_t t = CORPUS_EPOCH + (num * 60);
+  strftime(date, sizeof(date), "%a, %d %b %Y %H:%M:%S +0000", gmtime(&t));
+
+  buf_addstr(buf, "From: ");
+  corpus_address(rng, buf);
+  buf_addstr(buf, "\nTo: ");
+  corpus_address(rng, buf);
+  buf_add_printf(buf, "\nDate: %s", date);
+  buf_addstr(buf, (parent == SIZE_MAX) ? "\nSubject: " : "\nSubject: Re: ");
+  corpus_subject(rng, buf);
+  buf_add_printf(buf, "\nMessage-ID: <%zu@bench.example.com>", num);
+
+  if (parent != SIZE_MAX)
+  {
+    // Oldest ancestor first
+    size_t refs[MAX_REFERENCES] = { 0 };
+    int num_refs = 0;
+    for (size_t p = parent; (p != SIZE_MAX) && (num_refs < MAX_REFERENCES);
+         p = threads->parent[p])
+    {
+      refs[num_refs++] = p;
+    }
+
+    buf_add_printf(buf, "\nIn-Reply-To: <%zu@bench.example.com>\nReferences:", parent);
+    for (int i = num_refs - 1; i >= 0; i--)
+      buf_add_printf(buf, "\n <%zu@bench.example.com>", refs[i]);
+  }
+
+  buf_addstr(buf, "\nMIME-Version: 1.0\n");
+  corpus_body(rng, opts, buf);
+}
+
+/**
+ * write_file - Write a Buffer to a new file
+ * @param path Path of the file
+ * @param buf  Contents
+ * @retval true Success
+ */
+static bool write_file(const char *path, const struct Buffer *buf)
+{
+  FILE *fp = mutt_file_fopen(path, "w");
+  if (!fp)
+    return false;
+
+  fwrite(buf_string(buf), 1, buf_len(buf), fp);
+  return (mutt_file_fclose(&fp) == 0);
+}
+
+/**
+ * corpus_mailbox_write - Generate a Mailbox
+ * @param opts Shape of the corpus
+ * @param type Mailbox type, e.g. #MUTT_MAILDIR
+ * @param path Path for the Mailbox, which mustn't exist
+ * @retval true Success
+ *
+ * The same options always generate the same Emails.  A third of them are
+ * unread.
+ */
+bool corpus_mailbox_write(const struct CorpusOptions *opts, enum MailboxType type, const char *path)
+{
+  if (!opts || !path)
+    return false;
+
+  bool rc = false;
+  FILE *fp = NULL;
+  struct Buffer *buf = buf_pool_get();
+  struct Buffer *file = buf_pool_get();
+  struct Buffer *unseen = buf_pool_get();
+  struct CorpusThreads threads = { 0 };
+  threads.parent = mutt_mem_calloc(MAX(opts->num_emails, 1), sizeof(size_t));
+  threads.depth = mutt_mem_calloc(MAX(opts->num_emails, 1), sizeof(int));
+
+  struct Rng rng = { 0 };
+  rng_init(&rng, BENCH_SEED);
+
+  switch (type)
+  {
+    case MUTT_MBOX:
+    case MUTT_MMDF:
+      fp = mutt_file_fopen(path, "w");
+      if (!fp)
+        goto done;
+      break;
+
+    case MUTT_MAILDIR:
+      buf_printf(file, "%s/cur", path);
+      if (mutt_file_mkdir(buf_string(file), S_IRWXU) != 0)
+        goto done;
+      buf_printf(file, "%s/new", path);
+      if (mutt_file_mkdir(buf_string(file), S_IRWXU) != 0)
+        goto done;
+      buf_printf(file, "%s/tmp", path);
+      if (mutt_file_mkdir(buf_string(file), S_IRWXU) != 0)
+        goto done;
+      break;
+
+    case MUTT_MH:
+      if (mutt_file_mkdir(path, S_IRWXU) != 0)
+        goto done;
+      break;
+
+    default:
+      goto done;
+  }
+
+  for (size_t i = 0; i < opts->num_emails; i++)
+  {
+    const bool unread = (rng_range(&rng, 3) == 0);
+
+    buf_reset(buf);
+    corpus_message(&rng, opts, &threads, i, buf);
+
+    switch (type)
+    {
+      case MUTT_MBOX:
+      {
+        char date[64] = { 0 };
+        time_t t = CORPUS_EPOCH + (i * 60);
+        strftime(date, sizeof(date), "%a %b %e %H:%M:%S %Y", gmtime(&t));
+        fprintf(fp, "From bench@example.com %s\n", date);
+        if (!unread)
+          fputs("Status: RO\n", fp);
+        fwrite(buf_string(buf), 1, buf_len(buf), fp);
+        break;
+      }
+
+      case MUTT_MMDF:
+        fputs("\001\001\001\001\n", fp);
+        if (!unread)
+          fputs("Status: RO\n", fp);
+        fwrite(buf_string(buf), 1, buf_len(buf), fp);
+        fputs("\001\001\001\001\n", fp);
+        break;
+
+      case MUTT_MAILDIR:
+        if (unread)
+          buf_printf(file, "%s/new/%d.%zu.bench", path, CORPUS_EPOCH, i);
+        else
+          buf_printf(file, "%s/cur/%d.%zu.bench:2,S", path, CORPUS_EPOCH, i);
+        if (!write_file(buf_string(file), buf))
+          goto done;
+        break;
+
+      case MUTT_MH:
+        buf_printf(file, "%s/%zu", path, i + 1);
+        if (!write_file(buf_string(file), buf))
+          goto done;
+        if (unread)
+          buf_add_printf(unseen, " %zu", i + 1);
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  if (type == MUTT_MH)
+  {
+    buf_printf(file, "%s/.mh_sequences", path);
+    buf_printf(buf, "unseen:%s\n", buf_string(unseen));
+    if (!write_file(buf_string(file), buf))
+      goto done;
+  }
+
+  rc = true;
+
+done:
+  if (fp && (mutt_file_fclose(&fp) != 0))
+    rc = false;
+  FREE(&threads.parent);
+  FREE(&threads.depth);
+  buf_pool_release(&buf);
+  buf_pool_release(&file);
+  buf_pool_release(&unseen);
+  return rc;
+}
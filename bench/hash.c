@@ -0,0 +1,304 @@
+/**
+ * @file
+ * Benchmarks for the Hash Table
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include <stddef.h>
+#include <stdio.h>
+#include "mutt/lib.h"
+#include "bench.h"
+
+/// Number of keys in the tables
+#define HASH_KEYS 1000000
+
+/**
+ * struct ChainElem - An element of the old chained Hash Table
+ */
+struct ChainElem
+{
+  const char *key;        ///< Key
+  void *data;             ///< User-supplied data
+  struct ChainElem *next; ///< Next element in the (sorted) chain
+};
+
+/**
+ * struct ChainTable - The old chained Hash Table
+ *
+ * This is a copy of the Hash Table from before it could grow, for comparison.
+ * The bucket array is fixed, each chain is kept sorted and every lookup hashes
+ * the whole key and takes a `%`.
+ */
+struct ChainTable
+{
+  size_t num_elems;                                   ///< Number of buckets
+  struct ChainElem **table;                           ///< Array of chains
+  size_t (*gen_hash)(const char *key, size_t num);    ///< Hash function
+  int (*cmp_key)(const char *a, const char *b);       ///< Compare function
+};
+
+/**
+ * chain_gen_hash - Hash a string, as the old Hash Table did
+ * @param key Key
+ * @param num Number of buckets
+ * @retval num Bucket
+ */
+static size_t chain_gen_hash(const char *key, size_t num)
+{
+  size_t hash = 0;
+  const unsigned char *s = (const unsigned char *) key;
+
+  while (*s != '\0')
+    hash += ((hash << 7) + *s++);
+  hash = (hash * 149711) % num;
+
+  return hash;
+}
+
+/**
+ * chain_new - Create a chained Hash Table
+ * @param num Number of buckets
+ * @retval ptr New table
+ */
+static struct ChainTable *chain_new(size_t num)
+{
+  struct ChainTable *table = mutt_mem_calloc(1, sizeof(struct ChainTable));
+  table->num_elems = num;
+  table->table = mutt_mem_calloc(num, sizeof(struct ChainElem *));
+  table->gen_hash = chain_gen_hash;
+  table->cmp_key = mutt_str_cmp;
+  return table;
+}
+
+/**
+ * chain_insert - Add an element to a chained Hash Table
+ * @param table Table
+ * @param key   Key
+ * @param data  Data
+ * @retval ptr  New element
+ * @retval NULL The key is already present
+ */
+static struct ChainElem *chain_insert(struct ChainTable *table, const char *key, void *data)
+{
+  struct ChainElem *he = mutt_mem_calloc(1, sizeof(struct ChainElem));
+  size_t hash = table->gen_hash(key, table->num_elems);
+  he->key = key;
+  he->data = data;
+
+  struct ChainElem *tmp = NULL, *last = NULL;
+  for (tmp = table->table[hash]; tmp; last = tmp, tmp = tmp->next)
+  {
+    const int rc = table->cmp_key(tmp->key, key);
+    if (rc == 0)
+    {
+      FREE(&he);
+      return NULL;
+    }
+    if (rc > 0)
+      break;
+  }
+  if (last)
+    last->next = he;
+  else
+    table->table[hash] = he;
+  he->next = tmp;
+
+  return he;
+}
+
+/**
+ * chain_find - Find the data for a key in a chained Hash Table
+ * @param table Table
+ * @param key   Key
+ * @retval ptr  Data
+ * @retval NULL Key not found
+ */
+static void *chain_find(const struct ChainTable *table, const char *key)
+{
+  size_t hash = table->gen_hash(key, table->num_elems);
+  for (struct ChainElem *he = table->table[hash]; he; he = he->next)
+  {
+    if (table->cmp_key(key, he->key) == 0)
+      return he->data;
+  }
+  return NULL;
+}
+
+/**
+ * chain_free - Free a chained Hash Table
+ * @param ptr Table to free
+ */
+static void chain_free(struct ChainTable **ptr)
+{
+  struct ChainTable *table = *ptr;
+  for (size_t i = 0; i < table->num_elems; i++)
+  {
+    struct ChainElem *he = table->table[i];
+    while (he)
+    {
+      struct ChainElem *tmp = he;
+      he = he->next;
+      FREE(&tmp);
+    }
+  }
+  FREE(&table->table);
+  FREE(ptr);
+}
+
+/**
+ * make_keys - Create some Message-ID-like keys
+ * @param num Number of keys
+ * @retval ptr Array of keys
+ */
+static char **make_keys(size_t num)
+{
+  struct Rng rng = { 0 };
+  rng_init(&rng, BENCH_SEED);
+
+  char **keys = mutt_mem_calloc(num, sizeof(char *));
+  char buf[128] = { 0 };
+  for (size_t i = 0; i < num; i++)
+  {
+    snprintf(buf, sizeof(buf), "<%016llx.%zu@bench.example.com>",
+             (unsigned long long) rng_next(&rng), i);
+    keys[i] = mutt_str_dup(buf);
+  }
+
+  return keys;
+}
+
+/**
+ * free_keys - Free the keys
+ * @param keys Array of keys
+ * @param num  Number of keys
+ */
+static void free_keys(char **keys, size_t num)
+{
+  for (size_t i = 0; i < num; i++)
+    FREE(&keys[i]);
+  FREE(&keys);
+}
+
+/**
+ * bench_hash_insert - Benchmark mutt_hash_insert()
+ * @param b Benchmark state
+ *
+ * One operation is inserting one key into a growing table.  The table starts
+ * with 128 buckets and is recreated every 1,000,000 keys.
+ */
+void bench_hash_insert(struct Bench *b)
+{
+  char **keys = make_keys(HASH_KEYS);
+
+  bench_start(b);
+  struct HashTable *table = NULL;
+  for (size_t i = 0; i < b->n; i++)
+  {
+    if ((i % HASH_KEYS) == 0)
+    {
+      mutt_hash_free(&table);
+      table = mutt_hash_new(128, MUTT_HASH_NO_FLAGS);
+    }
+    mutt_hash_insert(table, keys[i % HASH_KEYS], keys[i % HASH_KEYS]);
+  }
+  mutt_hash_free(&table);
+  bench_stop(b);
+
+  free_keys(keys, HASH_KEYS);
+}
+
+/**
+ * bench_hash_insert_chained - Benchmark the old chained Hash Table's insert
+ * @param b Benchmark state
+ *
+ * One operation is inserting one key.  The old table couldn't grow, so it's
+ * created with 1,000,000 buckets and recreated every 1,000,000 keys.  Created
+ * with 1031 buckets, as small tables were, 1,000,000 keys take minutes.
+ */
+void bench_hash_insert_chained(struct Bench *b)
+{
+  char **keys = make_keys(HASH_KEYS);
+
+  bench_start(b);
+  struct ChainTable *table = NULL;
+  for (size_t i = 0; i < b->n; i++)
+  {
+    if ((i % HASH_KEYS) == 0)
+    {
+      if (table)
+        chain_free(&table);
+      table = chain_new(HASH_KEYS);
+    }
+    chain_insert(table, keys[i % HASH_KEYS], keys[i % HASH_KEYS]);
+  }
+  chain_free(&table);
+  bench_stop(b);
+
+  free_keys(keys, HASH_KEYS);
+}
+
+/**
+ * bench_hash_find - Benchmark mutt_hash_find()
+ * @param b Benchmark state
+ *
+ * One operation is looking up one key in a table of 1,000,000.
+ */
+void bench_hash_find(struct Bench *b)
+{
+  char **keys = make_keys(HASH_KEYS);
+  struct HashTable *table = mutt_hash_new(128, MUTT_HASH_NO_FLAGS);
+  for (size_t i = 0; i < HASH_KEYS; i++)
+    mutt_hash_insert(table, keys[i], keys[i]);
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    mutt_hash_find(table, keys[(i * 7919) % HASH_KEYS]);
+  }
+  bench_stop(b);
+
+  mutt_hash_free(&table);
+  free_keys(keys, HASH_KEYS);
+}
+
+/**
+ * bench_hash_find_chained - Benchmark the old chained Hash Table's lookup
+ * @param b Benchmark state
+ *
+ * One operation is looking up one key in a table of 1,000,000, with 1,000,000
+ * buckets.
+ */
+void bench_hash_find_chained(struct Bench *b)
+{
+  char **keys = make_keys(HASH_KEYS);
+  struct ChainTable *table = chain_new(HASH_KEYS);
+  for (size_t i = 0; i < HASH_KEYS; i++)
+    chain_insert(table, keys[i], keys[i]);
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    chain_find(table, keys[(i * 7919) % HASH_KEYS]);
+  }
+  bench_stop(b);
+
+  chain_free(&table);
+  free_keys(keys, HASH_KEYS);
+}
@@ -0,0 +1,251 @@
+/**
+ * @file
+ * Benchmarks for the Index
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "mutt/lib.h"
+#include "config/lib.h"
+#include "email/lib.h"
+#include "core/lib.h"
+#include "gui/lib.h"
+#include "bench.h"
+#include "color/lib.h"
+#include "index/lib.h"
+#include "index/line_cache.h"
+#include "pattern/lib.h"
+#include "format_flags.h"
+#include "hdrline.h"
+
+/// Number of Emails on the screen
+#define INDEX_ROWS 50
+
+/// Width of the screen
+#define INDEX_COLS 120
+
+/**
+ * emails_create - Create a screenful of Emails
+ * @param emails Array for the Emails
+ */
+static void emails_create(struct Email **emails)
+{
+  long offsets[INDEX_ROWS] = { 0 };
+  FILE *fp = corpus_mbox_file(INDEX_ROWS, offsets);
+
+  for (size_t i = 0; i < INDEX_ROWS; i++)
+  {
+    emails[i] = fp ? corpus_mbox_read(fp, offsets[i]) : email_new();
+    emails[i]->msgno = i;
+  }
+
+  mutt_file_fclose(&fp);
+}
+
+/**
+ * bench_index_format - Benchmark formatting a screenful of the Index
+ * @param b Benchmark state
+ *
+ * One operation is formatting #INDEX_ROWS Emails using the default
+ * `$index_format`, as a redraw of the Index does.
+ */
+void bench_index_format(struct Bench *b)
+{
+  struct Email *emails[INDEX_ROWS] = { 0 };
+  emails_create(emails);
+
+  const char *const c_index_format = cs_subset_string(NeoMutt->sub, "index_format");
+  const MuttFormatFlags flags = MUTT_FORMAT_ARROWCURSOR | MUTT_FORMAT_INDEX;
+  struct Buffer *buf = buf_pool_get();
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    for (size_t j = 0; j < INDEX_ROWS; j++)
+    {
+      mutt_make_string(buf, INDEX_COLS, NONULL(c_index_format), NULL, -1,
+                       emails[j], flags, NULL);
+    }
+  }
+  bench_stop(b);
+
+  buf_pool_release(&buf);
+  for (size_t i = 0; i < INDEX_ROWS; i++)
+    email_free(&emails[i]);
+}
+
+/**
+ * bench_index_line_cache - Benchmark redrawing a screenful of cached lines
+ * @param b Benchmark state
+ *
+ * One operation is fetching #INDEX_ROWS lines from the IndexLineCache, as a
+ * redraw of the Index does, after scrolling or moving the cursor.
+ */
+void bench_index_line_cache(struct Bench *b)
+{
+  struct Email *emails[INDEX_ROWS] = { 0 };
+  emails_create(emails);
+
+  const char *const c_index_format = cs_subset_string(NeoMutt->sub, "index_format");
+  const MuttFormatFlags flags = MUTT_FORMAT_ARROWCURSOR | MUTT_FORMAT_INDEX;
+  struct IndexLineCache *lc = index_line_cache_new();
+  struct Buffer *buf = buf_pool_get();
+
+  for (size_t j = 0; j < INDEX_ROWS; j++)
+  {
+    mutt_make_string(buf, INDEX_COLS, NONULL(c_index_format), NULL, -1,
+                     emails[j], flags, NULL);
+    index_line_cache_set(lc, emails[j], INDEX_COLS, flags, false, buf->data);
+  }
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    for (size_t j = 0; j < INDEX_ROWS; j++)
+    {
+      const char *line = index_line_cache_get(lc, emails[j], INDEX_COLS, flags, false);
+      buf_strcpy(buf, line);
+    }
+  }
+  bench_stop(b);
+
+  buf_pool_release(&buf);
+  index_line_cache_free(&lc);
+  for (size_t i = 0; i < INDEX_ROWS; i++)
+    email_free(&emails[i]);
+}
+
+/**
+ * index_colors_create - Create a typical set of `color index` rules
+ *
+ * Most rules match the sender or subject, some match the Email's flags.
+ */
+static void index_colors_create(void)
+{
+  // clang-format off
+  static const char *const Rules[] = {
+    "~f alice",       "~f bob",         "~f carol",       "~f dave",
+    "~f erin",        "~f frank",       "~f grace",       "~f heidi",
+    "~f ivan",        "~f judy",        "~f @example\\.com", "~f @example\\.org",
+    "~f noreply",     "~f billing",     "~f support",     "~f newsletter",
+    "~s meeting",     "~s invoice",     "~s urgent",      "~s release",
+    "~s 'build fail'", "~s review",     "~s '\\[PATCH'",  "~s minutes",
+    "~s agenda",      "~s deadline",    "~s report",      "~s update",
+    "~s '^Re:'",      "~s '^Fwd:'",     "~f boss ~s todo", "~f team | ~s team",
+    "~N",             "~O",             "~F",             "~D",
+    "~T",             "~Q",             "~N ~f boss",     "~F ~s urgent",
+  };
+  // clang-format on
+
+  regex_colors_init();
+  merged_colors_init();
+
+  struct Buffer *err = buf_pool_get();
+  struct AttrColor ac = { 0 };
+  ac.fg.color = COLOR_DEFAULT;
+  ac.bg.color = COLOR_DEFAULT;
+  for (size_t i = 0; i < mutt_array_size(Rules); i++)
+  {
+    int rc = 0;
+    ac.attrs = (i % 2) ? A_BOLD : A_UNDERLINE;
+    regex_colors_parse_color_list(MT_COLOR_INDEX, Rules[i], &ac, &rc, err);
+  }
+  buf_pool_release(&err);
+}
+
+/**
+ * index_colors_free - Free the `color index` rules
+ */
+static void index_colors_free(void)
+{
+  regex_colors_cleanup();
+  merged_colors_cleanup();
+}
+
+/**
+ * bench_index_color - Benchmark colouring a screenful of the Index
+ * @param b Benchmark state
+ *
+ * One operation is evaluating the `color index` rules for #INDEX_ROWS Emails,
+ * as a redraw of the Index does, after the colours change.
+ */
+void bench_index_color(struct Bench *b)
+{
+  struct Email *emails[INDEX_ROWS] = { 0 };
+  emails_create(emails);
+  index_colors_create();
+  struct Mailbox *m = mailbox_new();
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    for (size_t j = 0; j < INDEX_ROWS; j++)
+    {
+      emails[j]->attr_color = NULL;
+      emails[j]->color_valid = MUTT_PAT_DEP_NONE;
+      mutt_set_header_color(m, emails[j]);
+    }
+  }
+  bench_stop(b);
+
+  mailbox_free(&m);
+  index_colors_free();
+  for (size_t i = 0; i < INDEX_ROWS; i++)
+    email_free(&emails[i]);
+}
+
+/**
+ * bench_index_color_flags - Benchmark recolouring the Index after flag changes
+ * @param b Benchmark state
+ *
+ * One operation is changing a flag of #INDEX_ROWS Emails and evaluating their
+ * `color index` rules again, e.g. after `<tag-pattern>` or `<read-thread>`.
+ */
+void bench_index_color_flags(struct Bench *b)
+{
+  struct Email *emails[INDEX_ROWS] = { 0 };
+  emails_create(emails);
+  index_colors_create();
+  struct Mailbox *m = mailbox_new();
+
+  for (size_t j = 0; j < INDEX_ROWS; j++)
+    mutt_set_header_color(m, emails[j]);
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    for (size_t j = 0; j < INDEX_ROWS; j++)
+    {
+      struct Email *e = emails[j];
+      e->flagged = !e->flagged;
+      e->generation++;
+      mutt_reset_header_color(e, MUTT_PAT_DEP_FLAGS);
+      mutt_set_header_color(m, e);
+    }
+  }
+  bench_stop(b);
+
+  mailbox_free(&m);
+  index_colors_free();
+  for (size_t i = 0; i < INDEX_ROWS; i++)
+    email_free(&emails[i]);
+}
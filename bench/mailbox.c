@@ -0,0 +1,481 @@
+/**
+ * @file
+ * End-to-end Mailbox benchmark
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @page bench_mailbox End-to-end Mailbox benchmark
+ *
+ * Generate some mailboxes, then drive the real mx layer, without a GUI:
+ * open, sort, thread, limit, sync and close.
+ *
+ * Each Mailbox is opened twice for every header cache backend: once with an
+ * empty cache (cold) and once with a full cache (warm).  mbox and MMDF don't
+ * use the header cache, so they're only run without one.
+ *
+ * Every run happens in a child process, so the peak memory use that's reported
+ * belongs to that run alone.
+ *
+ * Build and run it with `make benchmark-mailbox`.
+ *
+ * Usage: `bench/neomutt-bench-mailbox [OPTIONS] [DIR]`
+ * - `-n NUM`      Number of Emails (default 10000)
+ * - `-d DEPTH`    Deepest thread (default 10)
+ * - `-m MIME`     MIME structure: plain, alternative, mixed (default alternative)
+ * - `-c`          Use a mix of charsets and encodings
+ * - `-f FORMATS`  Comma-separated mailbox types (default mbox,mmdf,maildir,mh)
+ * - `-k`          Keep the generated files
+ * - `DIR`         Where to create the files (default a new dir in /tmp)
+ */
+
+#include "config.h"
+#include <locale.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include "mutt/lib.h"
+#include "config/lib.h"
+#include "email/lib.h"
+#include "core/lib.h"
+#include "pattern/lib.h"
+#include "bench.h"
+#include "globals.h"
+#include "init.h"
+#include "mview.h"
+#include "mx.h"
+#include "protos.h"
+#include "sort.h"
+#ifdef USE_HCACHE
+#include "store/lib.h"
+#endif
+
+bool StartupComplete = false; ///< When the config has been read (defined in main.c)
+
+/// Patterns for the limit phase
+static const char *const LimitPatterns[] = {
+  "~U",
+  "~f alice",
+  "~s report",
+  "~C example.de",
+  "~x 5@bench.example.com",
+};
+
+/**
+ * struct MailboxTimes - Results of one run
+ */
+struct MailboxTimes
+{
+  uint64_t open;     ///< Time to open the Mailbox (ns)
+  uint64_t sort;     ///< Time to sort by date (ns)
+  uint64_t thread;   ///< Time to thread (ns)
+  uint64_t limit;    ///< Time to run all the limit patterns (ns)
+  uint64_t sync;     ///< Time to sync (ns)
+  uint64_t close;    ///< Time to close (ns)
+  size_t num_emails; ///< Number of Emails read
+  size_t allocs;     ///< Number of heap allocations while opening
+  size_t mem;        ///< Memory used by the open Mailbox (bytes)
+  long max_rss;      ///< Peak resident set size of the run (KiB)
+};
+
+/**
+ * log_disp_null - Discard log lines - Implements ::log_dispatcher_t - @ingroup logging_api
+ */
+static int log_disp_null(time_t stamp, const char *file, int line, const char *function,
+                         enum LogLevel level, const char *format, ...)
+{
+  return 0;
+}
+
+/**
+ * elapsed - Get the time since a start time
+ * @param start Time from stats_timer_start()
+ * @retval num Time (ns)
+ */
+static uint64_t elapsed(uint64_t start)
+{
+  return stats_timer_start() - start;
+}
+
+/**
+ * limit_run - Match some common patterns against every Email
+ * @param mv Mailbox View
+ */
+static void limit_run(struct MailboxView *mv)
+{
+  struct Mailbox *m = mv->mailbox;
+  struct Buffer *err = buf_pool_get();
+
+  for (size_t i = 0; i < mutt_array_size(LimitPatterns); i++)
+  {
+    struct PatternList *pat = mutt_pattern_comp(mv, NULL, LimitPatterns[i],
+                                                MUTT_PC_FULL_MSG, err);
+    if (!pat)
+      continue;
+
+    for (int j = 0; j < m->msg_count; j++)
+    {
+      mutt_pattern_exec(SLIST_FIRST(pat), MUTT_MATCH_FULL_ADDRESS, m, m->emails[j], NULL);
+    }
+    mutt_pattern_free(&pat);
+  }
+
+  buf_pool_release(&err);
+}
+
+/**
+ * mailbox_run - Open, sort, thread, limit, sync and close a Mailbox
+ * @param[in]  path Path to the Mailbox
+ * @param[out] mt   Results
+ * @retval true Success
+ */
+static bool mailbox_run(const char *path, struct MailboxTimes *mt)
+{
+  memset(mt, 0, sizeof(*mt));
+
+  struct MemoryStats ms = { 0 };
+  mutt_mem_stats(&ms);
+  const size_t allocs = ms.allocs;
+
+  uint64_t start = stats_timer_start();
+  struct Mailbox *m = mx_path_resolve(path);
+  if (!mx_mbox_open(m, MUTT_OPEN_NO_FLAGS))
+  {
+    m->visible = false;
+    mailbox_free(&m);
+    return false;
+  }
+  mt->open = elapsed(start);
+  mt->num_emails = m->msg_count;
+
+  mutt_mem_stats(&ms);
+  mt->allocs = ms.allocs - allocs;
+
+  struct MailboxMemory mm = { 0 };
+  mailbox_mem_usage(m, &mm);
+  mt->mem = mm.emails + mm.envelopes + mm.bodies + mm.hash_tables;
+
+  struct MailboxView *mv = mview_new(m, NeoMutt->notify);
+
+  cs_subset_str_string_set(NeoMutt->sub, "use_threads", "flat", NULL);
+  start = stats_timer_start();
+  mutt_sort_headers(mv, true);
+  mt->sort = elapsed(start);
+
+  cs_subset_str_string_set(NeoMutt->sub, "use_threads", "threads", NULL);
+  start = stats_timer_start();
+  mutt_sort_headers(mv, true);
+  mt->thread = elapsed(start);
+
+  start = stats_timer_start();
+  limit_run(mv);
+  mt->limit = elapsed(start);
+
+  // Toggle the flag of one Email in a hundred
+  for (int i = 0; i < m->msg_count; i += 100)
+  {
+    struct Email *e = m->emails[i];
+    mutt_set_flag(m, e, MUTT_FLAG, !e->flagged, true);
+  }
+
+  start = stats_timer_start();
+  mx_mbox_sync(m);
+  mt->sync = elapsed(start);
+
+  start = stats_timer_start();
+  mx_mbox_close(m);
+  mt->close = elapsed(start);
+
+  mview_free(&mv);
+  if (m->account)
+    account_mailbox_remove(m->account, m);
+  m->visible = false;
+  mailbox_free(&m);
+  return true;
+}
+
+/**
+ * mailbox_fork - Benchmark a Mailbox in a child process
+ * @param[in]  path Path to the Mailbox
+ * @param[out] mt   Results
+ * @retval true Success
+ *
+ * The peak RSS of a process never goes down, so each run gets its own process.
+ * The child sends its results back through a pipe.
+ */
+static bool mailbox_fork(const char *path, struct MailboxTimes *mt)
+{
+  memset(mt, 0, sizeof(*mt));
+
+  int fds[2] = { -1, -1 };
+  if (pipe(fds) != 0)
+  {
+    perror("pipe");
+    return false;
+  }
+
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid < 0)
+  {
+    perror("fork");
+    close(fds[0]);
+    close(fds[1]);
+    return false;
+  }
+
+  if (pid == 0)
+  {
+    close(fds[0]);
+    struct MailboxTimes result = { 0 };
+    bool ok = mailbox_run(path, &result);
+    if (ok)
+      ok = (write(fds[1], &result, sizeof(result)) == sizeof(result));
+    close(fds[1]);
+    _exit(ok ? 0 : 1);
+  }
+
+  close(fds[1]);
+  const ssize_t len = read(fds[0], mt, sizeof(*mt));
+  close(fds[0]);
+
+  int status = 0;
+  struct rusage ru = { 0 };
+  if (wait4(pid, &status, 0, &ru) < 0)
+  {
+    perror("wait4");
+    return false;
+  }
+
+  if ((len != sizeof(*mt)) || !WIFEXITED(status) || (WEXITSTATUS(status) != 0))
+    return false;
+
+  mt->max_rss = ru.ru_maxrss;
+  return true;
+}
+
+/**
+ * report - Print the results of one run
+ * @param format  Mailbox type
+ * @param backend Header cache backend
+ * @param cache   Cache state, "cold" or "warm"
+ * @param mt      Results
+ */
+static void report(const char *format, const char *backend, const char *cache,
+                   const struct MailboxTimes *mt)
+{
+  printf("%-8s %-12s %-5s %8zu %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10zu %10zu %10ld\n",
+         format, backend, cache, mt->num_emails, mt->open / 1e6, mt->sort / 1e6,
+         mt->thread / 1e6, mt->limit / 1e6, mt->sync / 1e6, mt->close / 1e6,
+         mt->allocs, mt->mem / 1024, mt->max_rss);
+  fflush(stdout);
+}
+
+/**
+ * format_run - Benchmark one Mailbox type
+ * @param opts Shape of the corpus
+ * @param dir  Directory for the files
+ * @param name Name of the Mailbox type, e.g. "maildir"
+ * @retval true Success
+ */
+static bool format_run(const struct CorpusOptions *opts, const char *dir, const char *name)
+{
+  enum MailboxType type = MUTT_UNKNOWN;
+  if (mutt_str_equal(name, "mbox"))
+    type = MUTT_MBOX;
+  else if (mutt_str_equal(name, "mmdf"))
+    type = MUTT_MMDF;
+  else if (mutt_str_equal(name, "maildir"))
+    type = MUTT_MAILDIR;
+  else if (mutt_str_equal(name, "mh"))
+    type = MUTT_MH;
+
+  if (type == MUTT_UNKNOWN)
+  {
+    fprintf(stderr, "Unknown mailbox type: %s\n", name);
+    return false;
+  }
+
+  struct Buffer *path = buf_pool_get();
+  buf_printf(path, "%s/%s", dir, name);
+
+  bool rc = false;
+  struct MailboxTimes mt = { 0 };
+
+  if (!corpus_mailbox_write(opts, type, buf_string(path)))
+  {
+    fprintf(stderr, "Can't create %s\n", buf_string(path));
+    goto done;
+  }
+
+  cs_subset_str_string_set(NeoMutt->sub, "header_cache", NULL, NULL);
+  for (int i = 0; i < 2; i++)
+  {
+    if (!mailbox_fork(buf_string(path), &mt))
+      goto done;
+    report(name, "none", (i == 0) ? "cold" : "warm", &mt);
+  }
+
+#ifdef USE_HCACHE
+  if ((type == MUTT_MAILDIR) || (type == MUTT_MH))
+  {
+    char *list = (char *) store_backend_list();
+    struct Buffer *cache = buf_pool_get();
+    char *save = NULL;
+    for (char *backend = strtok_r(list, ", ", &save); backend;
+         backend = strtok_r(NULL, ", ", &save))
+    {
+      buf_printf(cache, "%s/hcache-%s-%s/", dir, name, backend);
+      mutt_file_mkdir(buf_string(cache), S_IRWXU);
+      cs_subset_str_string_set(NeoMutt->sub, "header_cache_backend", backend, NULL);
+      cs_subset_str_string_set(NeoMutt->sub, "header_cache", buf_string(cache), NULL);
+
+      for (int i = 0; i < 2; i++)
+      {
+        if (!mailbox_fork(buf_string(path), &mt))
+          break;
+        report(name, backend, (i == 0) ? "cold" : "warm", &mt);
+      }
+    }
+    cs_subset_str_string_set(NeoMutt->sub, "header_cache", NULL, NULL);
+    buf_pool_release(&cache);
+    FREE(&list);
+  }
+#endif
+
+  rc = true;
+
+done:
+  buf_pool_release(&path);
+  return rc;
+}
+
+/**
+ * main - Run the Mailbox benchmark
+ * @param argc Number of arguments
+ * @param argv Arguments
+ * @retval 0 Success
+ * @retval 1 Error
+ */
+int main(int argc, char *argv[])
+{
+  struct CorpusOptions opts = { 10000, 10, CM_ALTERNATIVE, false };
+  const char *formats = "mbox,mmdf,maildir,mh";
+  bool keep = false;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "n:d:m:cf:k")) != -1)
+  {
+    switch (opt)
+    {
+      case 'n':
+        opts.num_emails = strtoul(optarg, NULL, 10);
+        break;
+      case 'd':
+        opts.max_depth = atoi(optarg);
+        break;
+      case 'm':
+        if (mutt_str_equal(optarg, "plain"))
+          opts.mime = CM_PLAIN;
+        else if (mutt_str_equal(optarg, "mixed"))
+          opts.mime = CM_MIXED;
+        else
+          opts.mime = CM_ALTERNATIVE;
+        break;
+      case 'c':
+        opts.charsets = true;
+        break;
+      case 'f':
+        formats = optarg;
+        break;
+      case 'k':
+        keep = true;
+        break;
+      default:
+        fprintf(stderr, "Usage: %s [-n NUM] [-d DEPTH] [-m plain|alternative|mixed] "
+                        "[-c] [-f FORMATS] [-k] [DIR]\n", argv[0]);
+        return 1;
+    }
+  }
+
+  char tmpdir[] = "/tmp/neomutt-bench-XXXXXX";
+  const char *dir = NULL;
+  if (optind < argc)
+  {
+    dir = argv[optind];
+    if (mutt_file_mkdir(dir, S_IRWXU) != 0)
+    {
+      fprintf(stderr, "Can't create %s\n", dir);
+      return 1;
+    }
+  }
+  else
+  {
+    dir = mkdtemp(tmpdir);
+    if (!dir)
+    {
+      perror("mkdtemp");
+      return 1;
+    }
+  }
+
+  if (!setlocale(LC_ALL, "C.UTF-8"))
+    setlocale(LC_ALL, "en_US.UTF-8");
+
+  MuttLogger = log_disp_null;
+  MuttLogLevel = LL_MESSAGE;
+  struct ConfigSet *cs = cs_new(500);
+  NeoMutt = neomutt_new(cs);
+  init_config(cs);
+  StartupComplete = true;
+  OptNoCurses = true;
+  cs_subset_str_string_set(NeoMutt->sub, "sort", "date", NULL);
+  cs_subset_str_string_set(NeoMutt->sub, "delete", "yes", NULL);
+  cs_subset_str_string_set(NeoMutt->sub, "move", "no", NULL);
+  cs_subset_str_string_set(NeoMutt->sub, "sleep_time", "0", NULL);
+
+  printf("%-8s %-12s %-5s %8s %10s %10s %10s %10s %10s %10s %10s %10s %10s\n",
+         "format", "hcache", "cache", "emails", "open ms", "sort ms", "thread ms",
+         "limit ms", "sync ms", "close ms", "allocs", "mem KiB", "maxrss KiB");
+
+  int rc = 0;
+  char *list = mutt_str_dup(formats);
+  char *save = NULL;
+  for (char *name = strtok_r(list, ",", &save); name; name = strtok_r(NULL, ",", &save))
+  {
+    if (!format_run(&opts, dir, name))
+      rc = 1;
+  }
+  FREE(&list);
+
+  if (!keep)
+    mutt_file_rmtree(dir);
+
+  neomutt_free(&NeoMutt);
+  cs_free(&cs);
+  return rc;
+}
@@ -0,0 +1,179 @@
+/**
+ * @file
+ * Benchmark harness
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @page bench_main Benchmark harness
+ *
+ * Microbenchmarks for the core libraries.
+ *
+ * Build and run them with `make benchmark`.  Each benchmark is run until it
+ * has taken at least 200ms, then the time per operation is reported.  All the
+ * input is generated from a fixed seed, so results can be compared across
+ * commits.
+ *
+ * Usage: `bench/neomutt-bench [-t MS] [NAME...]`
+ * - `-t MS`  Minimum time for each benchmark, in milliseconds
+ * - `NAME`   Only run benchmarks whose name contains NAME
+ */
+
+#include "config.h"
+#include <locale.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "mutt/lib.h"
+#include "config/lib.h"
+#include "core/lib.h"
+#include "bench.h"
+#include "globals.h"
+#include "init.h"
+
+bool StartupComplete = false; ///< When the config has been read (defined in main.c)
+
+/**
+ * struct Benchmark - A named benchmark
+ */
+struct Benchmark
+{
+  const char *name;                 ///< Name of the benchmark
+  void (*func)(struct Bench *b);    ///< Benchmark function
+};
+
+// clang-format off
+/// All the benchmarks
+static const struct Benchmark Benchmarks[] = {
+#define NEOMUTT_BENCH_ITEM(x) { #x, x },
+  NEOMUTT_BENCH_LIST
+#undef NEOMUTT_BENCH_ITEM
+  { NULL, NULL },
+};
+// clang-format on
+
+/**
+ * log_disp_null - Discard log lines - Implements ::log_dispatcher_t - @ingroup logging_api
+ */
+static int log_disp_null(time_t stamp, const char *file, int line, const char *function,
+                         enum LogLevel level, const char *format, ...)
+{
+  return 0;
+}
+
+/**
+ * bench_start - Start the benchmark timer
+ * @param b Benchmark state
+ */
+void bench_start(struct Bench *b)
+{
+  b->start = stats_timer_start();
+}
+
+/**
+ * bench_stop - Stop the benchmark timer
+ * @param b Benchmark state
+ */
+void bench_stop(struct Bench *b)
+{
+  b->elapsed += stats_timer_start() - b->start;
+}
+
+/**
+ * bench_run - Run a benchmark until it's taken long enough
+ * @param bm     Benchmark
+ * @param min_ns Minimum run time (ns)
+ */
+static void bench_run(const struct Benchmark *bm, uint64_t min_ns)
+{
+  struct Bench b = { 0 };
+  size_t n = 1;
+
+  while (true)
+  {
+    b.n = n;
+    b.elapsed = 0;
+    bm->func(&b);
+
+    if ((b.elapsed >= min_ns) || (n >= 1000000000))
+      break;
+
+    // Aim for 20% more than the minimum, but don't grow too quickly
+    uint64_t next = (min_ns * 6 / 5) * n / MAX(b.elapsed, 1);
+    n = CLAMP(next, n * 2, n * 100);
+  }
+
+  printf("%-32s %12zu %14.1f ns/op\n", bm->name, b.n, (double) b.elapsed / b.n);
+  fflush(stdout);
+}
+
+/**
+ * main - Run the benchmarks
+ * @param argc Number of arguments
+ * @param argv Arguments
+ * @retval 0 Success
+ * @retval 1 Error
+ */
+int main(int argc, char *argv[])
+{
+  uint64_t min_ns = 200 * 1000000ULL;
+
+  int i = 1;
+  if ((argc > 2) && mutt_str_equal(argv[1], "-t"))
+  {
+    min_ns = strtoull(argv[2], NULL, 10) * 1000000ULL;
+    i = 3;
+  }
+
+  if (!setlocale(LC_ALL, "C.UTF-8"))
+    setlocale(LC_ALL, "en_US.UTF-8");
+
+  MuttLogger = log_disp_null;
+  MuttLogLevel = LL_MESSAGE;
+  struct ConfigSet *cs = cs_new(500);
+  NeoMutt = neomutt_new(cs);
+  init_config(cs);
+
+  // Match the locale, like NeoMutt's startup
+  const char *charset = mutt_ch_get_langinfo_charset();
+  cs_str_initial_set(cs, "charset", charset, NULL);
+  cs_str_reset(cs, "charset", NULL);
+  mutt_ch_set_charset(charset);
+  FREE(&charset);
+
+  StartupComplete = true;
+  OptNoCurses = true;
+
+  for (const struct Benchmark *bm = Benchmarks; bm->name; bm++)
+  {
+    bool wanted = (i >= argc);
+    for (int j = i; !wanted && (j < argc); j++)
+      wanted = strstr(bm->name, argv[j]);
+
+    if (wanted)
+      bench_run(bm, min_ns);
+  }
+
+  neomutt_free(&NeoMutt);
+  cs_free(&cs);
+  return 0;
+}
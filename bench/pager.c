@@ -0,0 +1,215 @@
+/**
+ * @file
+ * Benchmarks for the Pager
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include <stddef.h>
+#include <stdio.h>
+#include "mutt/lib.h"
+#include "gui/lib.h"
+#include "bench.h"
+#include "color/lib.h"
+#include "pager/lib.h"
+#include "pager/display.h"
+#include "pager/private_data.h"
+
+/// Number of lines in the message
+#define PAGER_LINES 20000
+
+/**
+ * pager_file - Create a large message to page through
+ * @retval ptr Temporary file
+ *
+ * The message has headers, quoted text at several levels, some non-ASCII text
+ * and some very long lines, such as might be found in a log file.
+ */
+static FILE *pager_file(void)
+{
+  FILE *fp = tmpfile();
+  if (!fp)
+    return NULL;
+
+  struct Rng rng = { 0 };
+  rng_init(&rng, BENCH_SEED);
+  struct Buffer *buf = buf_pool_get();
+
+  for (int i = 0; i < 10; i++)
+  {
+    corpus_name(&rng, buf);
+    fprintf(fp, "X-Header-%d: %s\n", i, buf_string(buf));
+  }
+  fputc('\n', fp);
+
+  for (int i = 0; i < PAGER_LINES; i++)
+  {
+    buf_reset(buf);
+    const int quote = rng_range(&rng, 4);
+    for (int q = 0; q < quote; q++)
+      buf_addstr(buf, "> ");
+
+    // One line in fifty is very long
+    const int words = (rng_range(&rng, 50) == 0) ? 500 : rng_range(&rng, 12);
+    for (int w = 0; w < words; w++)
+    {
+      corpus_word(&rng, buf);
+      buf_addch(buf, ' ');
+    }
+    // Some non-ASCII text and some nroff-style bold text
+    if ((i % 10) == 0)
+      buf_addstr(buf, "na\xc3\xafve caf\xc3\xa9 \xe2\x80\x93 r\xc3\xa9sum\xc3\xa9 ");
+    if ((i % 100) == 0)
+      buf_addstr(buf, "b\bbo\bol\bld\bd ");
+
+    fprintf(fp, "%s\n", buf_string(buf));
+  }
+
+  buf_pool_release(&buf);
+  rewind(fp);
+  return fp;
+}
+
+/**
+ * pager_layout - Lay out a message in the Pager, repeatedly
+ * @param b Benchmark state
+ *
+ * One operation is laying out the whole message, as `<bottom>` does.
+ */
+static void pager_layout(struct Bench *b)
+{
+  FILE *fp = pager_file();
+  if (!fp)
+    return;
+
+  if (LINES == 0)
+    LINES = 50;
+
+  struct PagerData pdata = { 0 };
+  struct PagerView pview = { &pdata };
+  pview.mode = PAGER_MODE_EMAIL;
+
+  struct PagerPrivateData *priv = pager_private_data_new();
+  priv->pview = &pview;
+  priv->fp = fp;
+
+  struct MuttWindow *panel = mutt_window_new(WT_PAGER, MUTT_WIN_ORIENT_VERTICAL,
+                                             MUTT_WIN_SIZE_FIXED, 80, 50);
+  panel->wdata = priv;
+  struct MuttWindow *win = mutt_window_new(WT_CUSTOM, MUTT_WIN_ORIENT_VERTICAL,
+                                           MUTT_WIN_SIZE_FIXED, 80, 50);
+  mutt_window_add_child(panel, win);
+  win->state.cols = 80;
+  win->state.rows = 50;
+  pview.win_pager = win;
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    priv->lines_used = 0;
+    priv->lines_max = LINES;
+    priv->lines = mutt_mem_calloc(priv->lines_max, sizeof(struct Line));
+    for (int j = 0; j < priv->lines_max; j++)
+    {
+      priv->lines[j].cid = -1;
+      priv->lines[j].search_arr_size = -1;
+      priv->lines[j].syntax = mutt_mem_calloc(1, sizeof(struct TextSyntax));
+      (priv->lines[j].syntax)[0].first = -1;
+      (priv->lines[j].syntax)[0].last = -1;
+    }
+    priv->bytes_read = 0;
+    rewind(fp);
+
+    int line_num = 0;
+    while (display_line(priv->fp, &priv->bytes_read, &priv->lines, line_num,
+                        &priv->lines_used, &priv->lines_max, MUTT_TYPES,
+                        &priv->quote_list, &priv->q_level, &priv->force_redraw,
+                        &priv->search_re, win, &priv->ansi_list) == 0)
+    {
+      line_num++;
+    }
+
+    for (int j = 0; j < priv->lines_max; j++)
+      FREE(&priv->lines[j].syntax);
+    FREE(&priv->lines);
+    qstyle_free_tree(&priv->quote_list);
+  }
+  bench_stop(b);
+
+  priv->fp = NULL;
+  panel->wdata = NULL;
+  mutt_window_free(&panel);
+  pager_private_data_free(NULL, (void **) &priv);
+  mutt_file_fclose(&fp);
+}
+
+/**
+ * bench_pager_layout - Benchmark laying out a message in the Pager
+ * @param b Benchmark state
+ */
+void bench_pager_layout(struct Bench *b)
+{
+  pager_layout(b);
+}
+
+/**
+ * bench_pager_color - Benchmark laying out a message with many body colours
+ * @param b Benchmark state
+ *
+ * A typical set of `color body` rules: highlighted keywords, URLs, email
+ * addresses, smileys and markup.  Some of them never match.
+ */
+void bench_pager_color(struct Bench *b)
+{
+  // clang-format off
+  static const char *const Rules[] = {
+    "\\<account\\>",  "\\<agenda\\>",   "\\<budget\\>",  "\\<build\\>",
+    "\\<change\\>",   "\\<client\\>",   "\\<config\\>",  "\\<deadline\\>",
+    "\\<design\\>",   "\\<draft\\>",    "\\<error\\>",   "\\<feature\\>",
+    "\\<invoice\\>",  "\\<meeting\\>",  "\\<minutes\\>", "\\<notes\\>",
+    "\\<patch\\>",    "\\<plan\\>",     "\\<project\\>", "\\<query\\>",
+    "\\<release\\>",  "\\<report\\>",   "\\<review\\>",  "\\<schedule\\>",
+    "\\<server\\>",   "\\<status\\>",   "\\<summary\\>", "\\<update\\>",
+    "[a-z]+ing\\>",      "[a-z]+ed\\>",      "[0-9]+",           "caf\xc3\xa9",
+    "TODO",             "FIXME",            "XXX",              "(https?|ftp)://[^ ]+",
+    "[-a-z_0-9.+]+@[-a-z_0-9.]+", "[;:]-?[)(/|]", "\\*[^* ]+\\*", "_[^_ ]+_",
+    "^-- $",            "\\[[0-9]+\\]",     "<[^>@]+@[^>]+>",   "[A-Z]{2,}",
+  };
+  // clang-format on
+
+  regex_colors_init();
+  merged_colors_init();
+
+  struct Buffer *err = buf_pool_get();
+  struct AttrColor ac = { 0 };
+  ac.fg.color = COLOR_DEFAULT;
+  ac.bg.color = COLOR_DEFAULT;
+  for (size_t i = 0; i < mutt_array_size(Rules); i++)
+  {
+    int rc = 0;
+    ac.attrs = (i % 2) ? A_BOLD : A_UNDERLINE;
+    regex_colors_parse_color_list(MT_COLOR_BODY, Rules[i], &ac, &rc, err);
+  }
+  buf_pool_release(&err);
+
+  pager_layout(b);
+
+  regex_colors_cleanup();
+  merged_colors_cleanup();
+}
@@ -0,0 +1,142 @@
+/**
+ * @file
+ * Benchmarks for email parsing
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "bench.h"
+
+/**
+ * bench_rfc822_read_field - Benchmark mutt_rfc822_read_field()
+ * @param b Benchmark state
+ *
+ * One operation is splitting the header of one email into fields, in memory.
+ * Compare with bench_rfc822_read_line().
+ */
+void bench_rfc822_read_field(struct Bench *b)
+{
+  struct Rng rng = { 0 };
+  rng_init(&rng, BENCH_SEED);
+  struct Buffer *buf = buf_pool_get();
+
+  /* Just the headers, each followed by a blank line */
+  struct Buffer *headers[CORPUS_SIZE] = { 0 };
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+  {
+    buf_reset(buf);
+    corpus_email(&rng, buf, i);
+    const char *end = strstr(buf_string(buf), "\n\n");
+    const size_t len = end ? (end - buf_string(buf)) + 2 : buf_len(buf);
+    headers[i] = buf_new(NULL);
+    buf_addstr_n(headers[i], buf_string(buf), len);
+  }
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    const struct Buffer *hdr = headers[i % CORPUS_SIZE];
+    size_t pos = 0;
+    while (pos < buf_len(hdr))
+    {
+      pos += mutt_rfc822_read_field(buf_string(hdr) + pos, buf_len(hdr) - pos, buf);
+      if (buf_is_empty(buf))
+        break;
+    }
+  }
+  bench_stop(b);
+
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+    buf_free(&headers[i]);
+  buf_pool_release(&buf);
+}
+
+/**
+ * bench_rfc822_read_header - Benchmark mutt_rfc822_read_header()
+ * @param b Benchmark state
+ *
+ * One operation is reading the headers of one email.
+ */
+void bench_rfc822_read_header(struct Bench *b)
+{
+  long offsets[CORPUS_SIZE] = { 0 };
+  FILE *fp = corpus_mbox_file(CORPUS_SIZE, offsets);
+  if (!fp)
+    return;
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    struct Email *e = corpus_mbox_read(fp, offsets[i % CORPUS_SIZE]);
+    email_free(&e);
+  }
+  bench_stop(b);
+
+  mutt_file_fclose(&fp);
+}
+
+/**
+ * bench_rfc822_read_line - Benchmark mutt_rfc822_read_line()
+ * @param b Benchmark state
+ *
+ * One operation is reading the header lines of one email, without parsing
+ * them.  The headers are read in order, as loading an mbox does.
+ */
+void bench_rfc822_read_line(struct Bench *b)
+{
+  FILE *fp = tmpfile();
+  if (!fp)
+    return;
+
+  struct Rng rng = { 0 };
+  rng_init(&rng, BENCH_SEED);
+  struct Buffer *buf = buf_pool_get();
+
+  /* Just the headers, each followed by a blank line */
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+  {
+    buf_reset(buf);
+    corpus_email(&rng, buf, i);
+    const char *end = strstr(buf_string(buf), "\n\n");
+    const size_t len = end ? (end - buf_string(buf)) + 2 : buf_len(buf);
+    fwrite(buf_string(buf), 1, len, fp);
+  }
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    if ((i % CORPUS_SIZE) == 0)
+      rewind(fp);
+
+    while (mutt_rfc822_read_line(fp, buf) != 0)
+    {
+      if (buf_is_empty(buf))
+        break;
+    }
+  }
+  bench_stop(b);
+
+  buf_pool_release(&buf);
+  mutt_file_fclose(&fp);
+}
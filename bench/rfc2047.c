@@ -0,0 +1,61 @@
+/**
+ * @file
+ * Benchmarks for RFC2047 decoding
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "bench.h"
+
+/**
+ * bench_rfc2047_decode - Benchmark rfc2047_decode()
+ * @param b Benchmark state
+ *
+ * One operation is decoding one Subject, a third of which are encoded.
+ */
+void bench_rfc2047_decode(struct Bench *b)
+{
+  struct Rng rng = { 0 };
+  rng_init(&rng, BENCH_SEED);
+
+  char *corpus[CORPUS_SIZE] = { 0 };
+  struct Buffer *buf = buf_pool_get();
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+  {
+    buf_reset(buf);
+    corpus_subject(&rng, buf);
+    corpus[i] = buf_strdup(buf);
+  }
+  buf_pool_release(&buf);
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    char *str = mutt_str_dup(corpus[i % CORPUS_SIZE]);
+    rfc2047_decode(&str);
+    FREE(&str);
+  }
+  bench_stop(b);
+
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+    FREE(&corpus[i]);
+}
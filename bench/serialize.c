@@ -0,0 +1,101 @@
+/**
+ * @file
+ * Benchmarks for header cache serialisation
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include <stddef.h>
+#include <stdio.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "bench.h"
+#include "hcache/serialize.h"
+
+/**
+ * bench_serial_dump_envelope - Benchmark serial_dump_envelope()
+ * @param b Benchmark state
+ *
+ * One operation is serialising one Envelope.
+ *
+ * @note Like dump_email(), the blob must start with 4KiB, see lazy_realloc()
+ */
+void bench_serial_dump_envelope(struct Bench *b)
+{
+  long offsets[CORPUS_SIZE] = { 0 };
+  FILE *fp = corpus_mbox_file(CORPUS_SIZE, offsets);
+  if (!fp)
+    return;
+
+  struct Email *emails[CORPUS_SIZE] = { 0 };
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+    emails[i] = corpus_mbox_read(fp, offsets[i]);
+  mutt_file_fclose(&fp);
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    int off = 0;
+    unsigned char *d = mutt_mem_malloc(4096);
+    d = serial_dump_envelope(emails[i % CORPUS_SIZE]->env, d, &off, false);
+    FREE(&d);
+  }
+  bench_stop(b);
+
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+    email_free(&emails[i]);
+}
+
+/**
+ * bench_serial_restore_envelope - Benchmark serial_restore_envelope()
+ * @param b Benchmark state
+ *
+ * One operation is restoring one Envelope.
+ */
+void bench_serial_restore_envelope(struct Bench *b)
+{
+  long offsets[CORPUS_SIZE] = { 0 };
+  FILE *fp = corpus_mbox_file(CORPUS_SIZE, offsets);
+  if (!fp)
+    return;
+
+  unsigned char *data[CORPUS_SIZE] = { 0 };
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+  {
+    struct Email *e = corpus_mbox_read(fp, offsets[i]);
+    int off = 0;
+    data[i] = mutt_mem_malloc(4096);
+    data[i] = serial_dump_envelope(e->env, data[i], &off, false);
+    email_free(&e);
+  }
+  mutt_file_fclose(&fp);
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    int off = 0;
+    struct Envelope *env = mutt_env_new();
+    serial_restore_envelope(env, data[i % CORPUS_SIZE], &off, false);
+    mutt_env_free(&env);
+  }
+  bench_stop(b);
+
+  for (size_t i = 0; i < CORPUS_SIZE; i++)
+    FREE(&data[i]);
+}
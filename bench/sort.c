@@ -0,0 +1,108 @@
+/**
+ * @file
+ * Benchmarks for sorting and threading
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "mutt/lib.h"
+#include "config/lib.h"
+#include "email/lib.h"
+#include "core/lib.h"
+#include "bench.h"
+#include "mview.h"
+#include "mx.h"
+#include "sort.h"
+
+/// Number of Emails in the Mailbox
+#define SORT_EMAILS 10000
+
+/**
+ * mailbox_create - Create a Mailbox full of Emails
+ * @retval ptr New Mailbox
+ */
+static struct Mailbox *mailbox_create(void)
+{
+  long *offsets = mutt_mem_calloc(SORT_EMAILS, sizeof(long));
+  FILE *fp = corpus_mbox_file(SORT_EMAILS, offsets);
+
+  struct Mailbox *m = mailbox_new();
+  mx_alloc_memory(m, SORT_EMAILS);
+  for (size_t i = 0; fp && (i < SORT_EMAILS); i++)
+  {
+    struct Email *e = corpus_mbox_read(fp, offsets[i]);
+    e->index = i;
+    e->received = e->date_sent;
+    m->emails[m->msg_count++] = e;
+  }
+
+  mutt_file_fclose(&fp);
+  FREE(&offsets);
+  return m;
+}
+
+/**
+ * sort_run - Time sorting a Mailbox
+ * @param b           Benchmark state
+ * @param use_threads Value for $use_threads
+ *
+ * One operation is sorting all the Emails.
+ */
+static void sort_run(struct Bench *b, const char *use_threads)
+{
+  cs_subset_str_string_set(NeoMutt->sub, "sort", "date", NULL);
+  cs_subset_str_string_set(NeoMutt->sub, "use_threads", use_threads, NULL);
+
+  struct Mailbox *m = mailbox_create();
+  struct MailboxView *mv = mview_new(m, NeoMutt->notify);
+
+  bench_start(b);
+  for (size_t i = 0; i < b->n; i++)
+  {
+    mutt_sort_headers(mv, true);
+  }
+  bench_stop(b);
+
+  mview_free(&mv);
+  mailbox_free(&m);
+
+  cs_str_reset(NeoMutt->sub->cs, "use_threads", NULL);
+  cs_str_reset(NeoMutt->sub->cs, "sort", NULL);
+}
+
+/**
+ * bench_sort_date - Benchmark mutt_sort_headers(), by date
+ * @param b Benchmark state
+ */
+void bench_sort_date(struct Bench *b)
+{
+  sort_run(b, "flat");
+}
+
+/**
+ * bench_sort_threads - Benchmark mutt_sort_headers(), threaded
+ * @param b Benchmark state
+ */
+void bench_sort_threads(struct Bench *b)
+{
+  sort_run(b, "threads");
+}
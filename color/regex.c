@@ -29,9 +29,11 @@
  */
 
 #include "config.h"
+#include <ctype.h>
 #include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include "mutt/lib.h"
 #include "config/lib.h"
 #include "core/lib.h"
@@ -124,6 +126,7 @@ void regex_color_clear(struct RegexColor *rcol)
 
   attr_color_clear(&rcol->attr_color);
   FREE(&rcol->pattern);
+  FREE(&rcol->literal);
   regfree(&rcol->regex);
   mutt_pattern_free(&rcol->color_pattern);
 }
@@ -220,6 +223,127 @@ struct RegexColorList *regex_colors_get_list(enum ColorId cid)
   }
 }
 
+/**
+ * regex_colors_mem_size - Calculate the memory used by the Regex colours
+ * @retval num Size in bytes
+ *
+ * The internals of the compiled regexes and patterns aren't counted.
+ */
+size_t regex_colors_mem_size(void)
+{
+  size_t size = 0;
+
+  for (enum ColorId cid = MT_COLOR_NONE; cid < MT_COLOR_MAX; cid++)
+  {
+    const struct RegexColorList *rcl = regex_colors_get_list(cid);
+    if (!rcl)
+      continue;
+
+    const struct RegexColor *rcol = NULL;
+    STAILQ_FOREACH(rcol, rcl, entries)
+    {
+      size += sizeof(*rcol) + mutt_str_mem_size(rcol->pattern) +
+              mutt_str_mem_size(rcol->literal);
+    }
+  }
+
+  return size;
+}
+
+/**
+ * regex_literal - Find the text that every match of a simple regex contains
+ * @param s Regex pattern
+ * @retval ptr  Literal text, must be freed by the caller
+ * @retval NULL Pattern isn't a simple word or phrase
+ *
+ * Many body colours just highlight a word, e.g. `\<urgent\>`.  If a line
+ * doesn't contain the word, the pager can skip the regex entirely.
+ *
+ * Only plain ASCII text is accepted, optionally surrounded by anchors.
+ */
+static char *regex_literal(const char *s)
+{
+  if (!s)
+    return NULL;
+
+  if (*s == '^')
+    s++;
+  if ((s[0] == '\\') && ((s[1] == '<') || (s[1] == 'b')))
+    s += 2;
+
+  size_t len = 0;
+  while ((s[len] != '\0') &&
+         (isalnum((unsigned char) s[len]) || strchr(" !\"#%&',-/:;<=>@_`~", s[len])))
+  {
+    len++;
+  }
+
+  const char *end = s + len;
+  if ((end[0] == '\\') && ((end[1] == '>') || (end[1] == 'b')))
+    end += 2;
+  if (*end == '$')
+    end++;
+
+  if ((len == 0) || (*end != '\0'))
+    return NULL;
+
+  return mutt_strn_dup(s, len);
+}
+
+/**
+ * regex_color_match - Find the next match of a body colour in a line
+ * @param[in]  rcol   RegexColor
+ * @param[in]  buf    Line of text
+ * @param[in]  offset Search from this offset into the line
+ * @param[out] pmatch Match, relative to the start of the line
+ * @retval true  Match found
+ * @retval false No more matches, RegexColor::stop_matching is set
+ *
+ * A match that starts at, or after, the offset is still the leftmost match,
+ * so the regex is only searched again once the offset has moved past it.
+ * With many colours, each regex scans the line about once, rather than once
+ * per match of any regex.
+ *
+ * The caller must reset RegexColor::stop_matching and
+ * RegexColor::next_match (rm_so = -1) at the start of each line.
+ *
+ * @note A remembered match was found with the context of the earlier offset.
+ *       Searching from the later offset would treat it as a word boundary,
+ *       so `\<word` could match in the middle of a word.
+ */
+bool regex_color_match(struct RegexColor *rcol, const char *buf, int offset,
+                       regmatch_t *pmatch)
+{
+  if (!rcol || !buf || !pmatch || rcol->stop_matching)
+    return false;
+
+  if (rcol->next_match.rm_so < offset)
+  {
+    /* Skip the regex if the line doesn't contain the text it needs */
+    if (rcol->literal && !(rcol->literal_icase ?
+                               mutt_istr_find(buf + offset, rcol->literal) :
+                               strstr(buf + offset, rcol->literal)))
+    {
+      rcol->stop_matching = true;
+      return false;
+    }
+
+    if (regexec(&rcol->regex, buf + offset, 1, pmatch, ((offset != 0) ? REG_NOTBOL : 0)) != 0)
+    {
+      /* Once a regex fails to match, don't try matching it again.
+       * On very long lines this can cause a performance issue if there
+       * are other regexes that have many matches. */
+      rcol->stop_matching = true;
+      return false;
+    }
+    rcol->next_match.rm_so = pmatch[0].rm_so + offset;
+    rcol->next_match.rm_eo = pmatch[0].rm_eo + offset;
+  }
+
+  pmatch[0] = rcol->next_match;
+  return true;
+}
+
 /**
  * add_pattern - Associate a colour to a pattern
  * @param rcl       List of existing colours
@@ -272,6 +396,7 @@ static enum CommandResult add_pattern(struct RegexColorList *rcl, const char *s,
         regex_color_free(rcl, &rcol);
         return MUTT_CMD_ERROR;
       }
+      rcol->color_deps = mutt_pattern_deps(rcol->color_pattern);
     }
     else
     {
@@ -288,6 +413,8 @@ static enum CommandResult add_pattern(struct RegexColorList *rcl, const char *s,
         regex_color_free(rcl, &rcol);
         return MUTT_CMD_ERROR;
       }
+      rcol->literal = regex_literal(s);
+      rcol->literal_icase = (flags & REG_ICASE);
     }
     rcol->pattern = mutt_str_dup(s);
     rcol->match = match;
@@ -25,6 +25,7 @@
 
 #include "config.h"
 #include <stdbool.h>
+#include <stdint.h>
 #include "mutt/lib.h"
 #include "attr.h"
 #include "color.h"
@@ -37,22 +38,28 @@ struct RegexColor
   struct AttrColor attr_color;       ///< Colour and attributes to apply
   char *pattern;                     ///< Pattern to match
   regex_t regex;                     ///< Compiled regex
+  char *literal;                     ///< Text that every match contains, or NULL
   int match;                         ///< Substring to match, 0 for old behaviour
   struct PatternList *color_pattern; ///< Compiled pattern to speed up index color calculation
+  uint8_t color_deps;                ///< What color_pattern depends upon, see #PatternDeps
 
+  bool literal_icase : 1;            ///< Search for the literal ignoring case
   bool stop_matching : 1;            ///< Used by the pager for body patterns, to prevent the color from being retried once it fails
+  regmatch_t next_match;             ///< Used by the pager for body patterns, to remember the next match in the line
 
   STAILQ_ENTRY(RegexColor) entries;  ///< Linked list
 };
 STAILQ_HEAD(RegexColorList, RegexColor);
 
 void                   regex_color_clear(struct RegexColor *rcol);
-void                   regex_color_free(struct RegexColorList *list, struct RegexColor **ptr);
-struct RegexColor *    regex_color_new (void);
+void                   regex_color_free (struct RegexColorList *list, struct RegexColor **ptr);
+bool                   regex_color_match(struct RegexColor *rcol, const char *buf, int offset, regmatch_t *pmatch);
+struct RegexColor *    regex_color_new  (void);
 
 void                   regex_colors_cleanup(void);
 struct RegexColorList *regex_colors_get_list(enum ColorId cid);
 void                   regex_colors_init(void);
+size_t                 regex_colors_mem_size(void);
 
 void                   regex_color_list_clear(struct RegexColorList *rcl);
 
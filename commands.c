@@ -1621,6 +1621,154 @@ static enum CommandResult parse_version(struct Buffer *buf, struct Buffer *s,
   return MUTT_CMD_SUCCESS;
 }
 
+/**
+ * parse_debug_stats - Parse the 'debug-stats' command - Implements Command::parse() - @ingroup command_parse
+ */
+static enum CommandResult parse_debug_stats(struct Buffer *buf, struct Buffer *s,
+                                            intptr_t data, struct Buffer *err)
+{
+  // silently ignore 'debug-stats' if it's in a config file
+  if (!StartupComplete)
+    return MUTT_CMD_SUCCESS;
+
+  struct Buffer *tempfile = buf_pool_get();
+  buf_mktemp(tempfile);
+
+  FILE *fp_out = mutt_file_fopen(buf_string(tempfile), "w");
+  if (!fp_out)
+  {
+    // L10N: '%s' is the file name of the temporary file
+    buf_printf(err, _("Could not create temporary file %s"), buf_string(tempfile));
+    buf_pool_release(&tempfile);
+    return MUTT_CMD_ERROR;
+  }
+
+  stats_dump_text(fp_out);
+
+  struct BufferPoolStats bps = { 0 };
+  buf_pool_stats(&bps);
+  fprintf(fp_out, "\nBuffer pool: %zu gets, %zu allocs, %zu resizes, %zu in use (max %zu), %zu pooled\n",
+          bps.gets, bps.allocs, bps.resizes, bps.in_use, bps.max_in_use, bps.pooled);
+  mutt_file_fclose(&fp_out);
+
+  struct PagerData pdata = { 0 };
+  struct PagerView pview = { &pdata };
+
+  pdata.fname = buf_string(tempfile);
+
+  pview.banner = "debug-stats";
+  pview.flags = MUTT_PAGER_NO_FLAGS;
+  pview.mode = PAGER_MODE_OTHER;
+
+  mutt_do_pager(&pview, NULL);
+  buf_pool_release(&tempfile);
+
+  return MUTT_CMD_SUCCESS;
+}
+
+/**
+ * dump_memory - Write a report of the memory usage
+ * @param fp File to write to
+ */
+static void dump_memory(FILE *fp)
+{
+  char size[128] = { 0 };
+
+  struct MemoryStats ms = { 0 };
+  mutt_mem_stats(&ms);
+  mutt_str_pretty_size(size, sizeof(size), ms.bytes);
+  fprintf(fp, "Heap: %zu allocs, %zu reallocs, %zu frees, %s requested\n",
+          ms.allocs, ms.reallocs, ms.frees, size);
+  if (ms.in_use != 0)
+  {
+    mutt_str_pretty_size(size, sizeof(size), ms.in_use);
+    fprintf(fp, "Heap in use: %s\n", size);
+  }
+
+  fprintf(fp, "\n%-40s %8s %8s %8s %8s %8s %8s\n", "Mailbox", "Emails",
+          "Email", "Envelope", "Body", "Hash", "Total");
+
+  struct MailboxMemory total = { 0 };
+  struct MailboxList ml = STAILQ_HEAD_INITIALIZER(ml);
+  neomutt_mailboxlist_get_all(&ml, NeoMutt, MUTT_MAILBOX_ANY);
+  struct MailboxNode *np = NULL;
+  STAILQ_FOREACH(np, &ml, entries)
+  {
+    struct Mailbox *m = np->mailbox;
+    if (m->msg_count == 0)
+      continue;
+
+    struct MailboxMemory mm = { 0 };
+    mailbox_mem_usage(m, &mm);
+    total.emails += mm.emails;
+    total.envelopes += mm.envelopes;
+    total.bodies += mm.bodies;
+    total.hash_tables += mm.hash_tables;
+
+    const size_t sizes[] = { mm.emails, mm.envelopes, mm.bodies, mm.hash_tables,
+                             mm.emails + mm.envelopes + mm.bodies + mm.hash_tables };
+    fprintf(fp, "%-40s %8d", mailbox_path(m), m->msg_count);
+    for (int i = 0; i < mutt_array_size(sizes); i++)
+    {
+      mutt_str_pretty_size(size, sizeof(size), sizes[i]);
+      fprintf(fp, " %8s", size);
+    }
+    fputc('\n', fp);
+  }
+  neomutt_mailboxlist_clear(&ml);
+
+  mutt_str_pretty_size(size, sizeof(size),
+                       total.emails + total.envelopes + total.bodies + total.hash_tables);
+  fprintf(fp, "%-40s %53s\n", "Total", size);
+
+  mutt_str_pretty_size(size, sizeof(size), pager_mem_size());
+  fprintf(fp, "\nPager lines: %s\n", size);
+  mutt_str_pretty_size(size, sizeof(size), regex_colors_mem_size());
+  fprintf(fp, "Colours: %s\n", size);
+  mutt_str_pretty_size(size, sizeof(size), mutt_intern_mem_size());
+  fprintf(fp, "Interned strings: %zu, %s\n", mutt_intern_count(), size);
+}
+
+/**
+ * parse_debug_memory - Parse the 'debug-memory' command - Implements Command::parse() - @ingroup command_parse
+ */
+static enum CommandResult parse_debug_memory(struct Buffer *buf, struct Buffer *s,
+                                             intptr_t data, struct Buffer *err)
+{
+  // silently ignore 'debug-memory' if it's in a config file
+  if (!StartupComplete)
+    return MUTT_CMD_SUCCESS;
+
+  struct Buffer *tempfile = buf_pool_get();
+  buf_mktemp(tempfile);
+
+  FILE *fp_out = mutt_file_fopen(buf_string(tempfile), "w");
+  if (!fp_out)
+  {
+    // L10N: '%s' is the file name of the temporary file
+    buf_printf(err, _("Could not create temporary file %s"), buf_string(tempfile));
+    buf_pool_release(&tempfile);
+    return MUTT_CMD_ERROR;
+  }
+
+  dump_memory(fp_out);
+  mutt_file_fclose(&fp_out);
+
+  struct PagerData pdata = { 0 };
+  struct PagerView pview = { &pdata };
+
+  pdata.fname = buf_string(tempfile);
+
+  pview.banner = "debug-memory";
+  pview.flags = MUTT_PAGER_NO_FLAGS;
+  pview.mode = PAGER_MODE_OTHER;
+
+  mutt_do_pager(&pview, NULL);
+  buf_pool_release(&tempfile);
+
+  return MUTT_CMD_SUCCESS;
+}
+
 /**
  * source_stack_cleanup - Free memory from the stack used for the source command
  */
@@ -1642,6 +1790,8 @@ static const struct Command MuttCommands[] = {
   { "bind",                mutt_parse_bind,        0 },
   { "cd",                  parse_cd,               0 },
   { "color",               mutt_parse_color,       0 },
+  { "debug-memory",        parse_debug_memory,     0 },
+  { "debug-stats",         parse_debug_stats,      0 },
   { "echo",                parse_echo,             0 },
   { "exec",                mutt_parse_exec,        0 },
   { "finish",              parse_finish,           0 },
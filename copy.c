@@ -425,8 +425,6 @@ int mutt_copy_hdr(FILE *fp_in, FILE *fp_out, LOFF_T off_start, LOFF_T off_end,
 int mutt_copy_header(FILE *fp_in, struct Email *e, FILE *fp_out,
                      CopyHeaderFlags chflags, const char *prefix, int wraplen)
 {
-  char *temp_hdr = NULL;
-
   if (e->env)
   {
     chflags |= ((e->env->changed & MUTT_ENV_CHANGED_IRT) ? CH_UPDATE_IRT : 0) |
@@ -534,42 +532,42 @@ int mutt_copy_header(FILE *fp_in, struct Email *e, FILE *fp_out,
   const short c_wrap = cs_subset_number(NeoMutt->sub, "wrap");
   if ((chflags & CH_UPDATE_LABEL) && e->env->x_label)
   {
-    temp_hdr = e->env->x_label;
-    /* env->x_label isn't currently stored with direct references elsewhere.
-     * Mailbox->label_hash strdups the keys.  But to be safe, encode a copy */
+    /* env->x_label is interned and shared with other Emails,
+     * so encode a copy */
+    const char *label = e->env->x_label;
+    char *encoded = NULL;
     if (!(chflags & CH_DECODE))
     {
-      temp_hdr = mutt_str_dup(temp_hdr);
-      rfc2047_encode(&temp_hdr, NULL, sizeof("X-Label:"), c_send_charset);
+      encoded = mutt_str_dup(label);
+      rfc2047_encode(&encoded, NULL, sizeof("X-Label:"), c_send_charset);
+      label = encoded;
     }
-    if (mutt_write_one_header(fp_out, "X-Label", temp_hdr, (chflags & CH_PREFIX) ? prefix : 0,
-                              mutt_window_wrap_cols(wraplen, c_wrap), chflags,
-                              NeoMutt->sub) == -1)
-    {
+    int rc = mutt_write_one_header(fp_out, "X-Label", label, (chflags & CH_PREFIX) ? prefix : 0,
+                                   mutt_window_wrap_cols(wraplen, c_wrap),
+                                   chflags, NeoMutt->sub);
+    FREE(&encoded);
+    if (rc == -1)
       return -1;
-    }
-    if (!(chflags & CH_DECODE))
-      FREE(&temp_hdr);
   }
 
   if ((chflags & CH_UPDATE_SUBJECT) && e->env->subject)
   {
-    temp_hdr = e->env->subject;
-    /* env->subject is directly referenced in Mailbox->subj_hash, so we
-     * have to be careful not to encode (and thus free) that memory. */
+    /* env->subject is interned and shared with other Emails,
+     * so encode a copy */
+    const char *subj = e->env->subject;
+    char *encoded = NULL;
     if (!(chflags & CH_DECODE))
     {
-      temp_hdr = mutt_str_dup(temp_hdr);
-      rfc2047_encode(&temp_hdr, NULL, sizeof("Subject:"), c_send_charset);
+      encoded = mutt_str_dup(subj);
+      rfc2047_encode(&encoded, NULL, sizeof("Subject:"), c_send_charset);
+      subj = encoded;
     }
-    if (mutt_write_one_header(fp_out, "Subject", temp_hdr, (chflags & CH_PREFIX) ? prefix : 0,
-                              mutt_window_wrap_cols(wraplen, c_wrap), chflags,
-                              NeoMutt->sub) == -1)
-    {
+    int rc = mutt_write_one_header(fp_out, "Subject", subj, (chflags & CH_PREFIX) ? prefix : 0,
+                                   mutt_window_wrap_cols(wraplen, c_wrap),
+                                   chflags, NeoMutt->sub);
+    FREE(&encoded);
+    if (rc == -1)
       return -1;
-    }
-    if (!(chflags & CH_DECODE))
-      FREE(&temp_hdr);
   }
 
   if ((chflags & CH_NONEWLINE) == 0)
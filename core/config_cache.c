@@ -25,24 +25,56 @@
  * @page core_config_cache Cache of config variables
  *
  * Cache of config variables
+ *
+ * Looking up a config variable by name means hashing the name and searching
+ * the ConfigSet.  A ConfigHandle does the lookup once and remembers where the
+ * variable's value is stored.  After that, reading the variable is a single
+ * pointer dereference and it's always up to date.
+ *
+ * The Handles are forgotten if their variable is deleted, or when the cache is
+ * cleaned up.  They'll be resolved again the next time they're used.
  */
 
 #include "config.h"
+#include <assert.h>
 #include <stdbool.h>
-#include <string.h>
+#include <stddef.h>
 #include "mutt/lib.h"
 #include "config/lib.h"
 #include "config_cache.h"
 #include "neomutt.h"
 
-/// Is the cache enabled?
-static bool CacheActive = false;
-/// Cached value of $assumed_charset
-static const struct Slist *CachedAssumedCharset = NULL;
-/// Cached value of $charset
-static const char *CachedCharset = NULL;
-/// Cached value of $maildir_field_delimiter
-static const char *CachedMaildirFieldDelimiter = NULL;
+/// Linked list of the resolved Handles
+static struct ConfigHandle *HandleList = NULL;
+
+/// Handle for $assumed_charset
+static struct ConfigHandle HandleAssumedCharset = CONFIG_HANDLE("assumed_charset");
+/// Handle for $charset
+static struct ConfigHandle HandleCharset = CONFIG_HANDLE("charset");
+/// Handle for $maildir_field_delimiter
+static struct ConfigHandle HandleMaildirFieldDelimiter = CONFIG_HANDLE("maildir_field_delimiter");
+
+/**
+ * handle_forget - Forget the location of a config variable
+ * @param ch Handle
+ */
+static void handle_forget(struct ConfigHandle *ch)
+{
+  struct ConfigHandle **prev = &HandleList;
+  for (struct ConfigHandle *np = HandleList; np; np = np->next)
+  {
+    if (np == ch)
+    {
+      *prev = np->next;
+      break;
+    }
+    prev = &np->next;
+  }
+
+  ch->var = NULL;
+  ch->he = NULL;
+  ch->next = NULL;
+}
 
 /**
  * cc_config_observer - Notification that a Config Variable has changed - Implements ::observer_t - @ingroup observer_api
@@ -51,26 +83,22 @@ static int cc_config_observer(struct NotifyCallback *nc)
 {
   if (nc->event_type != NT_CONFIG)
     return 0; // LCOV_EXCL_LINE
+  if (nc->event_subtype != NT_CONFIG_DELETED)
+    return 0;
   if (!nc->event_data)
     return -1; // LCOV_EXCL_LINE
 
   struct EventConfig *ev_c = nc->event_data;
-  if (!ev_c->name || !ev_c->he)
+  if (!ev_c->he)
     return 0; // LCOV_EXCL_LINE
 
-  if (mutt_str_equal(ev_c->name, "assumed_charset"))
+  for (struct ConfigHandle *ch = HandleList; ch; ch = ch->next)
   {
-    CachedAssumedCharset = (const struct Slist *) cs_subset_he_native_get(ev_c->sub,
-                                                                          ev_c->he, NULL);
-  }
-  else if (mutt_str_equal(ev_c->name, "charset"))
-  {
-    CachedCharset = (const char *) cs_subset_he_native_get(ev_c->sub, ev_c->he, NULL);
-  }
-  else if (mutt_str_equal(ev_c->name, "maildir_field_delimiter"))
-  {
-    CachedMaildirFieldDelimiter = (const char *) cs_subset_he_native_get(ev_c->sub,
-                                                                         ev_c->he, NULL);
+    if (ch->he == ev_c->he)
+    {
+      handle_forget(ch);
+      break;
+    }
   }
 
   mutt_debug(LL_DEBUG5, "config done\n");
@@ -78,20 +106,28 @@ static int cc_config_observer(struct NotifyCallback *nc)
 }
 
 /**
- * cache_setup - Setup a cache of some config variables
+ * config_handle_resolve - Find the storage of a config variable
+ * @param ch Handle to resolve
+ *
+ * The config variable must exist.
  */
-static void cache_setup(void)
+void config_handle_resolve(struct ConfigHandle *ch)
 {
-  if (CacheActive)
-    return; // LCOV_EXCL_LINE
+  assert(NeoMutt && ch && ch->name);
 
-  notify_observer_add(NeoMutt->sub->notify, NT_CONFIG, cc_config_observer, NULL);
+  struct HashElem *he = cs_subset_create_inheritance(NeoMutt->sub, ch->name);
+  assert(he);
 
-  CachedAssumedCharset = cs_subset_slist(NeoMutt->sub, "assumed_charset");
-  CachedCharset = cs_subset_string(NeoMutt->sub, "charset");
-  CachedMaildirFieldDelimiter = cs_subset_string(NeoMutt->sub, "maildir_field_delimiter");
+  he = cs_get_base(he);
+  struct ConfigDef *cdef = he->data;
 
-  CacheActive = true;
+  if (!HandleList)
+    notify_observer_add(NeoMutt->sub->notify, NT_CONFIG, cc_config_observer, NULL);
+
+  ch->he = he;
+  ch->var = &cdef->var;
+  ch->next = HandleList;
+  HandleList = ch;
 }
 
 /**
@@ -100,13 +136,7 @@ static void cache_setup(void)
  */
 const struct Slist *cc_assumed_charset(void)
 {
-  if (!CacheActive)
-  {
-    cache_setup();
-    CachedAssumedCharset = cs_subset_slist(NeoMutt->sub, "assumed_charset");
-  }
-
-  return CachedAssumedCharset;
+  return cc_slist(&HandleAssumedCharset);
 }
 
 /**
@@ -115,13 +145,7 @@ const struct Slist *cc_assumed_charset(void)
  */
 const char *cc_charset(void)
 {
-  if (!CacheActive)
-  {
-    cache_setup();
-    CachedCharset = cs_subset_string(NeoMutt->sub, "charset");
-  }
-
-  return CachedCharset;
+  return cc_string(&HandleCharset);
 }
 
 /**
@@ -130,27 +154,17 @@ const char *cc_charset(void)
  */
 const char *cc_maildir_field_delimiter(void)
 {
-  if (!CacheActive)
-  {
-    cache_setup();
-    CachedMaildirFieldDelimiter = cs_subset_string(NeoMutt->sub, "maildir_field_delimiter");
-  }
-
-  return CachedMaildirFieldDelimiter;
+  return cc_string(&HandleMaildirFieldDelimiter);
 }
 
 /**
- * config_cache_cleanup - Cleanup the cache of charset config variables
+ * config_cache_cleanup - Forget all the config Handles
  */
 void config_cache_cleanup(void)
 {
-  if (NeoMutt)
+  if (NeoMutt && HandleList)
     notify_observer_remove(NeoMutt->sub->notify, cc_config_observer, NULL);
 
-  // Don't free them, the config system owns the data
-  CachedAssumedCharset = NULL;
-  CachedCharset = NULL;
-  CachedMaildirFieldDelimiter = NULL;
-
-  CacheActive = false;
+  while (HandleList)
+    handle_forget(HandleList);
 }
@@ -24,6 +24,150 @@
 #ifndef MUTT_CORE_CONFIG_CACHE_H
 #define MUTT_CORE_CONFIG_CACHE_H
 
+#include <stdbool.h>
+#include "config/lib.h"
+
+struct HashElem;
+
+/**
+ * struct ConfigHandle - A pre-resolved global config variable
+ *
+ * A ConfigHandle looks up a config variable once, then reads its value
+ * directly.  It's intended for code that reads config in a loop.
+ *
+ * Declare it with CONFIG_HANDLE() and read it with cc_bool(), cc_string(), etc.
+ *
+ * @note Handles only see the global value, from `NeoMutt->sub`.
+ *       Account-specific values must be read with cs_subset_bool(), etc.
+ */
+struct ConfigHandle
+{
+  const char *name;          ///< Name of the config variable
+  const void *var;           ///< Storage of the config variable's value
+  struct HashElem *he;       ///< Config item
+  struct ConfigHandle *next; ///< Linked list of resolved Handles
+};
+
+/**
+ * CONFIG_HANDLE - Initialise a ConfigHandle
+ * @param NAME Name of the config variable, e.g. "sort"
+ */
+#define CONFIG_HANDLE(NAME) { NAME, NULL, NULL, NULL }
+
+void config_handle_resolve(struct ConfigHandle *ch);
+
+/**
+ * config_handle_var - Get the storage of a config variable
+ * @param ch Handle
+ * @retval ptr Storage of the config variable's value
+ */
+static inline const void *config_handle_var(struct ConfigHandle *ch)
+{
+  if (!ch->var)
+    config_handle_resolve(ch);
+  return ch->var;
+}
+
+/**
+ * cc_bool - Get the value of a Bool config variable
+ * @param ch Handle
+ * @retval bool Value
+ */
+static inline bool cc_bool(struct ConfigHandle *ch)
+{
+  return *(const bool *) config_handle_var(ch);
+}
+
+/**
+ * cc_enum - Get the value of an Enum config variable
+ * @param ch Handle
+ * @retval num Value
+ */
+static inline unsigned char cc_enum(struct ConfigHandle *ch)
+{
+  return *(const unsigned char *) config_handle_var(ch);
+}
+
+/**
+ * cc_long - Get the value of a Long config variable
+ * @param ch Handle
+ * @retval num Value
+ */
+static inline long cc_long(struct ConfigHandle *ch)
+{
+  return *(const long *) config_handle_var(ch);
+}
+
+/**
+ * cc_mbtable - Get the value of a Multibyte Table config variable
+ * @param ch Handle
+ * @retval ptr Value
+ */
+static inline const struct MbTable *cc_mbtable(struct ConfigHandle *ch)
+{
+  return *(struct MbTable *const *) config_handle_var(ch);
+}
+
+/**
+ * cc_number - Get the value of a Number config variable
+ * @param ch Handle
+ * @retval num Value
+ */
+static inline short cc_number(struct ConfigHandle *ch)
+{
+  return *(const short *) config_handle_var(ch);
+}
+
+/**
+ * cc_quad - Get the value of a Quad-option config variable
+ * @param ch Handle
+ * @retval enum Value, e.g. #MUTT_ASKYES
+ */
+static inline enum QuadOption cc_quad(struct ConfigHandle *ch)
+{
+  return *(const char *) config_handle_var(ch);
+}
+
+/**
+ * cc_regex - Get the value of a Regex config variable
+ * @param ch Handle
+ * @retval ptr Value
+ */
+static inline const struct Regex *cc_regex(struct ConfigHandle *ch)
+{
+  return *(struct Regex *const *) config_handle_var(ch);
+}
+
+/**
+ * cc_slist - Get the value of a String List config variable
+ * @param ch Handle
+ * @retval ptr Value
+ */
+static inline const struct Slist *cc_slist(struct ConfigHandle *ch)
+{
+  return *(struct Slist *const *) config_handle_var(ch);
+}
+
+/**
+ * cc_sort - Get the value of a Sort config variable
+ * @param ch Handle
+ * @retval num Value, e.g. #SORT_DATE
+ */
+static inline short cc_sort(struct ConfigHandle *ch)
+{
+  return *(const short *) config_handle_var(ch);
+}
+
+/**
+ * cc_string - Get the value of a String (or Path) config variable
+ * @param ch Handle
+ * @retval ptr Value
+ */
+static inline const char *cc_string(struct ConfigHandle *ch)
+{
+  return *(const char *const *) config_handle_var(ch);
+}
+
 const struct Slist *cc_assumed_charset        (void);
 const char *        cc_charset                (void);
 const char *        cc_maildir_field_delimiter(void);
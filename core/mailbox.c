@@ -30,6 +30,7 @@
 
 #include "config.h"
 #include <assert.h>
+#include <string.h>
 #include <sys/stat.h>
 #include "config/lib.h"
 #include "email/lib.h"
@@ -126,6 +127,8 @@ void mailbox_free(struct Mailbox **ptr)
   FREE(&m->realpath);
   FREE(&m->emails);
   FREE(&m->v2r);
+  for (int i = 0; i < MB_MAX; i++)
+    bitset_free(&m->bits[i]);
   notify_free(&m->notify);
   mailbox_gc_run();
 
@@ -234,6 +237,59 @@ void mailbox_changed(struct Mailbox *m, enum NotifyMailbox action)
   notify_send(m->notify, NT_MAILBOX, action, &ev_m);
 }
 
+/**
+ * mailbox_email_changed - Record that an Email's flags were set directly
+ * @param m Mailbox
+ * @param e Email
+ *
+ * mutt_set_flag() keeps the caches up to date.  Code that writes the flags
+ * itself, e.g. a backend re-reading its state, must call this afterwards.
+ * Bumping Email::generation invalidates anything cached for the Email, and
+ * the Mailbox's Bitsets are updated to match the flags.
+ */
+void mailbox_email_changed(struct Mailbox *m, struct Email *e)
+{
+  if (!m || !e)
+    return;
+
+  e->generation++;
+  mailbox_bits_set(m, e);
+}
+
+/**
+ * mailbox_mem_usage - Calculate the memory used by a Mailbox
+ * @param[in]  m  Mailbox
+ * @param[out] mm Memory used, by category
+ *
+ * The sizes are estimates; they don't include the allocator's overhead.
+ */
+void mailbox_mem_usage(const struct Mailbox *m, struct MailboxMemory *mm)
+{
+  if (!m || !mm)
+    return;
+
+  memset(mm, 0, sizeof(*mm));
+
+  mm->emails = m->email_max * (sizeof(*m->emails) + sizeof(*m->v2r));
+  for (int i = 0; i < MB_MAX; i++)
+    mm->emails += ROUND_UP(m->bits[i].size, 64) / 8;
+
+  for (int i = 0; i < m->msg_count; i++)
+  {
+    const struct Email *e = m->emails[i];
+    if (!e)
+      continue;
+
+    mm->emails += email_mem_size(e);
+    mm->envelopes += mutt_env_mem_size(e->env);
+    mm->bodies += mutt_body_mem_size(e->body);
+  }
+
+  mm->hash_tables = mutt_hash_mem_size(m->id_hash) +
+                    mutt_hash_mem_size(m->subj_hash) +
+                    mutt_hash_mem_size(m->label_hash);
+}
+
 /**
  * mailbox_size_add - Add an email's size to the total size of a Mailbox
  * @param m Mailbox
@@ -254,6 +310,143 @@ void mailbox_size_sub(struct Mailbox *m, const struct Email *e)
   m->size -= email_size(e);
 }
 
+/**
+ * email_at - Get the Email whose state is recorded in the Bitsets
+ * @param m Mailbox
+ * @param e Email
+ * @retval num Position of the Email in the Bitsets
+ * @retval -1  The Email isn't where it's expected
+ *
+ * If the Email isn't where we expect, e.g. the Mailbox has been sorted, the
+ * Bitsets are stale.
+ */
+static int email_at(const struct Mailbox *m, const struct Email *e)
+{
+  if ((e->msgno < 0) || (e->msgno >= m->msg_count) || (m->emails[e->msgno] != e))
+    return -1;
+
+  return e->msgno;
+}
+
+/**
+ * mailbox_bits_count - Set the Mailbox's counters from the Bitsets
+ * @param m Mailbox
+ *
+ * @pre The Bitsets are up to date, e.g. after mailbox_bits_rebuild()
+ */
+void mailbox_bits_count(struct Mailbox *m)
+{
+  if (!m)
+    return;
+
+  m->msg_unread = bitset_count(&m->bits[MB_UNREAD]);
+  m->msg_new = bitset_count(&m->bits[MB_NEW]);
+  m->msg_flagged = bitset_count(&m->bits[MB_FLAGGED]);
+  m->msg_deleted = bitset_count(&m->bits[MB_DELETED]);
+  m->msg_tagged = bitset_count(&m->bits[MB_TAGGED]);
+}
+
+/**
+ * mailbox_bits_rebuild - Recreate the Bitsets from the Emails
+ * @param m Mailbox
+ */
+void mailbox_bits_rebuild(struct Mailbox *m)
+{
+  if (!m)
+    return;
+
+  mailbox_bits_resize(m);
+
+  for (int i = 0; i < m->msg_count; i++)
+  {
+    const struct Email *e = m->emails[i];
+    if (!e)
+      break;
+
+    mailbox_bits_set(m, e);
+    bitset_set(&m->bits[MB_VISIBLE], i, (e->vnum >= 0));
+  }
+}
+
+/**
+ * mailbox_bits_resize - Resize the Bitsets to match the Emails
+ * @param m Mailbox
+ *
+ * Any new bits will be clear.
+ */
+void mailbox_bits_resize(struct Mailbox *m)
+{
+  if (!m)
+    return;
+
+  for (int i = 0; i < MB_MAX; i++)
+    bitset_resize(&m->bits[i], MAX(m->msg_count, 0));
+}
+
+/**
+ * mailbox_bits_set - Record the flags of an Email
+ * @param m Mailbox
+ * @param e Email
+ *
+ * If the Email isn't where we expect, e.g. the Mailbox has been sorted, then
+ * the Bitsets are stale and will be rebuilt when they're next used.
+ */
+void mailbox_bits_set(struct Mailbox *m, const struct Email *e)
+{
+  if (!m || !e)
+    return;
+
+  const int idx = email_at(m, e);
+  if (idx < 0)
+    return;
+
+  bitset_set(&m->bits[MB_UNREAD], idx, !e->read);
+  bitset_set(&m->bits[MB_NEW], idx, !e->read && !e->old);
+  bitset_set(&m->bits[MB_FLAGGED], idx, e->flagged);
+  bitset_set(&m->bits[MB_DELETED], idx, e->deleted);
+  bitset_set(&m->bits[MB_TAGGED], idx, e->tagged);
+}
+
+/**
+ * mailbox_bits_stale - Does a Bitset need rebuilding?
+ * @param m   Mailbox
+ * @param bit Bitset to check, e.g. #MB_VISIBLE
+ * @retval true The Bitset doesn't cover all the Emails
+ */
+bool mailbox_bits_stale(const struct Mailbox *m, enum MailboxBits bit)
+{
+  if (!m)
+    return false;
+
+  return m->bits[bit].size != (size_t) MAX(m->msg_count, 0);
+}
+
+/**
+ * mailbox_vnum_set - Set the virtual number of an Email
+ * @param m    Mailbox
+ * @param e    Email
+ * @param vnum Virtual number, or -1 if the Email isn't shown
+ */
+void mailbox_vnum_set(struct Mailbox *m, struct Email *e, int vnum)
+{
+  if (!e)
+    return;
+
+  e->vnum = vnum;
+  if (!m)
+    return;
+
+  const int idx = email_at(m, e);
+  if (idx < 0)
+  {
+    // Force a rebuild
+    bitset_free(&m->bits[MB_VISIBLE]);
+    return;
+  }
+
+  bitset_set(&m->bits[MB_VISIBLE], idx, (vnum >= 0));
+}
+
 /**
  * mailbox_set_subset - Set a Mailbox's Config Subset
  * @param m   Mailbox
@@ -53,6 +53,22 @@ enum MailboxType
   MUTT_COMPRESSED,         ///< Compressed file Mailbox type
 };
 
+/**
+ * enum MailboxBits - States of the Emails, tracked in Bitsets
+ *
+ * Each Bitset is indexed by position in Mailbox.emails.
+ */
+enum MailboxBits
+{
+  MB_UNREAD,  ///< Email hasn't been read
+  MB_NEW,     ///< Email is unread and not old
+  MB_FLAGGED, ///< Email is flagged
+  MB_DELETED, ///< Email is marked for deletion
+  MB_TAGGED,  ///< Email is tagged
+  MB_VISIBLE, ///< Email has a virtual number, i.e. vnum >= 0
+  MB_MAX,
+};
+
 /**
  * ACL Rights - These show permission to...
  */
@@ -92,6 +108,7 @@ struct Mailbox
   int msg_new;                        ///< Number of new messages
   int msg_deleted;                    ///< Number of deleted messages
   int msg_tagged;                     ///< How many messages are tagged?
+  struct Bitset bits[MB_MAX];         ///< States of the Emails, by position in `emails`
 
   struct Email **emails;              ///< Array of Emails
   int email_max;                      ///< Size of `emails` array
@@ -188,16 +205,35 @@ struct EventMailbox
   struct Mailbox *mailbox; ///< The Mailbox this Event relates to
 };
 
+/**
+ * struct MailboxMemory - Memory used by a Mailbox
+ */
+struct MailboxMemory
+{
+  size_t emails;      ///< Emails and the arrays indexing them
+  size_t envelopes;   ///< Envelopes of the Emails
+  size_t bodies;      ///< MIME structure of the Emails
+  size_t hash_tables; ///< Message-ID, subject and label Hash Tables
+};
+
+void            mailbox_bits_count  (struct Mailbox *m);
+void            mailbox_bits_rebuild(struct Mailbox *m);
+void            mailbox_bits_resize (struct Mailbox *m);
+void            mailbox_bits_set    (struct Mailbox *m, const struct Email *e);
+bool            mailbox_bits_stale  (const struct Mailbox *m, enum MailboxBits bit);
 void            mailbox_changed   (struct Mailbox *m, enum NotifyMailbox action);
+void            mailbox_email_changed(struct Mailbox *m, struct Email *e);
 struct Mailbox *mailbox_find      (const char *path);
 struct Mailbox *mailbox_find_name (const char *name);
 void            mailbox_free      (struct Mailbox **ptr);
 int             mailbox_gen       (void);
+void            mailbox_mem_usage (const struct Mailbox *m, struct MailboxMemory *mm);
 struct Mailbox *mailbox_new       (void);
 bool            mailbox_set_subset(struct Mailbox *m, struct ConfigSubset *sub);
 void            mailbox_size_add  (struct Mailbox *m, const struct Email *e);
 void            mailbox_size_sub  (struct Mailbox *m, const struct Email *e);
 void            mailbox_update    (struct Mailbox *m);
+void            mailbox_vnum_set  (struct Mailbox *m, struct Email *e, int vnum);
 void            mailbox_gc_add    (struct Email *e);
 void            mailbox_gc_run    (void);
 
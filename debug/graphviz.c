@@ -1682,6 +1682,8 @@ void dot_pattern(FILE *fp, struct Pattern *pat, struct ListHead *links)
   ADD_BOOL(dynamic);
   ADD_BOOL(sendmode);
   ADD_BOOL(is_multi);
+  ADD_BOOL(literal);
+  ADD_BOOL(anchored);
 #undef ADD_BOOL
   dot_type_string(fp, "flags", buf_is_empty(buf) ? "[NONE]" : buf_string(buf), true);
 
@@ -1689,7 +1691,7 @@ void dot_pattern(FILE *fp, struct Pattern *pat, struct ListHead *links)
   {
     // struct Group *group;         ///< Address group if group_match is set
   }
-  else if (pat->string_match)
+  else if (pat->string_match || pat->literal)
   {
     dot_type_string(fp, "str", pat->p.str, true);
   }
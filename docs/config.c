@@ -1001,6 +1001,16 @@
 ** See also: \fC$$debug_file\fP
 */
 
+{ "debug_stats_file", DT_PATH, 0 },
+/*
+** .pp
+** NeoMutt keeps timers and counters for its busiest code, e.g. opening a
+** mailbox, sorting, or matching patterns.  If this is set, they'll be saved
+** to this file, as JSON, when NeoMutt exits.
+** .pp
+** The current values can be seen with the \fC:debug-stats\fP command.
+*/
+
 { "default_hook", DT_STRING, "~f %s !~P | (~P ~C %s)" },
 /*
 ** .pp
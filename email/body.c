@@ -32,18 +32,22 @@
 #include <unistd.h>
 #include "mutt/lib.h"
 #include "body.h"
+#include "content.h"
 #include "email.h"
 #include "envelope.h"
 #include "mime.h"
 #include "parameter.h"
 
+/// Allocator for Bodies
+static struct Slab BodySlab = SLAB_INIT(struct Body);
+
 /**
  * mutt_body_new - Create a new Body
  * @retval ptr Newly allocated Body
  */
 struct Body *mutt_body_new(void)
 {
-  struct Body *p = mutt_mem_calloc(1, sizeof(struct Body));
+  struct Body *p = slab_alloc(&BodySlab);
 
   p->disposition = DISP_ATTACH;
   p->use_disp = true;
@@ -94,12 +98,56 @@ void mutt_body_free(struct Body **ptr)
 
     mutt_env_free(&b->mime_headers);
     mutt_body_free(&b->parts);
-    FREE(&b);
+    slab_free(&BodySlab, b);
   }
 
   *ptr = NULL;
 }
 
+/**
+ * mutt_body_mem_size - Calculate the memory used by a list of Body's
+ * @param b First Body in the list
+ * @retval num Size in bytes
+ *
+ * All the parts are counted, including any attached Emails.
+ */
+size_t mutt_body_mem_size(const struct Body *b)
+{
+  size_t size = 0;
+
+  for (; b; b = b->next)
+  {
+    size += sizeof(*b);
+
+    const struct Parameter *param = NULL;
+    TAILQ_FOREACH(param, &b->parameter, entries)
+    {
+      size += sizeof(*param) + mutt_str_mem_size(param->attribute) +
+              mutt_str_mem_size(param->value);
+    }
+
+    size += mutt_str_mem_size(b->filename);
+    size += mutt_str_mem_size(b->d_filename);
+    size += mutt_str_mem_size(b->charset);
+    size += mutt_str_mem_size(b->xtype);
+    size += mutt_str_mem_size(b->subtype);
+    size += mutt_str_mem_size(b->language);
+    size += mutt_str_mem_size(b->description);
+    size += mutt_str_mem_size(b->form_name);
+    if (b->content)
+      size += sizeof(*b->content);
+
+    // The attached Email's Body is the same as our parts
+    if (b->email)
+      size += email_mem_size(b->email) + mutt_env_mem_size(b->email->env);
+
+    size += mutt_env_mem_size(b->mime_headers);
+    size += mutt_body_mem_size(b->parts);
+  }
+
+  return size;
+}
+
 /**
  * mutt_body_cmp_strict - Strictly compare two email Body's
  * @param b1 First Body
@@ -94,6 +94,7 @@ ARRAY_HEAD(BodyArray, struct Body *);
 bool         mutt_body_cmp_strict(const struct Body *b1, const struct Body *b2);
 void         mutt_body_free      (struct Body **ptr);
 char *       mutt_body_get_charset(struct Body *b, char *buf, size_t buflen);
+size_t       mutt_body_mem_size  (const struct Body *b);
 struct Body *mutt_body_new       (void);
 
 #endif /* MUTT_EMAIL_BODY_H */
@@ -39,6 +39,9 @@
 
 void nm_edata_free(void **ptr);
 
+/// Allocator for Emails
+static struct Slab EmailSlab = SLAB_INIT(struct Email);
+
 /**
  * email_free - Free an Email
  * @param[out] ptr Email to free
@@ -70,7 +73,8 @@ void email_free(struct Email **ptr)
   driver_tags_free(&e->tags);
   notify_free(&e->notify);
 
-  FREE(ptr);
+  slab_free(&EmailSlab, e);
+  *ptr = NULL;
 }
 
 /**
@@ -81,7 +85,7 @@ struct Email *email_new(void)
 {
   static size_t sequence = 0;
 
-  struct Email *e = mutt_mem_calloc(1, sizeof(struct Email));
+  struct Email *e = slab_alloc(&EmailSlab);
 #ifdef MIXMASTER
   STAILQ_INIT(&e->chain);
 #endif
@@ -131,6 +135,35 @@ size_t email_size(const struct Email *e)
   return e->body->length + e->body->offset - e->body->hdr_offset;
 }
 
+/**
+ * email_mem_size - Calculate the memory used by an Email
+ * @param e Email
+ * @retval num Size in bytes
+ *
+ * The Envelope, the Body and the backend's private data aren't counted.
+ */
+size_t email_mem_size(const struct Email *e)
+{
+  if (!e)
+    return 0;
+
+  size_t size = sizeof(*e);
+  size += mutt_str_mem_size(e->tree);
+  size += mutt_str_mem_size(e->path);
+#ifdef MIXMASTER
+  size += mutt_list_mem_size(&e->chain);
+#endif
+
+  const struct Tag *tag = NULL;
+  STAILQ_FOREACH(tag, &e->tags, entries)
+  {
+    size += sizeof(*tag) + mutt_str_mem_size(tag->name) +
+            mutt_str_mem_size(tag->transformed);
+  }
+
+  return size;
+}
+
 /**
  * header_find - Find a header, matching on its field, in a list of headers
  * @param hdrlist List of headers to search
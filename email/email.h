@@ -27,6 +27,7 @@
 
 #include "config.h"
 #include <stdbool.h>
+#include <stdint.h>
 #include <time.h>
 #include "mutt/lib.h"
 #include "ncrypt/lib.h"
@@ -65,6 +66,7 @@ struct Email
   // Management data - Runtime info and glue to hold the objects together
 
   size_t sequence;             ///< Sequence number assigned on creation
+  unsigned int generation;     ///< Incremented when the flags or Envelope change
   struct Envelope *env;        ///< Envelope information
   struct Body *body;           ///< List of MIME parts
   char *path;                  ///< Path of Email (for local Mailboxes)
@@ -113,6 +115,9 @@ struct Email
   int index;                   ///< The absolute (unsorted) message number
   int msgno;                   ///< Number displayed to the user
   const struct AttrColor *attr_color; ///< Color-pair to use when displaying in the index
+  uint64_t color_matches;      ///< Cached results of the `color index` rules, one bit per rule
+  unsigned int color_gen;      ///< Email::generation when the results were cached
+  unsigned char color_valid;   ///< Which cached results are valid, e.g. #MUTT_PAT_DEP_FLAGS
   int score;                   ///< Message score
   int vnum;                    ///< Virtual message number
   short attach_total;          ///< Number of qualifying attachments in message, if attach_valid
@@ -188,6 +193,7 @@ struct EventHeader
 
 bool          email_cmp_strict(const struct Email *e1, const struct Email *e2);
 void          email_free      (struct Email **ptr);
+size_t        email_mem_size  (const struct Email *e);
 struct Email *email_new       (void);
 size_t        email_size      (const struct Email *e);
 
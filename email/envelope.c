@@ -39,13 +39,16 @@
 #include "envelope.h"
 #include "email.h"
 
+/// Allocator for Envelopes
+static struct Slab EnvelopeSlab = SLAB_INIT(struct Envelope);
+
 /**
  * mutt_env_new - Create a new Envelope
  * @retval ptr New Envelope
  */
 struct Envelope *mutt_env_new(void)
 {
-  struct Envelope *env = mutt_mem_calloc(1, sizeof(struct Envelope));
+  struct Envelope *env = slab_alloc(&EnvelopeSlab);
   TAILQ_INIT(&env->return_path);
   TAILQ_INIT(&env->from);
   TAILQ_INIT(&env->to);
@@ -68,8 +71,11 @@ struct Envelope *mutt_env_new(void)
  */
 void mutt_env_set_subject(struct Envelope *env, const char *subj)
 {
-  mutt_str_replace((char **) &env->subject, subj);
-  *(char **) &env->real_subj = NULL;
+  /* subj may be the current subject, so intern it before releasing */
+  const char *interned = mutt_intern_get(subj);
+  mutt_intern_release((const char **) &env->subject);
+  *(const char **) &env->subject = interned;
+  *(const char **) &env->real_subj = NULL;
 
   if (env->subject)
   {
@@ -78,11 +84,11 @@ void mutt_env_set_subject(struct Envelope *env, const char *subj)
     if (mutt_regex_capture(c_reply_regex, env->subject, 1, &match))
     {
       if (env->subject[match.rm_eo] != '\0')
-        *(char **) &env->real_subj = env->subject + match.rm_eo;
+        *(const char **) &env->real_subj = env->subject + match.rm_eo;
     }
     else
     {
-      *(char **) &env->real_subj = env->subject;
+      *(const char **) &env->real_subj = env->subject;
     }
   }
 }
@@ -140,16 +146,16 @@ void mutt_env_free(struct Envelope **ptr)
   mutt_addrlist_clear(&env->mail_followup_to);
   mutt_addrlist_clear(&env->x_original_to);
 
-  FREE(&env->list_post);
-  FREE(&env->list_subscribe);
-  FREE(&env->list_unsubscribe);
-  FREE((char **) &env->subject);
+  mutt_intern_release(&env->list_post);
+  mutt_intern_release(&env->list_subscribe);
+  mutt_intern_release(&env->list_unsubscribe);
+  mutt_intern_release((const char **) &env->subject);
   /* real_subj is just an offset to subject and shouldn't be freed */
   FREE(&env->disp_subj);
   FREE(&env->message_id);
   FREE(&env->supersedes);
   FREE(&env->date);
-  FREE(&env->x_label);
+  mutt_intern_release(&env->x_label);
   FREE(&env->organization);
   FREE(&env->newsgroups);
   FREE(&env->xref);
@@ -167,7 +173,52 @@ void mutt_env_free(struct Envelope **ptr)
   mutt_autocrypthdr_free(&env->autocrypt_gossip);
 #endif
 
-  FREE(ptr);
+  slab_free(&EnvelopeSlab, env);
+  *ptr = NULL;
+}
+
+/**
+ * mutt_env_mem_size - Calculate the memory used by an Envelope
+ * @param env Envelope
+ * @retval num Size in bytes
+ *
+ * Interned strings, the X-Label, Subject and List URLs, are shared between
+ * Envelopes, so they aren't counted.  See mutt_intern_mem_size().
+ */
+size_t mutt_env_mem_size(const struct Envelope *env)
+{
+  if (!env)
+    return 0;
+
+  size_t size = sizeof(*env);
+
+  size += mutt_addrlist_mem_size(&env->return_path);
+  size += mutt_addrlist_mem_size(&env->from);
+  size += mutt_addrlist_mem_size(&env->to);
+  size += mutt_addrlist_mem_size(&env->cc);
+  size += mutt_addrlist_mem_size(&env->bcc);
+  size += mutt_addrlist_mem_size(&env->sender);
+  size += mutt_addrlist_mem_size(&env->reply_to);
+  size += mutt_addrlist_mem_size(&env->mail_followup_to);
+  size += mutt_addrlist_mem_size(&env->x_original_to);
+
+  size += mutt_str_mem_size(env->disp_subj);
+  size += mutt_str_mem_size(env->message_id);
+  size += mutt_str_mem_size(env->supersedes);
+  size += mutt_str_mem_size(env->date);
+  size += mutt_str_mem_size(env->organization);
+  size += mutt_str_mem_size(env->newsgroups);
+  size += mutt_str_mem_size(env->xref);
+  size += mutt_str_mem_size(env->followup_to);
+  size += mutt_str_mem_size(env->x_comment_to);
+
+  size += env->spam.dsize;
+
+  size += mutt_list_mem_size(&env->references);
+  size += mutt_list_mem_size(&env->in_reply_to);
+  size += mutt_list_mem_size(&env->userhdrs);
+
+  return size;
 }
 
 /**
@@ -178,6 +229,7 @@ void mutt_env_free(struct Envelope **ptr)
  */
 bool mutt_env_notify_send(struct Email *e, enum NotifyEnvelope type)
 {
+  e->generation++;
   struct EventEmail ev_e = { 1, &e };
   return notify_send(e->notify, NT_ENVELOPE, type, &ev_e);
 }
@@ -255,11 +307,11 @@ void mutt_env_merge(struct Envelope *base, struct Envelope **extra)
   /* real_subj is subordinate to subject */
   if (!base->subject)
   {
-    *(char **) &base->subject = (*extra)->subject;
-    *(char **) &base->real_subj = (*extra)->real_subj;
+    *(const char **) &base->subject = (*extra)->subject;
+    *(const char **) &base->real_subj = (*extra)->real_subj;
     base->disp_subj = (*extra)->disp_subj;
-    *(char **) &(*extra)->subject = NULL;
-    *(char **) &(*extra)->real_subj = NULL;
+    *(const char **) &(*extra)->subject = NULL;
+    *(const char **) &(*extra)->real_subj = NULL;
     (*extra)->disp_subj = NULL;
   }
   /* spam and user headers should never be hashed, and the new envelope may
@@ -64,16 +64,16 @@ struct Envelope
   struct AddressList reply_to;         ///< Email's 'reply-to'
   struct AddressList mail_followup_to; ///< Email's 'mail-followup-to'
   struct AddressList x_original_to;    ///< Email's 'X-Orig-to'
-  char *list_post;                     ///< This stores a mailto URL, or nothing
-  char *list_subscribe;                ///< This stores a mailto URL, or nothing
-  char *list_unsubscribe;              ///< This stores a mailto URL, or nothing
-  char *const subject;                 ///< Email's subject
-  char *const real_subj;               ///< Offset of the real subject
+  const char *list_post;               ///< This stores a mailto URL, or nothing (interned)
+  const char *list_subscribe;          ///< This stores a mailto URL, or nothing (interned)
+  const char *list_unsubscribe;        ///< This stores a mailto URL, or nothing (interned)
+  const char *const subject;           ///< Email's subject (interned)
+  const char *const real_subj;         ///< Offset of the real subject
   char *disp_subj;                     ///< Display subject (modified copy of subject)
   char *message_id;                    ///< Message ID
   char *supersedes;                    ///< Supersedes header
   char *date;                          ///< Sent date
-  char *x_label;                       ///< X-Label
+  const char *x_label;                 ///< X-Label (interned, see mutt_intern_get())
   char *organization;                  ///< Organisation header
   char *newsgroups;                    ///< List of newsgroups
   char *xref;                          ///< List of cross-references
@@ -115,6 +115,7 @@ enum NotifyEnvelope
 
 bool             mutt_env_cmp_strict (const struct Envelope *e1, const struct Envelope *e2);
 void             mutt_env_free       (struct Envelope **ptr);
+size_t           mutt_env_mem_size   (const struct Envelope *env);
 void             mutt_env_merge      (struct Envelope *base, struct Envelope **extra);
 struct Envelope *mutt_env_new        (void);
 bool             mutt_env_notify_send(struct Email *e, enum NotifyEnvelope type);
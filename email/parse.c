@@ -61,6 +61,9 @@
  * Cap the value to prevent overflow of Body.length */
 #define CONTENT_TOO_BIG (1 << 30)
 
+/// Time spent reading headers
+static struct StatsEntry StatsReadHeader = STATS_ENTRY("mutt_rfc822_read_header");
+
 static void parse_part(FILE *fp, struct Body *b, int *counter);
 static struct Body *rfc822_parse_message(FILE *fp, struct Body *parent, int *counter);
 static struct Body *parse_multipart(FILE *fp, const char *boundary,
@@ -820,8 +823,9 @@ int mutt_rfc822_parse_line(struct Envelope *env, struct Email *e,
           char *mailto = rfc2369_first_mailto(body);
           if (mailto)
           {
-            FREE(&env->list_post);
-            env->list_post = mailto;
+            mutt_intern_release(&env->list_post);
+            env->list_post = mutt_intern_get(mailto);
+            FREE(&mailto);
             const bool c_auto_subscribe = cs_subset_bool(NeoMutt->sub, "auto_subscribe");
             if (c_auto_subscribe)
               mutt_auto_subscribe(env->list_post);
@@ -835,8 +839,9 @@ int mutt_rfc822_parse_line(struct Envelope *env, struct Email *e,
         char *mailto = rfc2369_first_mailto(body);
         if (mailto)
         {
-          FREE(&env->list_subscribe);
-          env->list_subscribe = mailto;
+          mutt_intern_release(&env->list_subscribe);
+          env->list_subscribe = mutt_intern_get(mailto);
+          FREE(&mailto);
         }
         matched = true;
       }
@@ -846,8 +851,9 @@ int mutt_rfc822_parse_line(struct Envelope *env, struct Email *e,
         char *mailto = rfc2369_first_mailto(body);
         if (mailto)
         {
-          FREE(&env->list_unsubscribe);
-          env->list_unsubscribe = mailto;
+          mutt_intern_release(&env->list_unsubscribe);
+          env->list_unsubscribe = mutt_intern_get(mailto);
+          FREE(&mailto);
         }
         matched = true;
       }
@@ -1018,8 +1024,8 @@ int mutt_rfc822_parse_line(struct Envelope *env, struct Email *e,
       }
       else if ((name_len == 7) && eqi6(name + 1, "-label"))
       {
-        FREE(&env->x_label);
-        env->x_label = mutt_str_dup(body);
+        mutt_intern_release(&env->x_label);
+        env->x_label = mutt_intern_get(body);
         matched = true;
       }
       else if ((name_len == 12) && eqi11(name + 1, "-comment-to"))
@@ -1084,13 +1090,17 @@ size_t mutt_rfc822_read_line(FILE *fp, struct Buffer *buf)
     return 0;
 
   size_t read = 0;
-  char line[1024] = { 0 }; /* RFC2822 specifies a maximum line length of 998 */
 
   buf_reset(buf);
   while (true)
   {
-    if (!fgets(line, sizeof(line), fp))
+    /* Read straight into the Buffer.
+     * RFC2822 specifies a maximum line length of 998 */
+    buf_alloc(buf, buf_len(buf) + 1024);
+    char *line = buf->dptr;
+    if (!fgets(line, buf->dsize - buf_len(buf), fp))
     {
+      *line = '\0';
       return 0;
     }
 
@@ -1100,8 +1110,9 @@ size_t mutt_rfc822_read_line(FILE *fp, struct Buffer *buf)
       break;
     }
 
-    if (isspace(line[0]) && buf_is_empty(buf))
+    if (isspace(line[0]) && (line == buf->data))
     {
+      *line = '\0';
       read = linelen;
       break;
     }
@@ -1123,7 +1134,7 @@ size_t mutt_rfc822_read_line(FILE *fp, struct Buffer *buf)
       {
         /* next line is a separate header field or EOH */
         ungetc(ch, fp);
-        buf_addstr(buf, line);
+        buf->dptr += mutt_str_len(line);
         break;
       }
       read++;
@@ -1139,12 +1150,132 @@ size_t mutt_rfc822_read_line(FILE *fp, struct Buffer *buf)
                               at least one whitespace char above */
     }
 
-    buf_addstr(buf, line);
+    buf->dptr += mutt_str_len(line);
   }
 
   return read;
 }
 
+/**
+ * mutt_rfc822_read_field - Read a header field from memory
+ * @param[in]  span Text of the header
+ * @param[in]  len  Length of the text
+ * @param[out] buf  Buffer for the unfolded field
+ * @retval num Number of bytes of span used
+ *
+ * This is the in-memory equivalent of mutt_rfc822_read_line().  The ends of
+ * the lines are found with memchr(), which libc vectorises.
+ *
+ * Trailing whitespace is removed from each line and the continuation lines are
+ * joined with a single space.  A line that starts with whitespace, such as the
+ * blank line that ends the header, gives an empty field.
+ */
+size_t mutt_rfc822_read_field(const char *span, size_t len, struct Buffer *buf)
+{
+  if (!buf)
+    return 0;
+
+  buf_reset(buf);
+  if (!span)
+    return 0;
+
+  size_t pos = 0;
+  while (pos < len)
+  {
+    const char *line = span + pos;
+    const char *nl = memchr(line, '\n', len - pos);
+    const size_t linelen = nl ? (nl - line + 1) : (len - pos);
+
+    if ((pos == 0) && isspace(line[0]))
+      return linelen;
+
+    pos += linelen;
+    if (!nl)
+    {
+      buf_addstr_n(buf, line, linelen);
+      break;
+    }
+
+    /* remove trailing space */
+    size_t end = linelen - 1;
+    while ((end > 0) && isspace(line[end - 1]))
+      end--;
+    buf_addstr_n(buf, line, end);
+
+    /* check to see if the next line is a continuation line */
+    if ((pos == len) || ((span[pos] != ' ') && (span[pos] != '\t')))
+      break;
+
+    /* eat tabs and spaces from the beginning of the continuation line */
+    while ((pos < len) && ((span[pos] == ' ') || (span[pos] == '\t')))
+      pos++;
+
+    if (end > 0)
+      buf_addch(buf, ' ');
+  }
+
+  return pos;
+}
+
+/**
+ * read_header_lines - Read the lines of a header from a file
+ * @param fp  File to read from
+ * @param buf Buffer for the lines
+ *
+ * Read up to, and including, the line that ends the header: a blank line, a
+ * line that starts with whitespace, or a line that isn't a header field.
+ * The caller will seek back to the start of a line that isn't a header field.
+ */
+static void read_header_lines(FILE *fp, struct Buffer *buf)
+{
+  bool line_start = true;
+
+  buf_reset(buf);
+  while (true)
+  {
+    /* Read straight into the Buffer.
+     * RFC2822 specifies a maximum line length of 998 */
+    buf_alloc(buf, buf_len(buf) + 1024);
+    char *line = buf->dptr;
+    if (!fgets(line, buf->dsize - buf_len(buf), fp))
+    {
+      *line = '\0';
+      break;
+    }
+
+    const size_t linelen = mutt_str_len(line);
+    if (linelen == 0)
+      break;
+
+    buf->dptr += linelen;
+
+    /* Only look at the start of each line, not at the rest of a long one */
+    const bool first = line_start;
+    line_start = (line[linelen - 1] == '\n');
+    if (!first)
+      continue;
+
+    if ((line[0] == ' ') || (line[0] == '\t'))
+    {
+      /* a continuation line, unless it's at the start of the header */
+      if (line == buf->data)
+        break;
+      continue;
+    }
+
+    if (isspace(line[0]))
+      break; /* end of header */
+
+    /* some bogus MTAs will quote the original "From " line */
+    if (mutt_str_startswith(line, ">From ") || mutt_str_startswith(line, "From "))
+      continue;
+
+    const char *p = strpbrk(line, ": \t");
+    if (p ? (*p != ':') : line_start)
+      break; /* not a header field */
+  }
+}
+
 /**
  * mutt_rfc822_read_header - Parses an RFC822 header
  * @param fp        Stream to read from
@@ -1163,6 +1294,7 @@ struct Envelope *mutt_rfc822_read_header(FILE *fp, struct Email *e, bool user_hd
   if (!fp)
     return NULL;
 
+  const uint64_t start = stats_timer_start();
   struct Envelope *env = mutt_env_new();
   char *p = NULL;
   LOFF_T loc = e ? e->offset : ftello(fp);
@@ -1172,6 +1304,7 @@ struct Envelope *mutt_rfc822_read_header(FILE *fp, struct Email *e, bool user_hd
     loc = 0;
   }
 
+  struct Buffer *lines_buf = buf_pool_get();
   struct Buffer *line = buf_pool_get();
 
   if (e)
@@ -1191,15 +1324,20 @@ struct Envelope *mutt_rfc822_read_header(FILE *fp, struct Email *e, bool user_hd
     }
   }
 
+  /* Read the whole header, then split it into fields in memory */
+  read_header_lines(fp, lines_buf);
+  const char *span = buf_string(lines_buf);
+  const size_t span_len = buf_len(lines_buf);
+  size_t pos = 0;
+
   while (true)
   {
-    LOFF_T line_start_loc = loc;
-    size_t len = mutt_rfc822_read_line(fp, line);
+    const size_t field_start = pos;
+    pos += mutt_rfc822_read_field(span + pos, span_len - pos, line);
     if (buf_is_empty(line))
     {
       break;
     }
-    loc += len;
     const char *lines = buf_string(line);
     p = strpbrk(lines, ": \t");
     if (!p || (*p != ':'))
@@ -1223,12 +1361,12 @@ struct Envelope *mutt_rfc822_read_header(FILE *fp, struct Email *e, bool user_hd
       /* We need to seek back to the start of the body. Note that we
        * keep track of loc ourselves, since calling ftello() incurs
        * a syscall, which can be expensive to do for every single line */
-      (void) mutt_file_seek(fp, line_start_loc, SEEK_SET);
+      (void) mutt_file_seek(fp, loc + field_start, SEEK_SET);
       break; /* end of header */
     }
     size_t name_len = p - lines;
 
-    char buf[1024] = { 0 };
+    char buf[1024]; // mutt_replacelist_match() terminates the string
     if (mutt_replacelist_match(&SpamList, buf, sizeof(buf), lines))
     {
       if (!mutt_regexlist_match(&NoSpamList, lines))
@@ -1274,6 +1412,7 @@ struct Envelope *mutt_rfc822_read_header(FILE *fp, struct Email *e, bool user_hd
   }
 
   buf_pool_release(&line);
+  buf_pool_release(&lines_buf);
 
   if (e)
   {
@@ -1306,6 +1445,7 @@ struct Envelope *mutt_rfc822_read_header(FILE *fp, struct Email *e, bool user_hd
 #endif
   }
 
+  stats_timer_stop(&StatsReadHeader, start);
   return env;
 }
 
@@ -135,9 +135,20 @@ static size_t q_encoder(char *res, const char *src, size_t srclen, const char *t
   return res - s0;
 }
 
+/**
+ * is_charset_char - Can this character be part of an RFC2047 charset name?
+ * @param ch Character to test
+ * @retval true Character is allowed
+ */
+static bool is_charset_char(char ch)
+{
+  return (ch != '\0') && !strchr("[]()<>@,;:\\\"/?. =", ch);
+}
+
 /**
  * parse_encoded_word - Parse a string and report RFC2047 elements
  * @param[in]  str        String to parse
+ * @param[in]  len        Length of the string
  * @param[out] enc        Content encoding found in the first RFC2047 word
  * @param[out] charset    Charset found in the first RFC2047 word
  * @param[out] charsetlen Length of the charset string found
@@ -145,29 +156,51 @@ static size_t q_encoder(char *res, const char *src, size_t srclen, const char *t
  * @param[out] textlen    Length of the encoded text found
  * @retval ptr Start of the RFC2047 encoded word
  * @retval NULL None was found
+ *
+ * An encoded word looks like: `=?charset?encoding?text?=`.
+ * The text may contain whitespace, see #1189.
  */
-static char *parse_encoded_word(char *str, enum ContentEncoding *enc, char **charset,
-                                size_t *charsetlen, char **text, size_t *textlen)
+static const char *parse_encoded_word(const char *str, size_t len, enum ContentEncoding *enc,
+                                      const char **charset, size_t *charsetlen,
+                                      const char **text, size_t *textlen)
 {
-  regmatch_t *match = mutt_prex_capture(PREX_RFC2047_ENCODED_WORD, str);
-  if (!match)
-    return NULL;
+  const char *end = str + len;
+
+  for (const char *p = memchr(str, '=', len); p; p = memchr(p + 1, '=', end - p - 1))
+  {
+    if (p[1] != '?')
+      continue;
+
+    /* Charset */
+    const char *cs = p + 2;
+    const char *q = cs;
+    while (is_charset_char(*q))
+      q++;
+    if ((q == cs) || (q[0] != '?'))
+      continue;
 
-  const regmatch_t *mfull = &match[PREX_RFC2047_ENCODED_WORD_MATCH_FULL];
-  const regmatch_t *mcharset = &match[PREX_RFC2047_ENCODED_WORD_MATCH_CHARSET];
-  const regmatch_t *mencoding = &match[PREX_RFC2047_ENCODED_WORD_MATCH_ENCODING];
-  const regmatch_t *mtext = &match[PREX_RFC2047_ENCODED_WORD_MATCH_TEXT];
+    /* Encoding: either Q or B */
+    const char e = tolower((unsigned char) q[1]);
+    if (((e != 'q') && (e != 'b')) || (q[2] != '?'))
+      continue;
 
-  /* Charset */
-  *charset = str + mutt_regmatch_start(mcharset);
-  *charsetlen = mutt_regmatch_len(mcharset);
+    /* Text */
+    const char *t = q + 3;
+    const char *t_end = t;
+    while ((*t_end != '\0') && (*t_end != '?'))
+      t_end++;
+    if ((t_end == t) || (t_end[0] != '?') || (t_end[1] != '='))
+      continue;
 
-  /* Encoding: either Q or B */
-  *enc = (tolower(str[mutt_regmatch_start(mencoding)]) == 'q') ? ENC_QUOTED_PRINTABLE : ENC_BASE64;
+    *charset = cs;
+    *charsetlen = q - cs;
+    *enc = (e == 'q') ? ENC_QUOTED_PRINTABLE : ENC_BASE64;
+    *text = t;
+    *textlen = t_end - t;
+    return p;
+  }
 
-  *text = str + mutt_regmatch_start(mtext);
-  *textlen = mutt_regmatch_len(mtext);
-  return str + mutt_regmatch_start(mfull);
+  return NULL;
 }
 
 /**
@@ -332,83 +365,83 @@ static size_t choose_block(char *d, size_t dlen, int col, const char *fromcode,
 
 /**
  * finalize_chunk - Perform charset conversion and filtering
- * @param[out] res        Buffer where the resulting string is appended
- * @param[in]  buf        Buffer with the input string
- * @param[in]  charset    Charset to use for the conversion
- * @param[in]  charsetlen Length of the charset parameter
+ * @param[out] res     Buffer where the resulting string is appended
+ * @param[in]  buf     Buffer with the input string
+ * @param[in]  charset Charset to use for the conversion
  *
- * The buffer buf is reinitialized at the end of this function.
+ * The buffer buf is reset at the end of this function.
  */
-static void finalize_chunk(struct Buffer *res, struct Buffer *buf, char *charset, size_t charsetlen)
+static void finalize_chunk(struct Buffer *res, struct Buffer *buf, const char *charset)
 {
-  if (!charset)
+  if (buf_is_empty(buf))
     return;
-  char end = charset[charsetlen];
-  charset[charsetlen] = '\0';
-  mutt_ch_convert_string(&buf->data, charset, cc_charset(), MUTT_ICONV_HOOK_FROM);
-  charset[charsetlen] = end;
-  mutt_mb_filter_unprintable(&buf->data);
-  buf_addstr(res, buf->data);
-  FREE(&buf->data);
-  buf_init(buf);
+
+  char *str = buf_strdup(buf);
+  mutt_ch_convert_string(&str, charset, cc_charset(), MUTT_ICONV_HOOK_FROM);
+  mutt_mb_filter_unprintable(&str);
+  buf_addstr(res, str);
+  FREE(&str);
+  buf_reset(buf);
 }
 
 /**
  * decode_word - Decode an RFC2047-encoded string
- * @param s   String to decode
- * @param len Length of the string
- * @param enc Encoding type
- * @retval ptr Decoded string
+ * @param[out] buf Buffer for the decoded string
+ * @param[in]  s   String to decode
+ * @param[in]  len Length of the string
+ * @param[in]  enc Encoding type
+ * @retval true Success
  *
- * @note The input string must be null-terminated; the len parameter is
- *       an optimization. The caller must free the returned string.
+ * @note The decoded string ends at its first NUL character, if any.
  */
-static char *decode_word(const char *s, size_t len, enum ContentEncoding enc)
+static bool decode_word(struct Buffer *buf, const char *s, size_t len, enum ContentEncoding enc)
 {
   const char *it = s;
   const char *end = s + len;
 
-  assert(*end == '\0');
-
+  buf_reset(buf);
   if (enc == ENC_QUOTED_PRINTABLE)
   {
-    struct Buffer buf = buf_make(0);
     for (; it < end; it++)
     {
-      if (*it == '_')
+      char ch = *it;
+      if (ch == '_')
       {
-        buf_addch(&buf, ' ');
+        ch = ' ';
       }
-      else if ((it[0] == '=') && (!(it[1] & ~127) && (hexval(it[1]) != -1)) &&
+      else if (((end - it) > 2) && (it[0] == '=') &&
+               (!(it[1] & ~127) && (hexval(it[1]) != -1)) &&
                (!(it[2] & ~127) && (hexval(it[2]) != -1)))
       {
-        buf_addch(&buf, (hexval(it[1]) << 4) | hexval(it[2]));
+        ch = (hexval(it[1]) << 4) | hexval(it[2]);
         it += 2;
       }
-      else
-      {
-        buf_addch(&buf, *it);
-      }
+
+      if (ch == '\0')
+        break;
+      buf_addch(buf, ch);
     }
-    buf_addch(&buf, '\0');
-    return buf.data;
+    return true;
   }
   else if (enc == ENC_BASE64)
   {
+    /* mutt_b64_decode() needs a terminated string */
+    struct Buffer *in = buf_pool_get();
+    buf_strcpy_n(in, s, len);
     const int olen = 3 * len / 4 + 1;
-    char *out = mutt_mem_malloc(olen);
-    int dlen = mutt_b64_decode(it, out, olen);
+    buf_alloc(buf, olen + 1);
+    const int dlen = mutt_b64_decode(buf_string(in), buf->data, olen);
+    buf_pool_release(&in);
     if (dlen == -1)
-    {
-      FREE(&out);
-      return NULL;
-    }
-    out[dlen] = '\0';
-    return out;
+      return false;
+
+    buf->data[dlen] = '\0';
+    buf_fix_dptr(buf);
+    return true;
   }
 
   assert(0); /* The enc parameter has an invalid value */
-  return NULL;
+  return false;
 }
 
 /**
@@ -651,106 +684,146 @@ void rfc2047_encode(char **pd, const char *specials, int col, const struct Slist
 }
 
 /**
- * rfc2047_decode - Decode any RFC2047-encoded header fields
- * @param[in,out] pd  String to be decoded, and resulting decoded string
+ * rfc2047_decode_buf - Decode any RFC2047-encoded header fields into a Buffer
+ * @param[in]  str String to be decoded
+ * @param[out] buf Buffer for the decoded string
+ * @retval true  Success
+ * @retval false Decoding failed, e.g. invalid base64
  *
  * Try to decode anything that looks like a valid RFC2047 encoded header field,
- * ignoring RFC822 parsing rules. If decoding fails, for example due to an
- * invalid base64 string, the original input is left untouched.
+ * ignoring RFC822 parsing rules.
+ *
+ * Adjacent encoded words in the same charset are converted together, in case
+ * a multibyte character is split between them.
+ * See https://github.com/neomutt/neomutt/issues/1015
  */
-void rfc2047_decode(char **pd)
+bool rfc2047_decode_buf(const char *str, struct Buffer *buf)
 {
-  if (!pd || !*pd)
-    return;
+  if (!str || !buf)
+    return false;
+
+  buf_reset(buf);
+
+  const struct Slist *c_assumed_charset = cc_assumed_charset();
+  size_t len = strlen(str);
+  const char *beg = (len > 1) ? strstr(str, "=?") : NULL;
+
+  /* Nothing to decode */
+  if (!beg && slist_is_empty(c_assumed_charset))
+  {
+    buf_addstr_n(buf, str, len);
+    return true;
+  }
 
-  struct Buffer buf = buf_make(0);      // Output buffer
-  char *s = *pd;                        // Read pointer
-  char *beg = NULL;                     // Begin of encoded word
+  const char *s = str;                  // Read pointer
   enum ContentEncoding enc = ENC_OTHER; // ENC_BASE64 or ENC_QUOTED_PRINTABLE
-  char *charset = NULL;                 // Which charset
-  size_t charsetlen;                    // Length of the charset
-  char *text = NULL;                    // Encoded text
+  const char *charset = NULL;           // Which charset
+  size_t charsetlen = 0;                // Length of the charset
+  const char *text = NULL;              // Encoded text
   size_t textlen = 0;                   // Length of encoded text
+  bool rc = true;
 
-  /* Keep some state in case the next decoded word is using the same charset
-   * and it happens to be split in the middle of a multibyte character.
-   * See https://github.com/neomutt/neomutt/issues/1015 */
-  struct Buffer prev = buf_make(0); /* Previously decoded word  */
-  char *prev_charset = NULL;        /* Previously used charset                */
-  size_t prev_charsetlen = 0;       /* Length of the previously used charset  */
+  /* Decoded words waiting to be converted from prev_charset */
+  struct Buffer *prev = buf_pool_get();
+  struct Buffer *prev_charset = buf_pool_get();
+  struct Buffer *word = buf_pool_get();
 
-  const struct Slist *c_assumed_charset = cc_assumed_charset();
   const char *c_charset = cc_charset();
   while (*s)
   {
-    beg = parse_encoded_word(s, &enc, &charset, &charsetlen, &text, &textlen);
+    beg = parse_encoded_word(s, len, &enc, &charset, &charsetlen, &text, &textlen);
     if (beg != s)
     {
       /* Some non-encoded text was found */
-      size_t holelen = beg ? beg - s : mutt_str_len(s);
+      size_t holelen = beg ? beg - s : len;
 
       /* Ignore whitespace between encoded words */
       if (beg && (mutt_str_lws_len(s, holelen) == holelen))
       {
+        len -= holelen;
         s = beg;
         continue;
       }
 
       /* If we have some previously decoded text, add it now */
-      if (!buf_is_empty(&prev))
-      {
-        finalize_chunk(&buf, &prev, prev_charset, prev_charsetlen);
-      }
+      finalize_chunk(buf, prev, buf_string(prev_charset));
 
       /* Add non-encoded part */
       if (slist_is_empty(c_assumed_charset))
       {
-        buf_addstr_n(&buf, s, holelen);
+        buf_addstr_n(buf, s, holelen);
       }
       else
       {
         char *conv = mutt_strn_dup(s, holelen);
         mutt_ch_convert_nonmime_string(c_assumed_charset, c_charset, &conv);
-        buf_addstr(&buf, conv);
+        buf_addstr(buf, conv);
         FREE(&conv);
       }
       s += holelen;
+      len -= holelen;
     }
     if (beg)
     {
       /* Some encoded text was found */
-      text[textlen] = '\0';
-      char *decoded = decode_word(text, textlen, enc);
-      if (!decoded)
+      if (!decode_word(word, text, textlen, enc))
       {
-        buf_dealloc(&buf);
-        return;
+        rc = false;
+        break;
       }
-      if (prev.data && ((prev_charsetlen != charsetlen) ||
-                        !mutt_strn_equal(prev_charset, charset, charsetlen)))
+      if ((buf_len(prev_charset) != charsetlen) ||
+          !mutt_strn_equal(buf_string(prev_charset), charset, charsetlen))
       {
         /* Different charset, convert the previous chunk and add it to the
          * final result */
-        finalize_chunk(&buf, &prev, prev_charset, prev_charsetlen);
+        finalize_chunk(buf, prev, buf_string(prev_charset));
+        buf_strcpy_n(prev_charset, charset, charsetlen);
       }
 
-      buf_addstr(&prev, decoded);
-      FREE(&decoded);
-      prev_charset = charset;
-      prev_charsetlen = charsetlen;
-      s = text + textlen + 2; /* Skip final ?= */
+      buf_addstr(prev, buf_string(word));
+      const char *next = text + textlen + 2; /* Skip final ?= */
+      len -= next - s;
+      s = next;
     }
   }
 
   /* Save the last chunk */
-  if (prev.data)
+  if (rc)
+    finalize_chunk(buf, prev, buf_string(prev_charset));
+
+  buf_pool_release(&prev);
+  buf_pool_release(&prev_charset);
+  buf_pool_release(&word);
+  return rc;
+}
+
+/**
+ * rfc2047_decode - Decode any RFC2047-encoded header fields
+ * @param[in,out] pd  String to be decoded, and resulting decoded string
+ *
+ * Try to decode anything that looks like a valid RFC2047 encoded header field,
+ * ignoring RFC822 parsing rules. If decoding fails, for example due to an
+ * invalid base64 string, the original input is left untouched.
+ */
+void rfc2047_decode(char **pd)
+{
+  if (!pd || !*pd)
+    return;
+
+  /* Nothing to decode */
+  if (!strstr(*pd, "=?") && slist_is_empty(cc_assumed_charset()))
+    return;
+
+  struct Buffer *buf = buf_pool_get();
+  if (rfc2047_decode_buf(*pd, buf))
   {
-    finalize_chunk(&buf, &prev, prev_charset, prev_charsetlen);
+    /* The decoded string is usually shorter */
+    const size_t len = buf_len(buf);
+    if (len > strlen(*pd))
+      mutt_mem_realloc(pd, len + 1);
+    memcpy(*pd, buf_string(buf), len + 1);
   }
-
-  buf_addch(&buf, '\0');
-  FREE(pd);
-  *pd = buf.data;
+  buf_pool_release(&buf);
 }
 
 /**
@@ -792,9 +865,6 @@ void rfc2047_encode_addrlist(struct AddressList *al, const char *tag)
 /**
  * rfc2047_decode_addrlist - Decode any RFC2047 headers in an Address list
  * @param al AddressList
- *
- * @note rfc2047_decode() may realloc the data pointer it's given,
- *       so work on a copy to avoid breaking the Buffer
  */
 void rfc2047_decode_addrlist(struct AddressList *al)
 {
@@ -802,25 +872,22 @@ void rfc2047_decode_addrlist(struct AddressList *al)
     return;
 
   const bool assumed = !slist_is_empty(cc_assumed_charset());
+  struct Buffer *buf = buf_pool_get();
   struct Address *a = NULL;
-  char *data = NULL;
   TAILQ_FOREACH(a, al, entries)
   {
     if (a->personal && ((buf_find_string(a->personal, "=?")) || assumed))
     {
-      data = buf_strdup(a->personal);
-      rfc2047_decode(&data);
-      buf_strcpy(a->personal, data);
-      FREE(&data);
+      if (rfc2047_decode_buf(buf_string(a->personal), buf))
+        buf_copy(a->personal, buf);
     }
     else if (a->group && a->mailbox && buf_find_string(a->mailbox, "=?"))
     {
-      data = buf_strdup(a->mailbox);
-      rfc2047_decode(&data);
-      buf_strcpy(a->mailbox, data);
-      FREE(&data);
+      if (rfc2047_decode_buf(buf_string(a->mailbox), buf))
+        buf_copy(a->mailbox, buf);
     }
   }
+  buf_pool_release(&buf);
 }
 
 /**
@@ -839,10 +906,17 @@ void rfc2047_decode_envelope(struct Envelope *env)
   rfc2047_decode_addrlist(&env->mail_followup_to);
   rfc2047_decode_addrlist(&env->return_path);
   rfc2047_decode_addrlist(&env->sender);
-  rfc2047_decode(&env->x_label);
 
-  char *subj = env->subject;
-  *(char **) &env->subject = NULL;
+  if (env->x_label)
+  {
+    char *label = mutt_str_dup(env->x_label);
+    rfc2047_decode(&label);
+    mutt_intern_release(&env->x_label);
+    env->x_label = mutt_intern_get(label);
+    FREE(&label);
+  }
+
+  char *subj = mutt_str_dup(env->subject);
   rfc2047_decode(&subj);
   mutt_env_set_subject(env, subj);
   FREE(&subj);
@@ -864,10 +938,17 @@ void rfc2047_encode_envelope(struct Envelope *env)
   rfc2047_encode_addrlist(&env->mail_followup_to, "Mail-Followup-To");
   rfc2047_encode_addrlist(&env->sender, "Sender");
   const struct Slist *const c_send_charset = cs_subset_slist(NeoMutt->sub, "send_charset");
-  rfc2047_encode(&env->x_label, NULL, sizeof("X-Label:"), c_send_charset);
 
-  char *subj = env->subject;
-  *(char **) &env->subject = NULL;
+  if (env->x_label)
+  {
+    char *label = mutt_str_dup(env->x_label);
+    rfc2047_encode(&label, NULL, sizeof("X-Label:"), c_send_charset);
+    mutt_intern_release(&env->x_label);
+    env->x_label = mutt_intern_get(label);
+    FREE(&label);
+  }
+
+  char *subj = mutt_str_dup(env->subject);
   rfc2047_encode(&subj, NULL, sizeof("Subject:"), c_send_charset);
   mutt_env_set_subject(env, subj);
   FREE(&subj);
@@ -24,11 +24,15 @@
 #ifndef MUTT_EMAIL_RFC2047_H
 #define MUTT_EMAIL_RFC2047_H
 
+#include <stdbool.h>
+
 struct AddressList;
+struct Buffer;
 struct Envelope;
 struct Slist;
 
 void rfc2047_decode(char **pd);
+bool rfc2047_decode_buf(const char *str, struct Buffer *buf);
 void rfc2047_encode(char **pd, const char *specials, int col, const struct Slist *charsets);
 
 void rfc2047_decode_addrlist(struct AddressList *al);
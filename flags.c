@@ -336,6 +336,9 @@ void mutt_set_flag(struct Mailbox *m, struct Email *e, enum MessageType flag,
 
   if (update)
   {
+    mailbox_bits_set(m, e);
+    e->generation++;
+    mutt_reset_header_color(e, MUTT_PAT_DEP_FLAGS);
     mutt_set_header_color(m, e);
     struct EventMailbox ev_m = { m };
     notify_send(m->notify, NT_MAILBOX, NT_MAILBOX_CHANGE, &ev_m);
@@ -364,12 +367,18 @@ void mutt_emails_set_flag(struct Mailbox *m, struct EmailArray *ea,
   if (!m || !ea || ARRAY_EMPTY(ea))
     return;
 
+  // Send one notification, not one per Email
+  notify_batch_begin(m->notify, NT_MAILBOX, NT_MAILBOX_CHANGE);
+
   struct Email **ep = NULL;
   ARRAY_FOREACH(ep, ea)
   {
     struct Email *e = *ep;
     mutt_set_flag(m, e, flag, bf, true);
   }
+
+  struct EventMailbox ev_m = { m };
+  notify_batch_end(m->notify, &ev_m);
 }
 
 /**
@@ -400,6 +409,9 @@ int mutt_thread_set_flag(struct Mailbox *m, struct Email *e,
 
   start = cur;
 
+  // Send one notification, not one per Email
+  notify_batch_begin(m->notify, NT_MAILBOX, NT_MAILBOX_CHANGE);
+
   if (cur->message && (cur != e->thread))
     mutt_set_flag(m, cur->message, flag, bf, true);
 
@@ -435,6 +447,9 @@ done:
   cur = e->thread;
   if (cur->message)
     mutt_set_flag(m, cur->message, flag, bf, true);
+
+  struct EventMailbox ev_m = { m };
+  notify_batch_end(m->notify, &ev_m);
   return 0;
 }
 
@@ -465,8 +465,20 @@ size_t mutt_strnwidth(const char *s, size_t n)
   size_t k;
   mbstate_t mbstate = { 0 };
 
-  for (w = 0; n && (k = mbrtowc(&wc, s, n, &mbstate)); s += k, n -= k)
+  for (w = 0; n; s += k, n -= k)
   {
+    /* Printable ASCII is one cell wide, so skip the costly wide char calls */
+    if (CharsetIsUtf8 && ((unsigned char) *s >= 0x20) && ((unsigned char) *s < 0x7f))
+    {
+      k = 1;
+      w++;
+      continue;
+    }
+
+    k = mbrtowc(&wc, s, n, &mbstate);
+    if (k == 0)
+      break;
+
     if (*s == MUTT_SPECIAL_INDEX)
     {
       s += 2; /* skip the index coloring sequence */
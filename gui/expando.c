@@ -0,0 +1,972 @@
+/**
+ * @file
+ * Expand expandos (%x) in a format string
+ *
+ * @authors
+ * Copyright (C) 1996-2000,2007,2010,2013 Michael R. Elkins <me@mutt.org>
+ * Copyright (C) 2016-2023 Richard Russon <rich@flatcap.org>
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @page gui_expando Expand expandos in a format string
+ *
+ * Expand the expandos (%x) in a format string, e.g. `$index_format`, using a
+ * callback to supply their values.
+ */
+
+#include "config.h"
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+#include "mutt/lib.h"
+#include "config/lib.h"
+#include "core/lib.h"
+#include "expando.h"
+#include "parse/lib.h"
+#include "curs_lib.h"
+#include "format_flags.h"
+#include "globals.h"
+
+/// Maximum number of Expando Programs to cache
+#define EXPANDO_MAX_PROGRAMS 256
+
+/**
+ * enum ExpandoInstrType - Types of Expando Instruction
+ */
+enum ExpandoInstrType
+{
+  EI_END,     ///< End of the format string, or a bad format
+  EI_TEXT,    ///< Run of plain text
+  EI_CHAR,    ///< Single character, e.g. `%%` or `\n`
+  EI_EXPANDO, ///< Expando or conditional, handled by the callback
+  EI_PAD,     ///< Padding, `%>X` or `%*X`
+  EI_FILL,    ///< Pad to end of line, `%|X`
+};
+
+/**
+ * struct ExpandoInstr - One parsed step of a format string
+ */
+struct ExpandoInstr
+{
+  enum ExpandoInstrType type; ///< Type of Instruction
+  size_t start;               ///< Offset of the Instruction in the text
+  size_t end;                 ///< Offset of the text following the Instruction
+  size_t len;                 ///< EI_TEXT: Length in bytes
+  int width;                  ///< EI_TEXT: Width in screen columns
+  int pl;                     ///< EI_PAD, EI_FILL: Length of the padding character
+  int pw;                     ///< EI_PAD, EI_FILL: Width of the padding character
+  char ch;                    ///< EI_CHAR: Character; EI_EXPANDO: Expando
+  bool optional : 1;          ///< Expando is a conditional, e.g. `%<x?y&z>`
+  bool soft     : 1;          ///< EI_PAD: Right-hand side takes precedence, `%*X`
+  bool to_lower : 1;          ///< EI_EXPANDO: Convert the result to lowercase, `%_x`
+  bool no_dots  : 1;          ///< EI_EXPANDO: Replace dots with underscores, `%:x`
+  char *prefix;               ///< EI_EXPANDO: Field precision, e.g. "-15.15"
+  char *if_str;               ///< EI_EXPANDO: Conditional's true part
+  char *else_str;             ///< EI_EXPANDO: Conditional's false part
+};
+
+/**
+ * struct ExpandoProgram - A parsed format string
+ *
+ * Parsing a format string, e.g. `$index_format`, is expensive, so each string
+ * is parsed once and the Instructions are reused.
+ *
+ * Callbacks may read arguments after their expando, e.g. `%{%H:%M}`, so the
+ * Instructions are recorded the first time they're run.  If a callback reads
+ * a different amount of text, the rest of the string is parsed from scratch.
+ */
+struct ExpandoProgram
+{
+  char *text;                ///< Copy of the format string, `%?` becomes `%<`
+  size_t text_size;          ///< Size of the text buffer
+  struct ExpandoInstr *ins;  ///< Instructions
+  size_t num_ins;            ///< Number of Instructions
+  size_t max_ins;            ///< Size of the Instructions array
+};
+
+/**
+ * struct ExpandoState - The state of an Expando Program being run
+ */
+struct ExpandoState
+{
+  char *buf;              ///< Buffer in which to save string
+  size_t buflen;          ///< Buffer length, less one for the terminating NUL
+  char *wptr;             ///< Write pointer
+  size_t wlen;            ///< Number of bytes written
+  size_t col;             ///< Current column
+  int cols;               ///< Number of screen columns
+  format_t callback;      ///< Callback - Implements ::format_t
+  intptr_t data;          ///< Callback data
+  MuttFormatFlags flags;  ///< Callback flags
+  const char *if_str;     ///< Most recent conditional's true part
+  const char *else_str;   ///< Most recent conditional's false part
+  bool arrow_cursor;      ///< Config: $arrow_cursor
+  int arrow_width;        ///< Width of $arrow_string
+};
+
+static struct HashTable *ExpandoPrograms = NULL; ///< Cache of parsed format strings
+static size_t ExpandoNumPrograms = 0;            ///< Number of cached Programs
+static int ExpandoDepth = 0;                     ///< Depth of mutt_expando_format() recursion
+
+/**
+ * expando_program_free - Free an ExpandoProgram
+ * @param ptr ExpandoProgram to free
+ */
+static void expando_program_free(struct ExpandoProgram **ptr)
+{
+  if (!ptr || !*ptr)
+    return;
+
+  struct ExpandoProgram *prog = *ptr;
+  for (size_t i = 0; i < prog->num_ins; i++)
+  {
+    FREE(&prog->ins[i].prefix);
+    FREE(&prog->ins[i].if_str);
+    FREE(&prog->ins[i].else_str);
+  }
+  FREE(&prog->ins);
+  FREE(&prog->text);
+  FREE(ptr);
+}
+
+/**
+ * expando_program_hash_free - Free an ExpandoProgram - Implements ::hash_hdata_free_t - @ingroup hash_hdata_free_api
+ */
+static void expando_program_hash_free(int type, void *obj, intptr_t data)
+{
+  struct ExpandoProgram *prog = obj;
+  expando_program_free(&prog);
+}
+
+/**
+ * expando_program_new - Create a new ExpandoProgram
+ * @param src Format string
+ * @retval ptr New ExpandoProgram
+ *
+ * Like mutt_expando_format(), only the first 1023 bytes of the format string
+ * are used.
+ */
+static struct ExpandoProgram *expando_program_new(const char *src)
+{
+  struct ExpandoProgram *prog = mutt_mem_calloc(1, sizeof(struct ExpandoProgram));
+
+  // Escaping '<' and '>' inside a `%?` conditional adds two bytes each
+  const size_t len = MIN(mutt_str_len(src), 1023);
+  prog->text_size = (len * 3) + 1;
+  prog->text = mutt_mem_calloc(1, prog->text_size);
+  memcpy(prog->text, NONULL(src), len);
+
+  return prog;
+}
+
+/**
+ * expando_program_get - Get the parsed form of a format string
+ * @param src Format string
+ * @retval ptr ExpandoProgram
+ */
+static struct ExpandoProgram *expando_program_get(const char *src)
+{
+  src = NONULL(src);
+
+  if (ExpandoPrograms)
+  {
+    struct ExpandoProgram *prog = mutt_hash_find(ExpandoPrograms, src);
+    if (prog)
+      return prog;
+
+    // Formats generated on the fly, e.g. by a pipe, could fill the cache.
+    // Programs can't be freed while they're being run.
+    if ((ExpandoNumPrograms >= EXPANDO_MAX_PROGRAMS) && (ExpandoDepth == 0))
+      mutt_expando_cleanup();
+  }
+
+  if (!ExpandoPrograms)
+  {
+    ExpandoPrograms = mutt_hash_new(EXPANDO_MAX_PROGRAMS, MUTT_HASH_STRDUP_KEYS);
+    mutt_hash_set_destructor(ExpandoPrograms, expando_program_hash_free, 0);
+  }
+
+  struct ExpandoProgram *prog = expando_program_new(src);
+  mutt_hash_insert(ExpandoPrograms, src, prog);
+  ExpandoNumPrograms++;
+  return prog;
+}
+
+/**
+ * mutt_expando_cleanup - Free the cache of parsed format strings
+ */
+void mutt_expando_cleanup(void)
+{
+  mutt_hash_free(&ExpandoPrograms);
+  ExpandoNumPrograms = 0;
+}
+
+/**
+ * expando_parse - Parse one Instruction of a format string
+ * @param[in]  prog ExpandoProgram
+ * @param[in]  pos  Offset of the Instruction in the text
+ * @param[out] ins  Instruction
+ *
+ * The parsing matches the original, character-by-character, expansion.
+ */
+static void expando_parse(struct ExpandoProgram *prog, size_t pos, struct ExpandoInstr *ins)
+{
+  char prefix[128] = { 0 };
+  char if_str[128] = { 0 };
+  char else_str[128] = { 0 };
+  char *cp = NULL;
+  char ch;
+  size_t count;
+
+  char *src = prog->text + pos;
+
+  memset(ins, 0, sizeof(*ins));
+  ins->type = EI_END;
+  ins->start = pos;
+
+  if (*src == '\0')
+    return;
+
+  if (*src == '%')
+  {
+    if (*++src == '%')
+    {
+      ins->type = EI_CHAR;
+      ins->ch = '%';
+      ins->end = src + 1 - prog->text;
+      return;
+    }
+
+    if (*src == '?')
+    {
+      /* change original %? to new %< notation */
+      /* %?x?y&z? to %<x?y&z> where y and z are nestable */
+      char *p = (char *) src;
+      *p = '<';
+      /* skip over "x" */
+      for (; *p && (*p != '?'); p++)
+        ; // do nothing
+
+      /* nothing */
+      if (*p == '?')
+        p++;
+      /* fix up the "y&z" section */
+      for (; *p && (*p != '?'); p++)
+      {
+        /* escape '<' and '>' to work inside nested-if */
+        if ((*p == '<') || (*p == '>'))
+        {
+          memmove(p + 2, p, mutt_str_len(p) + 1);
+          *p++ = '\\';
+          *p++ = '\\';
+        }
+      }
+      if (*p == '?')
+        *p = '>';
+    }
+
+    if (*src == '<')
+    {
+      ins->optional = true;
+      ch = *(++src); /* save the character to switch on */
+      src++;
+      cp = prefix;
+      count = 0;
+      while ((count < (sizeof(prefix) - 1)) && (*src != '\0') && (*src != '?'))
+      {
+        *cp++ = *src++;
+        count++;
+      }
+      *cp = '\0';
+    }
+    else
+    {
+      ins->optional = false;
+
+      /* eat the format string */
+      cp = prefix;
+      count = 0;
+      while ((count < (sizeof(prefix) - 1)) && (*src != '\0') &&
+             strchr("0123456789.-=", *src))
+      {
+        *cp++ = *src++;
+        count++;
+      }
+      *cp = '\0';
+
+      if (*src == '\0')
+        return; /* bad format */
+
+      ch = *src++; /* save the character to switch on */
+    }
+
+    if (ins->optional)
+    {
+      int lrbalance;
+
+      if (*src != '?')
+        return; /* bad format */
+      src++;
+
+      /* eat the 'if' part of the string */
+      cp = if_str;
+      count = 0;
+      lrbalance = 1;
+      while ((lrbalance > 0) && (count < sizeof(if_str)) && *src)
+      {
+        if ((src[0] == '%') && (src[1] == '>'))
+        {
+          /* This is a padding expando; copy two chars and carry on */
+          *cp++ = *src++;
+          *cp++ = *src++;
+          count += 2;
+          continue;
+        }
+
+        if (*src == '\\')
+        {
+          src++;
+          *cp++ = *src++;
+        }
+        else if ((src[0] == '%') && (src[1] == '<'))
+        {
+          lrbalance++;
+        }
+        else if (src[0] == '>')
+        {
+          lrbalance--;
+        }
+        if (lrbalance == 0)
+          break;
+        if ((lrbalance == 1) && (src[0] == '&'))
+          break;
+        *cp++ = *src++;
+        count++;
+      }
+      *cp = '\0';
+
+      /* eat the 'else' part of the string (optional) */
+      if (*src == '&')
+        src++; /* skip the & */
+      cp = else_str;
+      count = 0;
+      while ((lrbalance > 0) && (count < sizeof(else_str)) && (*src != '\0'))
+      {
+        if ((src[0] == '%') && (src[1] == '>'))
+        {
+          /* This is a padding expando; copy two chars and carry on */
+          *cp++ = *src++;
+          *cp++ = *src++;
+          count += 2;
+          continue;
+        }
+
+        if (*src == '\\')
+        {
+          src++;
+          *cp++ = *src++;
+        }
+        else if ((src[0] == '%') && (src[1] == '<'))
+        {
+          lrbalance++;
+        }
+        else if (src[0] == '>')
+        {
+          lrbalance--;
+        }
+        if (lrbalance == 0)
+          break;
+        if ((lrbalance == 1) && (src[0] == '&'))
+          break;
+        *cp++ = *src++;
+        count++;
+      }
+      *cp = '\0';
+
+      if ((*src == '\0'))
+        return; /* bad format */
+
+      src++; /* move past the trailing '>' (formerly '?') */
+    }
+
+    if ((ch == '>') || (ch == '*') || (ch == '|'))
+    {
+      ins->type = (ch == '|') ? EI_FILL : EI_PAD;
+      ins->soft = (ch == '*');
+      ins->pl = mutt_mb_charlen(src, &ins->pw);
+      if (ins->pl <= 0)
+      {
+        ins->pl = 1;
+        ins->pw = 1;
+      }
+      ins->end = src - prog->text;
+      return;
+    }
+
+    while ((ch == '_') || (ch == ':'))
+    {
+      if (ch == '_')
+        ins->to_lower = true;
+      else if (ch == ':')
+        ins->no_dots = true;
+
+      ch = *src++;
+    }
+
+    ins->type = EI_EXPANDO;
+    ins->ch = ch;
+    ins->prefix = mutt_str_dup(prefix);
+    if (ins->optional)
+    {
+      ins->if_str = mutt_str_dup(if_str);
+      ins->else_str = mutt_str_dup(else_str);
+    }
+    ins->end = src - prog->text;
+    return;
+  }
+
+  if (*src == '\\')
+  {
+    if (!*++src)
+      return;
+
+    ins->type = EI_CHAR;
+    switch (*src)
+    {
+      case 'f':
+        ins->ch = '\f';
+        break;
+      case 'n':
+        ins->ch = '\n';
+        break;
+      case 'r':
+        ins->ch = '\r';
+        break;
+      case 't':
+        ins->ch = '\t';
+        break;
+      case 'v':
+        ins->ch = '\v';
+        break;
+      default:
+        ins->ch = *src;
+        break;
+    }
+    ins->end = src + 1 - prog->text;
+    return;
+  }
+
+  /* a run of plain text */
+  ins->type = EI_TEXT;
+  while ((*src != '\0') && (*src != '%') && (*src != '\\'))
+  {
+    int width = 0;
+    int bytes = mutt_mb_charlen(src, &width);
+    /* in case of error, simply copy byte */
+    if (bytes < 0)
+    {
+      bytes = 1;
+      width = 1;
+    }
+    src += bytes;
+    ins->len += bytes;
+    ins->width += width;
+  }
+  ins->end = src - prog->text;
+}
+
+/**
+ * expando_run_text - Copy a run of plain text
+ * @param es   State of the Expando Program
+ * @param text Text to copy
+ * @param ins  Instruction
+ */
+static void expando_run_text(struct ExpandoState *es, const char *text,
+                             const struct ExpandoInstr *ins)
+{
+  if ((es->wlen + ins->len) < es->buflen)
+  {
+    memcpy(es->wptr, text, ins->len);
+    es->wptr += ins->len;
+    es->wlen += ins->len;
+    es->col += ins->width;
+    return;
+  }
+
+  /* not enough room for all the text, copy what we can */
+  const char *end = text + ins->len;
+  while ((text < end) && (es->wlen < es->buflen))
+  {
+    int width = 0;
+    int bytes = mutt_mb_charlen(text, &width);
+    /* in case of error, simply copy byte */
+    if (bytes < 0)
+    {
+      bytes = 1;
+      width = 1;
+    }
+    if ((bytes > 0) && ((es->wlen + bytes) < es->buflen))
+    {
+      memcpy(es->wptr, text, bytes);
+      es->wptr += bytes;
+      text += bytes;
+      es->wlen += bytes;
+      es->col += width;
+    }
+    else
+    {
+      es->wlen = es->buflen;
+    }
+  }
+}
+
+/**
+ * expando_run_pad - Pad the text, `%>X` or `%*X`
+ * @param es  State of the Expando Program
+ * @param src Padding character, followed by the rest of the format string
+ * @param ins Instruction
+ */
+static void expando_run_pad(struct ExpandoState *es, const char *src,
+                            const struct ExpandoInstr *ins)
+{
+  /* %>X: right justify to EOL, left takes precedence
+   * %*X: right justify to EOL, right takes precedence */
+  char tmp[1024] = { 0 };
+  const bool soft = ins->soft;
+  const int pl = ins->pl;
+  const int pw = ins->pw;
+  const int cols = es->cols;
+  const size_t buflen = es->buflen;
+  size_t len, wid;
+
+  /* see if there's room to add content, else ignore */
+  if (((es->col < cols) && (es->wlen < buflen)) || soft)
+  {
+    int pad;
+
+    /* get contents after padding */
+    mutt_expando_format(tmp, sizeof(tmp), 0, cols, src + pl, es->callback,
+                        es->data, es->flags);
+    len = mutt_str_len(tmp);
+    wid = mutt_strwidth(tmp);
+
+    pad = (cols - es->col - wid) / pw;
+    if (pad >= 0)
+    {
+      /* try to consume as many columns as we can, if we don't have
+       * memory for that, use as much memory as possible */
+      if (es->wlen + (pad * pl) + len > buflen)
+      {
+        pad = (buflen > (es->wlen + len)) ? ((buflen - es->wlen - len) / pl) : 0;
+      }
+      else
+      {
+        /* Add pre-spacing to make multi-column pad characters and
+         * the contents after padding line up */
+        while (((es->col + (pad * pw) + wid) < cols) &&
+               ((es->wlen + (pad * pl) + len) < buflen))
+        {
+          *es->wptr++ = ' ';
+          es->wlen++;
+          es->col++;
+        }
+      }
+      while (pad-- > 0)
+      {
+        memcpy(es->wptr, src, pl);
+        es->wptr += pl;
+        es->wlen += pl;
+        es->col += pw;
+      }
+    }
+    else if (soft)
+    {
+      int offset = ((es->flags & MUTT_FORMAT_ARROWCURSOR) && es->arrow_cursor) ?
+                       es->arrow_width + 1 :
+                       0;
+      int avail_cols = (cols > offset) ? (cols - offset) : 0;
+      /* \0-terminate buf for length computation in mutt_wstr_trunc() */
+      *es->wptr = '\0';
+      /* make sure right part is at most as wide as display */
+      len = mutt_wstr_trunc(tmp, buflen, avail_cols, &wid);
+      /* truncate left so that right part fits completely in */
+      es->wlen = mutt_wstr_trunc(es->buf, buflen - len, avail_cols - wid, &es->col);
+      es->wptr = es->buf + es->wlen;
+      /* Multi-column characters may be truncated in the middle.
+       * Add spacing so the right hand side lines up. */
+      while (((es->col + wid) < avail_cols) && ((es->wlen + len) < buflen))
+      {
+        *es->wptr++ = ' ';
+        es->wlen++;
+        es->col++;
+      }
+    }
+    if ((len + es->wlen) > buflen)
+      len = mutt_wstr_trunc(tmp, buflen - es->wlen, cols - es->col, NULL);
+    memcpy(es->wptr, tmp, len);
+    es->wptr += len;
+  }
+}
+
+/**
+ * expando_run_fill - Pad to the end of the line, `%|X`
+ * @param es  State of the Expando Program
+ * @param src Padding character
+ * @param ins Instruction
+ */
+static void expando_run_fill(struct ExpandoState *es, const char *src,
+                             const struct ExpandoInstr *ins)
+{
+  const int pl = ins->pl;
+  const int pw = ins->pw;
+
+  /* see if there's room to add content, else ignore */
+  if ((es->col < es->cols) && (es->wlen < es->buflen))
+  {
+    int c = (es->cols - es->col) / pw;
+    if ((c > 0) && ((es->wlen + (c * pl)) > es->buflen))
+      c = ((signed) (es->buflen - es->wlen)) / pl;
+    while (c > 0)
+    {
+      memcpy(es->wptr, src, pl);
+      es->wptr += pl;
+      es->wlen += pl;
+      es->col += pw;
+      c--;
+    }
+  }
+}
+
+/**
+ * expando_run_expando - Expand an expando, using the callback
+ * @param es  State of the Expando Program
+ * @param src Text following the expando
+ * @param ins Instruction
+ * @retval ptr Text following the expando's arguments
+ */
+static const char *expando_run_expando(struct ExpandoState *es, const char *src,
+                                       const struct ExpandoInstr *ins)
+{
+  char tmp[1024];
+
+  if (ins->optional)
+  {
+    es->flags |= MUTT_FORMAT_OPTIONAL;
+    es->if_str = NONULL(ins->if_str);
+    es->else_str = NONULL(ins->else_str);
+  }
+  else
+  {
+    es->flags &= ~MUTT_FORMAT_OPTIONAL;
+  }
+
+  /* use callback function to handle this case */
+  *tmp = '\0';
+  src = es->callback(tmp, sizeof(tmp), es->col, es->cols, ins->ch, src,
+                     NONULL(ins->prefix), es->if_str, es->else_str, es->data, es->flags);
+
+  if (ins->to_lower)
+    mutt_str_lower(tmp);
+  if (ins->no_dots)
+  {
+    char *p = tmp;
+    for (; *p; p++)
+      if (*p == '.')
+        *p = '_';
+  }
+
+  size_t len = mutt_str_len(tmp);
+  if ((len + es->wlen) > es->buflen)
+    len = mutt_wstr_trunc(tmp, es->buflen - es->wlen, es->cols - es->col, NULL);
+
+  memcpy(es->wptr, tmp, len);
+  es->wptr += len;
+  es->wlen += len;
+  es->col += mutt_strwidth(tmp);
+
+  return src;
+}
+
+/**
+ * expando_run - Run an Expando Program
+ * @param prog ExpandoProgram
+ * @param es   State of the Expando Program
+ *
+ * Missing Instructions are parsed and added to the Program.
+ */
+static void expando_run(struct ExpandoProgram *prog, struct ExpandoState *es)
+{
+  size_t pos = 0;
+  size_t idx = 0;
+  struct ExpandoInstr ins = { 0 };
+
+  while (es->wlen < es->buflen)
+  {
+    if (idx == prog->num_ins)
+    {
+      if (prog->num_ins == prog->max_ins)
+      {
+        prog->max_ins += 8;
+        mutt_mem_realloc(&prog->ins, prog->max_ins * sizeof(struct ExpandoInstr));
+      }
+      expando_parse(prog, pos, &prog->ins[prog->num_ins]);
+      prog->num_ins++;
+    }
+
+    // A callback may re-enter this Program, so take a copy
+    ins = prog->ins[idx];
+
+    if (ins.start != pos)
+    {
+      /* A callback read a different amount of text than last time.
+       * Parse the rest of the format string without caching it. */
+      struct ExpandoProgram *tmp = expando_program_new(prog->text + pos);
+      expando_run(tmp, es);
+      expando_program_free(&tmp);
+      return;
+    }
+
+    const char *src = prog->text + ins.end;
+    switch (ins.type)
+    {
+      case EI_END:
+        return;
+
+      case EI_TEXT:
+        expando_run_text(es, prog->text + ins.start, &ins);
+        break;
+
+      case EI_CHAR:
+        *es->wptr++ = ins.ch;
+        es->wlen++;
+        es->col++;
+        break;
+
+      case EI_PAD:
+      case EI_FILL:
+        if (ins.optional)
+          es->flags |= MUTT_FORMAT_OPTIONAL;
+        else
+          es->flags &= ~MUTT_FORMAT_OPTIONAL;
+
+        if (ins.type == EI_PAD)
+          expando_run_pad(es, src, &ins);
+        else
+          expando_run_fill(es, src, &ins);
+        return; /* skip rest of input */
+
+      case EI_EXPANDO:
+        src = expando_run_expando(es, src, &ins);
+        break;
+    }
+
+    pos = src - prog->text;
+    idx++;
+  }
+}
+
+/**
+ * mutt_expando_format - Expand expandos (%x) in a string - @ingroup expando_api
+ * @param[out] buf      Buffer in which to save string
+ * @param[in]  buflen   Buffer length
+ * @param[in]  col      Starting column
+ * @param[in]  cols     Number of screen columns
+ * @param[in]  src      Printf-like format string
+ * @param[in]  callback Callback - Implements ::format_t
+ * @param[in]  data     Callback data
+ * @param[in]  flags    Callback flags
+ */
+void mutt_expando_format(char *buf, size_t buflen, size_t col, int cols, const char *src,
+                         format_t callback, intptr_t data, MuttFormatFlags flags)
+{
+  char tmp[1024] = { 0 };
+  char *wptr = buf;
+  size_t wlen;
+  FILE *fp_filter = NULL;
+  char *recycler = NULL;
+
+  char src2[1024] = { 0 };
+  mutt_str_copy(src2, src, mutt_str_len(src) + 1);
+  src = src2;
+
+  const bool c_arrow_cursor = cs_subset_bool(NeoMutt->sub, "arrow_cursor");
+  const char *const c_arrow_string = cs_subset_string(NeoMutt->sub, "arrow_string");
+  const int arrow_width = mutt_strwidth(c_arrow_string);
+
+  buflen--; /* save room for the terminal \0 */
+  wlen = ((flags & MUTT_FORMAT_ARROWCURSOR) && c_arrow_cursor) ? arrow_width + 1 : 0;
+  col += wlen;
+
+  if ((flags & MUTT_FORMAT_NOFILTER) == 0)
+  {
+    int off = -1;
+
+    /* Do not consider filters if no pipe at end */
+    int n = mutt_str_len(src);
+    if ((n > 1) && (src[n - 1] == '|'))
+    {
+      /* Scan backwards for backslashes */
+      off = n;
+      while ((off > 0) && (src[off - 2] == '\\'))
+        off--;
+    }
+
+    /* If number of backslashes is even, the pipe is real. */
+    /* n-off is the number of backslashes. */
+    if ((off > 0) && (((n - off) % 2) == 0))
+    {
+      char srccopy[1024] = { 0 };
+      int i = 0;
+
+      mutt_debug(LL_DEBUG3, "fmtpipe = %s\n", src);
+
+      strncpy(srccopy, src, n);
+      srccopy[n - 1] = '\0';
+
+      /* prepare Buffers */
+      struct Buffer srcbuf = buf_make(0);
+      buf_addstr(&srcbuf, srccopy);
+      /* note: we are resetting dptr and *reading* from the buffer, so we don't
+       * want to use buf_reset(). */
+      buf_seek(&srcbuf, 0);
+      struct Buffer word = buf_make(0);
+      struct Buffer cmd = buf_make(0);
+
+      /* Iterate expansions across successive arguments */
+      do
+      {
+        /* Extract the command name and copy to command line */
+        mutt_debug(LL_DEBUG3, "fmtpipe +++: %s\n", srcbuf.dptr);
+        if (word.data)
+          *word.data = '\0';
+        parse_extract_token(&word, &srcbuf, TOKEN_NO_FLAGS);
+        mutt_debug(LL_DEBUG3, "fmtpipe %2d: %s\n", i++, word.data);
+        buf_addch(&cmd, '\'');
+        mutt_expando_format(tmp, sizeof(tmp), 0, cols, word.data, callback,
+                            data, flags | MUTT_FORMAT_NOFILTER);
+        for (char *p = tmp; p && (*p != '\0'); p++)
+        {
+          if (*p == '\'')
+          {
+            /* shell quoting doesn't permit escaping a single quote within
+             * single-quoted material.  double-quoting instead will lead
+             * shell variable expansions, so break out of the single-quoted
+             * span, insert a double-quoted single quote, and resume. */
+            buf_addstr(&cmd, "'\"'\"'");
+          }
+          else
+          {
+            buf_addch(&cmd, *p);
+          }
+        }
+        buf_addch(&cmd, '\'');
+        buf_addch(&cmd, ' ');
+      } while (MoreArgs(&srcbuf));
+
+      mutt_debug(LL_DEBUG3, "fmtpipe > %s\n", cmd.data);
+
+      col -= wlen; /* reset to passed in value */
+      wptr = buf;  /* reset write ptr */
+      pid_t pid = filter_create(cmd.data, NULL, &fp_filter, NULL, EnvList);
+      if (pid != -1)
+      {
+        int rc;
+
+        n = fread(buf, 1, buflen /* already decremented */, fp_filter);
+        mutt_file_fclose(&fp_filter);
+        rc = filter_wait(pid);
+        if (rc != 0)
+          mutt_debug(LL_DEBUG1, "format pipe cmd exited code %d\n", rc);
+        if (n > 0)
+        {
+          buf[n] = '\0';
+          while ((n > 0) && ((buf[n - 1] == '\n') || (buf[n - 1] == '\r')))
+            buf[--n] = '\0';
+          mutt_debug(LL_DEBUG5, "fmtpipe < %s\n", buf);
+
+          /* If the result ends with '%', this indicates that the filter
+           * generated %-tokens that neomutt can expand.  Eliminate the '%'
+           * marker and recycle the string through mutt_expando_format().
+           * To literally end with "%", use "%%". */
+          if ((n > 0) && (buf[n - 1] == '%'))
+          {
+            n--;
+            buf[n] = '\0'; /* remove '%' */
+            if ((n > 0) && (buf[n - 1] != '%'))
+            {
+              recycler = mutt_str_dup(buf);
+              if (recycler)
+              {
+                /* buflen is decremented at the start of this function
+                 * to save space for the terminal nul char.  We can add
+                 * it back for the recursive call since the expansion of
+                 * format pipes does not try to append a nul itself.  */
+                mutt_expando_format(buf, buflen + 1, col, cols, recycler,
+                                    callback, data, flags);
+                FREE(&recycler);
+              }
+            }
+          }
+        }
+        else
+        {
+          /* read error */
+          mutt_debug(LL_DEBUG1, "error reading from fmtpipe: %s (errno=%d)\n",
+                     strerror(errno), errno);
+          *wptr = '\0';
+        }
+      }
+      else
+      {
+        /* Filter failed; erase write buffer */
+        *wptr = '\0';
+      }
+
+      buf_dealloc(&cmd);
+      buf_dealloc(&srcbuf);
+      buf_dealloc(&word);
+      return;
+    }
+  }
+
+  struct ExpandoState es = {
+    .buf = buf,
+    .buflen = buflen,
+    .wptr = wptr,
+    .wlen = wlen,
+    .col = col,
+    .cols = cols,
+    .callback = callback,
+    .data = data,
+    .flags = flags,
+    .if_str = "",
+    .else_str = "",
+    .arrow_cursor = c_arrow_cursor,
+    .arrow_width = arrow_width,
+  };
+
+  struct ExpandoProgram *prog = expando_program_get(src);
+  ExpandoDepth++;
+  expando_run(prog, &es);
+  ExpandoDepth--;
+
+  *es.wptr = '\0';
+}
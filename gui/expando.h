@@ -0,0 +1,33 @@
+/**
+ * @file
+ * Expand expandos (%x) in a format string
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUTT_GUI_EXPANDO_H
+#define MUTT_GUI_EXPANDO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "format_flags.h"
+
+void mutt_expando_cleanup(void);
+void mutt_expando_format (char *buf, size_t buflen, size_t col, int cols, const char *src, format_t callback, intptr_t data, MuttFormatFlags flags);
+
+#endif /* MUTT_GUI_EXPANDO_H */
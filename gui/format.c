@@ -70,8 +70,27 @@ void mutt_simple_format(char *buf, size_t buflen, int min_width, int max_width,
 
   buflen--;
   char *p = buf;
-  for (; n && (k = mbrtowc(&wc, s, n, &mbstate1)); s += k, n -= k)
+  for (; n; s += k, n -= k)
   {
+    /* Printable ASCII is one cell wide, so skip the costly wide char calls */
+    if (CharsetIsUtf8 && !escaped && ((unsigned char) *s >= 0x20) &&
+        ((unsigned char) *s < 0x7f))
+    {
+      k = 1;
+      if ((max_width < 1) || (buflen < 1))
+        continue;
+
+      min_width--;
+      max_width--;
+      *p++ = *s;
+      buflen--;
+      continue;
+    }
+
+    k = mbrtowc(&wc, s, n, &mbstate1);
+    if (k == 0)
+      break;
+
     if ((k == ICONV_ILLEGAL_SEQ) || (k == ICONV_BUF_TOO_SMALL))
     {
       if ((k == ICONV_ILLEGAL_SEQ) && (errno == EILSEQ))
@@ -29,6 +29,7 @@
  * | :------------------ | :------------------------- |
  * | gui/curs_lib.c      | @subpage gui_curs_lib      |
  * | gui/dialog.c        | @subpage gui_dialog        |
+ * | gui/expando.c       | @subpage gui_expando       |
  * | gui/format.c        | @subpage gui_format        |
  * | gui/functions.c     | @subpage gui_functions     |
  * | gui/global.c        | @subpage gui_global        |
@@ -52,6 +53,7 @@
 // IWYU pragma: begin_keep
 #include "curs_lib.h"
 #include "dialog.h"
+#include "expando.h"
 #include "format.h"
 #include "functions.h"
 #include "global.h"
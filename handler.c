@@ -220,10 +220,15 @@ static int qp_decode_triple(char *s, char *d)
     return 1;
 
   /* quoted-printable triple */
-  if ((s[0] == '=') && isxdigit((unsigned char) s[1]) && isxdigit((unsigned char) s[2]))
+  if (s[0] == '=')
   {
-    *d = (hexval(s[1]) << 4) | hexval(s[2]);
-    return 0;
+    const int hi = ((unsigned char) s[1] < 128) ? hexval(s[1]) : -1;
+    const int lo = ((unsigned char) s[2] < 128) ? hexval(s[2]) : -1;
+    if ((hi | lo) >= 0)
+    {
+      *d = (hi << 4) | lo;
+      return 0;
+    }
   }
 
   /* something else */
@@ -249,6 +254,18 @@ static void qp_decode_line(char *dest, char *src, size_t *l, int last)
 
   for (d = dest, s = src; *s;)
   {
+    /* copy any plain text in one go */
+    const char *eq = strchr(s, '=');
+    const size_t plain = eq ? (size_t) (eq - s) : strlen(s);
+    if (plain > 0)
+    {
+      memcpy(d, s, plain);
+      d += plain;
+      s += plain;
+      kind = -1;
+      continue;
+    }
+
     switch ((kind = qp_decode_triple(s, &c)))
     {
       case 0:
@@ -1522,96 +1539,126 @@ static int malformed_pgp_encrypted_handler(struct Body *b_email, struct State *s
   return rc;
 }
 
+/**
+ * b64_decode_quad - Decode one group of base64 characters
+ * @param[in]  quad Four base64 characters, or padding
+ * @param[out] out  Buffer for the bytes
+ * @param[out] done true if the group contained padding
+ * @retval num Number of bytes decoded
+ */
+static size_t b64_decode_quad(const char *quad, char *out, bool *done)
+{
+  const int c1 = base64val(quad[0]);
+  const int c2 = base64val(quad[1]);
+
+  out[0] = (c1 << 2) | (c2 >> 4);
+  if (quad[2] == '=')
+  {
+    *done = true;
+    return 1;
+  }
+
+  const int c3 = base64val(quad[2]);
+  out[1] = ((c2 & 0xf) << 4) | (c3 >> 2);
+  if (quad[3] == '=')
+  {
+    *done = true;
+    return 2;
+  }
+
+  const int c4 = base64val(quad[3]);
+  out[2] = ((c3 & 0x3) << 6) | c4;
+  return 3;
+}
+
 /**
  * mutt_decode_base64 - Decode base64-encoded text
  * @param state      State to work with
  * @param len    Length of text to decode
  * @param istext Mime part is plain text
  * @param cd     Iconv conversion descriptor
+ *
+ * The text is read in large blocks.  Complete groups of four characters are
+ * decoded in bulk; line breaks, padding and stray characters are dealt with
+ * one at a time.  For text, CRLF is converted to LF.
  */
 void mutt_decode_base64(struct State *state, size_t len, bool istext, iconv_t cd)
 {
-  char buf[5] = { 0 };
-  int ch, i;
+  char chunk[8192];
+  char raw[((sizeof(chunk) / 4) * 3) + 3];
+  char quad[4] = { 0 };
+  size_t qlen = 0;
   bool cr = false;
+  bool done = false;
   char bufi[BUFI_SIZE] = { 0 };
   size_t l = 0;
 
-  buf[4] = '\0';
-
   if (istext)
     state_set_prefix(state);
 
-  while (len > 0)
+  while ((len > 0) && !done)
   {
-    for (i = 0; (i < 4) && (len > 0); len--)
-    {
-      ch = fgetc(state->fp_in);
-      if (ch == EOF)
-        break;
-      if ((ch >= 0) && (ch < 128) && ((base64val(ch) != -1) || (ch == '=')))
-        buf[i++] = ch;
-    }
-    if (i != 4)
-    {
-      /* "i" may be zero if there is trailing whitespace, which is not an error */
-      if (i != 0)
-        mutt_debug(LL_DEBUG2, "didn't get a multiple of 4 chars\n");
+    const size_t num = fread(chunk, 1, MIN(len, sizeof(chunk)), state->fp_in);
+    if (num == 0)
       break;
-    }
-
-    const int c1 = base64val(buf[0]);
-    const int c2 = base64val(buf[1]);
+    len -= num;
 
-    /* first char */
-    ch = (c1 << 2) | (c2 >> 4);
-
-    if (cr && (ch != '\n'))
-      bufi[l++] = '\r';
-
-    cr = false;
-
-    if (istext && (ch == '\r'))
-      cr = true;
-    else
-      bufi[l++] = ch;
-
-    /* second char */
-    if (buf[2] == '=')
-      break;
-    const int c3 = base64val(buf[2]);
-    ch = ((c2 & 0xf) << 4) | (c3 >> 2);
-
-    if (cr && (ch != '\n'))
-      bufi[l++] = '\r';
-
-    cr = false;
-
-    if (istext && (ch == '\r'))
-      cr = true;
-    else
-      bufi[l++] = ch;
+    for (size_t pos = 0; (pos < num) && !done;)
+    {
+      size_t rlen = 0;
+      if (qlen == 0)
+      {
+        const size_t used = mutt_b64_decode_quads(chunk + pos, num - pos, raw);
+        pos += used;
+        rlen = (used / 4) * 3;
+      }
 
-    /* third char */
-    if (buf[3] == '=')
-      break;
-    const int c4 = base64val(buf[3]);
-    ch = ((c3 & 0x3) << 6) | c4;
+      if (rlen == 0)
+      {
+        /* line breaks and other junk are skipped */
+        const unsigned char ch = chunk[pos++];
+        if ((base64val(ch) != -1) || (ch == '='))
+          quad[qlen++] = ch;
+        if (qlen == 4)
+        {
+          rlen = b64_decode_quad(quad, raw, &done);
+          qlen = 0;
+        }
+      }
 
-    if (cr && (ch != '\n'))
-      bufi[l++] = '\r';
+      if (!istext)
+      {
+        for (size_t i = 0; i < rlen;)
+        {
+          const size_t copy = MIN(rlen - i, sizeof(bufi) - l);
+          memcpy(bufi + l, raw + i, copy);
+          l += copy;
+          i += copy;
+          if (l == sizeof(bufi))
+            convert_to_state(cd, bufi, &l, state);
+        }
+        continue;
+      }
 
-    cr = false;
+      for (size_t i = 0; i < rlen; i++)
+      {
+        if (cr && (raw[i] != '\n'))
+          bufi[l++] = '\r';
 
-    if (istext && (ch == '\r'))
-      cr = true;
-    else
-      bufi[l++] = ch;
+        cr = (raw[i] == '\r');
+        if (!cr)
+          bufi[l++] = raw[i];
 
-    if ((l + 8) >= sizeof(bufi))
-      convert_to_state(cd, bufi, &l, state);
+        if ((l + 2) >= sizeof(bufi))
+          convert_to_state(cd, bufi, &l, state);
+      }
+    }
   }
 
+  /* "qlen" may be zero if there is trailing whitespace, which is not an error */
+  if (qlen != 0)
+    mutt_debug(LL_DEBUG2, "didn't get a multiple of 4 chars\n");
+
   if (cr)
     bufi[l++] = '\r';
 
@@ -61,6 +61,13 @@
 /// Header Cache version
 static unsigned int HcacheVer = 0x0;
 
+/// Time spent fetching Emails
+static struct StatsEntry StatsFetch = STATS_ENTRY("hcache_fetch_email");
+/// Emails that weren't in the cache
+static struct StatsEntry StatsFetchMiss = STATS_ENTRY("hcache_fetch_email.miss");
+/// Time spent storing Emails
+static struct StatsEntry StatsStore = STATS_ENTRY("hcache_store_email");
+
 /**
  * struct RealKey - Hcache key name (including compression method)
  */
@@ -564,6 +571,7 @@ struct HCacheEntry hcache_fetch_email(struct HeaderCache *hc, const char *key,
   if (!hc)
     return hce;
 
+  const uint64_t start = stats_timer_start();
   size_t dlen = 0;
   struct RealKey *rk = realkey(hc, key, keylen, true);
   void *data = hc->store_ops->fetch(hc->store_handle, rk->key, rk->keylen, &dlen);
@@ -605,6 +613,9 @@ struct HCacheEntry hcache_fetch_email(struct HeaderCache *hc, const char *key,
 
 end:
   free_raw(hc, &to_free);
+  stats_timer_stop(&StatsFetch, start);
+  if (!hce.email)
+    stats_count(&StatsFetchMiss, 1);
   return hce;
 }
 
@@ -671,6 +682,7 @@ int hcache_store_email(struct HeaderCache *hc, const char *key, size_t keylen,
   if (!hc)
     return -1;
 
+  const uint64_t start = stats_timer_start();
   int dlen = 0;
   char *data = dump_email(hc, e, &dlen, uidvalidity);
 
@@ -687,6 +699,7 @@ int hcache_store_email(struct HeaderCache *hc, const char *key, size_t keylen,
     if (!cdata)
     {
       FREE(&data);
+      stats_timer_stop(&StatsStore, start);
       return -1;
     }
 
@@ -705,6 +718,7 @@ int hcache_store_email(struct HeaderCache *hc, const char *key, size_t keylen,
   int rc = hc->store_ops->store(hc->store_handle, rk->key, rk->keylen, data, dlen);
 
   FREE(&data);
+  stats_timer_stop(&StatsStore, start);
 
   return rc;
 }
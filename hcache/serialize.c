@@ -622,6 +622,22 @@ unsigned char *serial_dump_envelope(const struct Envelope *env,
   return d;
 }
 
+/**
+ * serial_restore_intern - Unpack a shared string from a binary blob
+ * @param[in]     d       Binary blob to read from
+ * @param[in,out] off     Offset into the blob
+ * @param[in]     convert If true, the strings will be converted to utf-8
+ * @retval ptr Interned string, see mutt_intern_get()
+ */
+static const char *serial_restore_intern(const unsigned char *d, int *off, bool convert)
+{
+  char *str = NULL;
+  serial_restore_char(&str, d, off, convert);
+  const char *interned = mutt_intern_get(str);
+  FREE(&str);
+  return interned;
+}
+
 /**
  * serial_restore_envelope - Unpack an Envelope from a binary blob
  * @param[in]     env     Store the unpacked Envelope here
@@ -642,27 +658,27 @@ void serial_restore_envelope(struct Envelope *env, const unsigned char *d, int *
   serial_restore_address(&env->reply_to, d, off, convert);
   serial_restore_address(&env->mail_followup_to, d, off, convert);
 
-  serial_restore_char(&env->list_post, d, off, convert);
-  serial_restore_char(&env->list_subscribe, d, off, convert);
-  serial_restore_char(&env->list_unsubscribe, d, off, convert);
+  env->list_post = serial_restore_intern(d, off, convert);
+  env->list_subscribe = serial_restore_intern(d, off, convert);
+  env->list_unsubscribe = serial_restore_intern(d, off, convert);
 
   const bool c_auto_subscribe = cs_subset_bool(NeoMutt->sub, "auto_subscribe");
   if (c_auto_subscribe)
     mutt_auto_subscribe(env->list_post);
 
-  serial_restore_char((char **) &env->subject, d, off, convert);
+  *(const char **) &env->subject = serial_restore_intern(d, off, convert);
   serial_restore_int((unsigned int *) (&real_subj_off), d, off);
 
   size_t len = mutt_str_len(env->subject);
   if ((real_subj_off < 0) || (real_subj_off >= len))
-    *(char **) &env->real_subj = NULL;
+    *(const char **) &env->real_subj = NULL;
   else
-    *(char **) &env->real_subj = env->subject + real_subj_off;
+    *(const char **) &env->real_subj = env->subject + real_subj_off;
 
   serial_restore_char(&env->message_id, d, off, false);
   serial_restore_char(&env->supersedes, d, off, false);
   serial_restore_char(&env->date, d, off, false);
-  serial_restore_char(&env->x_label, d, off, convert);
+  env->x_label = serial_restore_intern(d, off, convert);
   serial_restore_char(&env->organization, d, off, convert);
 
   serial_restore_buffer(&env->spam, d, off, convert);
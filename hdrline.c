@@ -65,6 +65,19 @@
 #include "notmuch/lib.h"
 #endif
 
+/// Handle for $from_chars
+static struct ConfigHandle HandleFromChars = CONFIG_HANDLE("from_chars");
+/// Handle for $crypt_chars
+static struct ConfigHandle HandleCryptChars = CONFIG_HANDLE("crypt_chars");
+/// Handle for $flag_chars
+static struct ConfigHandle HandleFlagChars = CONFIG_HANDLE("flag_chars");
+/// Handle for $to_chars
+static struct ConfigHandle HandleToChars = CONFIG_HANDLE("to_chars");
+/// Handle for $date_format
+static struct ConfigHandle HandleDateFormat = CONFIG_HANDLE("date_format");
+/// Handle for $save_address
+static struct ConfigHandle HandleSaveAddress = CONFIG_HANDLE("save_address");
+
 /**
  * struct HdrFormatInfo - Data passed to index_format_str()
  */
@@ -145,7 +158,7 @@ static const char *make_from_prefix(enum FieldType disp)
     [DISP_FROM] = "",  [DISP_PLAIN] = "",
   };
 
-  const struct MbTable *c_from_chars = cs_subset_mbtable(NeoMutt->sub, "from_chars");
+  const struct MbTable *c_from_chars = cc_mbtable(&HandleFromChars);
 
   if (!c_from_chars || !c_from_chars->chars || (c_from_chars->len == 0))
     return long_prefixes[disp];
@@ -422,10 +435,10 @@ static const char *index_format_str(char *buf, size_t buflen, size_t col, int co
   const struct Address *to = TAILQ_FIRST(&e->env->to);
   const struct Address *cc = TAILQ_FIRST(&e->env->cc);
 
-  const struct MbTable *c_crypt_chars = cs_subset_mbtable(NeoMutt->sub, "crypt_chars");
-  const struct MbTable *c_flag_chars = cs_subset_mbtable(NeoMutt->sub, "flag_chars");
-  const struct MbTable *c_to_chars = cs_subset_mbtable(NeoMutt->sub, "to_chars");
-  const char *const c_date_format = cs_subset_string(NeoMutt->sub, "date_format");
+  const struct MbTable *c_crypt_chars = cc_mbtable(&HandleCryptChars);
+  const struct MbTable *c_flag_chars = cc_mbtable(&HandleFlagChars);
+  const struct MbTable *c_to_chars = cc_mbtable(&HandleToChars);
+  const char *const c_date_format = cc_string(&HandleDateFormat);
 
   buf[0] = '\0';
   switch (op)
@@ -979,7 +992,7 @@ static const char *index_format_str(char *buf, size_t buflen, size_t col, int co
       if (!optional)
       {
         make_from_addr(e->env, tmp, sizeof(tmp), true);
-        const bool c_save_address = cs_subset_bool(NeoMutt->sub, "save_address");
+        const bool c_save_address = cc_bool(&HandleSaveAddress);
         if (!c_save_address && (p = strpbrk(tmp, "%@")))
           *p = '\0';
         mutt_format(buf, buflen, prec, tmp, false);
@@ -1026,7 +1039,7 @@ static const char *index_format_str(char *buf, size_t buflen, size_t col, int co
     case 's':
     {
       subjrx_apply_mods(e->env);
-      char *subj = NULL;
+      const char *subj = NULL;
       if (e->env->disp_subj)
         subj = e->env->disp_subj;
       else
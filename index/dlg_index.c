@@ -81,6 +81,7 @@
 #include "globals.h"
 #include "hdrline.h"
 #include "hook.h"
+#include "line_cache.h"
 #include "mutt_logging.h"
 #include "mutt_mailbox.h"
 #include "mutt_thread.h"
@@ -177,9 +178,9 @@ void collapse_all(struct MailboxView *mv, struct Menu *menu, int toggle)
   /* Figure out what the current message would be after folding / unfolding,
    * so that we can restore the cursor in a sane way afterwards. */
   if (e_cur->collapsed && toggle)
-    final = mutt_uncollapse_thread(e_cur);
+    final = mutt_uncollapse_thread(mv->mailbox, e_cur);
   else if (mutt_thread_can_collapse(e_cur))
-    final = mutt_collapse_thread(e_cur);
+    final = mutt_collapse_thread(mv->mailbox, e_cur);
   else
     final = e_cur->vnum;
 
@@ -226,7 +227,7 @@ static void uncollapse_thread(struct MailboxView *mv, int index)
   struct Email *e = mutt_get_virt_email(m, index);
   if (e && e->collapsed)
   {
-    mutt_uncollapse_thread(e);
+    mutt_uncollapse_thread(m, e);
     mutt_set_vnum(m);
   }
 }
@@ -445,12 +446,12 @@ static void update_index_threaded(struct MailboxView *mv, enum MxStatus check, i
       {
         /* vnum will get properly set by mutt_set_vnum(), which
          * is called by mutt_sort_headers() just below. */
-        e->vnum = 1;
+        mailbox_vnum_set(m, e, 1);
         e->visible = true;
       }
       else
       {
-        e->vnum = -1;
+        mailbox_vnum_set(m, e, -1);
         e->visible = false;
       }
 
@@ -476,7 +477,7 @@ static void update_index_threaded(struct MailboxView *mv, enum MxStatus check, i
       {
         if (save_new[j]->visible)
         {
-          mutt_uncollapse_thread(save_new[j]);
+          mutt_uncollapse_thread(m, save_new[j]);
         }
       }
       mutt_set_vnum(m);
@@ -511,7 +512,7 @@ static void update_index_unthreaded(struct MailboxView *mv, enum MxStatus check)
                             MUTT_MATCH_FULL_ADDRESS, mv->mailbox, e, NULL))
       {
         assert(mv->mailbox->vcount < mv->mailbox->msg_count);
-        e->vnum = mv->mailbox->vcount;
+        mailbox_vnum_set(mv->mailbox, e, mv->mailbox->vcount);
         mv->mailbox->v2r[mv->mailbox->vcount] = i;
         e->visible = true;
         mv->mailbox->vcount++;
@@ -880,8 +881,24 @@ void index_make_entry(struct Menu *menu, int line, struct Buffer *buf)
 
   const char *const c_index_format = cs_subset_string(shared->sub, "index_format");
   int msg_in_pager = shared->mailbox_view ? shared->mailbox_view->msg_in_pager : 0;
-  mutt_make_string(buf, menu->win->state.cols, NONULL(c_index_format), m,
-                   msg_in_pager, e, flags, NULL);
+  const int cols = menu->win->state.cols;
+  const bool in_pager = (msg_in_pager == e->msgno);
+
+  const bool cacheable = index_format_is_cacheable(c_index_format);
+  if (cacheable)
+  {
+    const char *line = index_line_cache_get(priv->line_cache, e, cols, flags, in_pager);
+    if (line)
+    {
+      buf_strcpy(buf, line);
+      return;
+    }
+  }
+
+  mutt_make_string(buf, cols, NONULL(c_index_format), m, msg_in_pager, e, flags, NULL);
+
+  if (cacheable)
+    index_line_cache_set(priv->line_cache, e, cols, flags, in_pager, buf->data);
 }
 
 /**
@@ -1358,10 +1375,39 @@ struct Mailbox *dlg_index(struct MuttWindow *dlg, struct Mailbox *m_init)
   return shared->mailbox;
 }
 
+/**
+ * mutt_reset_header_color - Forget the colour of a message, after it has changed
+ * @param e       Email
+ * @param changed What has changed, e.g. #MUTT_PAT_DEP_FLAGS
+ *
+ * The colour will be recalculated when the Email is next drawn.
+ *
+ * If the caller's change, which bumped Email::generation, is the only change
+ * since the colour was cached, then only the `color index` rules that depend
+ * on @a changed need to be re-evaluated.
+ */
+void mutt_reset_header_color(struct Email *e, PatternDeps changed)
+{
+  if (!e)
+    return;
+
+  if ((e->color_gen + 1) == e->generation)
+  {
+    e->color_valid &= ~changed;
+    e->color_gen = e->generation;
+  }
+
+  e->attr_color = NULL;
+}
+
 /**
  * mutt_set_header_color - Select a colour for a message
  * @param m Mailbox
  * @param e Current Email
+ *
+ * The results of the first 64 `color index` rules are cached in the Email.
+ * A rule is only re-evaluated if something that it depends upon has changed.
+ * Rules that depend on #MUTT_PAT_DEP_OTHER are always re-evaluated.
  */
 void mutt_set_header_color(struct Mailbox *m, struct Email *e)
 {
@@ -1371,16 +1417,40 @@ void mutt_set_header_color(struct Mailbox *m, struct Email *e)
   struct RegexColor *color = NULL;
   struct PatternCache cache = { 0 };
 
+  // If the Email has changed behind our back, trust nothing
+  const PatternDeps valid = (e->color_gen == e->generation) ? e->color_valid :
+                                                              MUTT_PAT_DEP_NONE;
+  uint64_t matches = 0;
+  int rule = 0;
+
   const struct AttrColor *ac_merge = NULL;
   STAILQ_FOREACH(color, regex_colors_get_list(MT_COLOR_INDEX), entries)
   {
-    if (mutt_pattern_exec(SLIST_FIRST(color->color_pattern),
-                          MUTT_MATCH_FULL_ADDRESS, m, e, &cache))
+    const uint64_t bit = (rule < 64) ? (1ULL << rule) : 0;
+    rule++;
+
+    bool match;
+    if (bit && ((color->color_deps & ~valid) == 0))
     {
+      match = (e->color_matches & bit);
+    }
+    else
+    {
+      match = mutt_pattern_exec(SLIST_FIRST(color->color_pattern),
+                                MUTT_MATCH_FULL_ADDRESS, m, e, &cache);
+    }
+
+    if (match)
+    {
+      matches |= bit;
       ac_merge = merged_color_overlay(ac_merge, &color->attr_color);
     }
   }
 
+  e->color_matches = matches;
+  e->color_gen = e->generation;
+  e->color_valid = MUTT_PAT_DEP_FLAGS | MUTT_PAT_DEP_HEADERS;
+
   struct AttrColor *ac_normal = simple_color_get(MT_COLOR_NORMAL);
   if (ac_merge)
     ac_merge = merged_color_overlay(ac_normal, ac_merge);
@@ -626,7 +626,7 @@ static int op_display_message(struct IndexSharedData *shared,
 
   if (mutt_using_threads() && shared->email->collapsed)
   {
-    mutt_uncollapse_thread(shared->email);
+    mutt_uncollapse_thread(shared->mailbox, shared->email);
     mutt_set_vnum(shared->mailbox);
     const bool c_uncollapse_jump = cs_subset_bool(shared->sub, "uncollapse_jump");
     if (c_uncollapse_jump)
@@ -942,7 +942,7 @@ static int op_jump(struct IndexSharedData *shared, struct IndexPrivateData *priv
 
     if (mutt_messages_in_thread(shared->mailbox, e, MIT_POSITION) > 1)
     {
-      mutt_uncollapse_thread(e);
+      mutt_uncollapse_thread(shared->mailbox, e);
       mutt_set_vnum(shared->mailbox);
     }
     menu_set_index(priv->menu, e->vnum);
@@ -1174,7 +1174,7 @@ static int op_main_collapse_thread(struct IndexSharedData *shared,
 
   if (shared->email->collapsed)
   {
-    int index = mutt_uncollapse_thread(shared->email);
+    int index = mutt_uncollapse_thread(shared->mailbox, shared->email);
     mutt_set_vnum(shared->mailbox);
     const bool c_uncollapse_jump = cs_subset_bool(shared->sub, "uncollapse_jump");
     if (c_uncollapse_jump)
@@ -1183,7 +1183,7 @@ static int op_main_collapse_thread(struct IndexSharedData *shared,
   }
   else if (mutt_thread_can_collapse(shared->email))
   {
-    menu_set_index(priv->menu, mutt_collapse_thread(shared->email));
+    menu_set_index(priv->menu, mutt_collapse_thread(shared->mailbox, shared->email));
     mutt_set_vnum(shared->mailbox);
   }
   else
@@ -1405,7 +1405,7 @@ static int op_main_modify_tags(struct IndexSharedData *shared,
 
       progress_update(progress, ++px, -1);
       mx_tags_commit(m, e, buf_string(buf));
-      e->attr_color = NULL;
+      mutt_reset_header_color(e, MUTT_PAT_DEP_HEADERS);
       if (op == OP_MAIN_MODIFY_TAGS_THEN_HIDE)
       {
         bool still_queried = false;
@@ -1431,7 +1431,7 @@ static int op_main_modify_tags(struct IndexSharedData *shared,
       mutt_message(_("Failed to modify tags, aborting"));
       goto done;
     }
-    shared->email->attr_color = NULL;
+    mutt_reset_header_color(shared->email, MUTT_PAT_DEP_HEADERS);
     if (op == OP_MAIN_MODIFY_TAGS_THEN_HIDE)
     {
       bool still_queried = false;
@@ -2730,7 +2730,7 @@ static int op_get_message(struct IndexSharedData *shared,
     }
     else if (e->collapsed)
     {
-      mutt_uncollapse_thread(e);
+      mutt_uncollapse_thread(m, e);
       mutt_set_vnum(m);
       menu_set_index(priv->menu, e->vnum);
     }
@@ -2940,7 +2940,7 @@ static int op_main_entire_thread(struct IndexSharedData *shared,
     index = e_oldcur->vnum;
     if (e_oldcur->collapsed || shared->mailbox_view->collapsed)
     {
-      index = mutt_uncollapse_thread(e_oldcur);
+      index = mutt_uncollapse_thread(shared->mailbox, e_oldcur);
       mutt_set_vnum(shared->mailbox);
     }
     menu_set_index(priv->menu, index);
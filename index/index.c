@@ -75,12 +75,14 @@
 #include "email/lib.h"
 #include "core/lib.h"
 #include "gui/lib.h"
+#include "lib.h"
 #include "attach/lib.h"
 #include "color/lib.h"
 #include "menu/lib.h"
 #include "postpone/lib.h"
 #include "alternates.h"
 #include "globals.h"
+#include "line_cache.h"
 #include "mutt_thread.h"
 #include "muttlib.h"
 #include "mview.h"
@@ -216,6 +218,17 @@ static int config_reply_regex(struct MailboxView *mv)
   return 0;
 }
 
+/**
+ * index_forget_lines - Forget the formatted lines of the Index
+ * @param win Index Window
+ */
+static void index_forget_lines(struct MuttWindow *win)
+{
+  struct Menu *menu = win->wdata;
+  struct IndexPrivateData *priv = menu->mdata;
+  index_line_cache_reset(priv->line_cache);
+}
+
 /**
  * index_altern_observer - Notification that an 'alternates' command has occurred - Implements ::observer_t - @ingroup observer_api
  */
@@ -231,6 +244,7 @@ static int index_altern_observer(struct NotifyCallback *nc)
   struct IndexSharedData *shared = dlg->wdata;
 
   mutt_alternates_reset(shared->mailbox_view);
+  index_forget_lines(win);
   mutt_debug(LL_DEBUG5, "alternates done\n");
   return 0;
 }
@@ -250,6 +264,7 @@ static int index_attach_observer(struct NotifyCallback *nc)
   struct IndexSharedData *shared = dlg->wdata;
 
   mutt_attachments_reset(shared->mailbox_view);
+  index_forget_lines(win);
   mutt_debug(LL_DEBUG5, "attachments done\n");
   return 0;
 }
@@ -285,6 +300,8 @@ static int index_color_observer(struct NotifyCallback *nc)
   struct MuttWindow *dlg = dialog_find(win);
   struct IndexSharedData *shared = dlg->wdata;
 
+  index_forget_lines(win);
+
   struct Mailbox *m = shared->mailbox;
   if (!m)
     return 0;
@@ -296,6 +313,7 @@ static int index_color_observer(struct NotifyCallback *nc)
     if (!e)
       break;
     e->attr_color = NULL;
+    e->color_valid = MUTT_PAT_DEP_NONE; // The rules may have changed
   }
 
   struct MuttWindow *panel_index = window_find_child(dlg, WT_INDEX);
@@ -395,6 +413,9 @@ static int index_config_observer(struct NotifyCallback *nc)
 
   struct MuttWindow *win = nc->global_data;
 
+  // Many config variables affect the formatting, e.g. $date_format
+  index_forget_lines(win);
+
   if (!config_check_sort(ev_c->name) && !config_check_index(ev_c->name))
     return 0;
 
@@ -440,6 +461,9 @@ static int index_global_observer(struct NotifyCallback *nc)
   struct IndexSharedData *shared = dlg->wdata;
   mutt_check_rescore(shared->mailbox);
 
+  // Commands, e.g. hooks, may change the formatting
+  index_forget_lines(win);
+
   return 0;
 }
 
@@ -454,6 +478,10 @@ static int index_index_observer(struct NotifyCallback *nc)
   struct MuttWindow *win = nc->global_data;
   win->actions |= WA_RECALC;
 
+  // Changing the current Email doesn't affect the formatting
+  if ((nc->event_type != NT_INDEX) || (nc->event_subtype != NT_INDEX_EMAIL))
+    index_forget_lines(win);
+
   struct Menu *menu = win->wdata;
   menu_queue_redraw(menu, MENU_REDRAW_INDEX);
   mutt_debug(LL_DEBUG5, "index done, request WA_RECALC\n");
@@ -517,6 +545,7 @@ static int index_score_observer(struct NotifyCallback *nc)
     mutt_score_message(m, e, true);
     e->attr_color = NULL; // Force recalc of colour
   }
+  index_forget_lines(win);
 
   mutt_debug(LL_DEBUG5, "score done\n");
   return 0;
@@ -537,6 +566,7 @@ static int index_subjrx_observer(struct NotifyCallback *nc)
   struct IndexSharedData *shared = dlg->wdata;
 
   subjrx_clear_mods(shared->mailbox_view);
+  index_forget_lines(win);
   mutt_debug(LL_DEBUG5, "subjectrx done\n");
   return 0;
 }
@@ -33,6 +33,7 @@
  * | index/ibar.c         | @subpage index_ibar         |
  * | index/index.c        | @subpage index_index        |
  * | index/ipanel.c       | @subpage index_ipanel       |
+ * | index/line_cache.c   | @subpage index_line_cache   |
  * | index/private_data.c | @subpage index_private_data |
  * | index/shared_data.c  | @subpage index_shared_data  |
  */
@@ -45,6 +46,7 @@
 #include <stdio.h>
 #include "mutt/lib.h"
 #include "core/lib.h"
+#include "pattern/lib.h"
 #include "functions.h"   // IWYU pragma: keep
 #include "shared_data.h" // IWYU pragma: keep
 
@@ -92,6 +94,7 @@ void                    index_make_entry        (struct Menu *menu, int line, st
 struct MuttWindow *     index_pager_init        (void);
 int                     mutt_dlgindex_observer  (struct NotifyCallback *nc);
 void                    mutt_draw_statusline    (struct MuttWindow *win, int cols, const char *buf, size_t buflen);
+void                    mutt_reset_header_color (struct Email *e, PatternDeps changed);
 void                    mutt_set_header_color   (struct Mailbox *m, struct Email *e);
 void                    resort_index            (struct MailboxView *mv, struct Menu *menu);
 void                    update_index            (struct Menu *menu, struct MailboxView *mv, enum MxStatus check, int oldcount, const struct IndexSharedData *shared);
@@ -0,0 +1,272 @@
+/**
+ * @file
+ * Cache of formatted Index lines
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @page index_line_cache Cache of formatted Index lines
+ *
+ * Formatting an Email using `$index_format` is expensive.  Scrolling and
+ * moving the cursor redraw the same Emails over and over, so the Index keeps
+ * the last line it formatted for each Email.
+ *
+ * Each line is stored alongside the state it depends upon: the Email's
+ * generation, the screen width, the format flags, the message number and the
+ * thread tree.  If any of these differ, the line will be formatted again.
+ *
+ * Everything else, e.g. config, colours, the Mailbox, is watched by the Index
+ * observers, which empty the cache when it changes.  The cache watches the
+ * Aliases itself: the reverse aliases change the names shown by `%F`, `%L`
+ * and `%n`.
+ *
+ * Emails are identified by their sequence number, which is unique.
+ */
+
+#include "config.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "core/lib.h"
+#include "line_cache.h"
+#include "format_flags.h"
+
+/**
+ * struct IndexLine - A formatted line of the Index
+ */
+struct IndexLine
+{
+  char *line;              ///< Formatted line
+  char *tree;              ///< Copy of the thread tree, Email::tree
+  size_t sequence;         ///< Email's sequence number
+  unsigned int generation; ///< Email's generation
+  int cols;                ///< Screen width
+  MuttFormatFlags flags;   ///< Flags, e.g. #MUTT_FORMAT_TREE
+  int msgno;               ///< Email's message number
+  int score;               ///< Email's score
+  size_t num_hidden;       ///< Number of hidden Emails, in a collapsed thread
+  bool collapsed      : 1; ///< Is the thread collapsed?
+  bool subject_changed: 1; ///< Does the subject differ from its parent's?
+  bool in_pager       : 1; ///< Is the Email displayed in the Pager?
+};
+
+/**
+ * struct IndexLineCache - Cache of formatted Index lines
+ */
+struct IndexLineCache
+{
+  struct HashTable *lines; ///< Hash Table: Email sequence -> IndexLine
+};
+
+/**
+ * index_line_free - Free an IndexLine - Implements ::hash_hdata_free_t - @ingroup hash_hdata_free_api
+ */
+static void index_line_free(int type, void *obj, intptr_t data)
+{
+  struct IndexLine *il = obj;
+
+  FREE(&il->line);
+  FREE(&il->tree);
+  FREE(&il);
+}
+
+/**
+ * index_line_matches - Was a line formatted using the same state?
+ * @param il        Cached line
+ * @param e         Email
+ * @param cols      Screen width
+ * @param flags     Flags, e.g. #MUTT_FORMAT_TREE
+ * @param in_pager  Email is displayed in the Pager
+ * @retval true The cached line is still valid
+ */
+static bool index_line_matches(const struct IndexLine *il, const struct Email *e,
+                               int cols, MuttFormatFlags flags, bool in_pager)
+{
+  return (il->sequence == e->sequence) && (il->generation == e->generation) &&
+         (il->cols == cols) && (il->flags == flags) && (il->msgno == e->msgno) &&
+         (il->score == e->score) && (il->num_hidden == e->num_hidden) &&
+         (il->collapsed == e->collapsed) &&
+         (il->subject_changed == e->subject_changed) &&
+         (il->in_pager == in_pager) && mutt_str_equal(il->tree, e->tree);
+}
+
+/**
+ * index_format_is_cacheable - Can the lines of an Index format be cached?
+ * @param fmt Format string, e.g. $index_format
+ * @retval true The lines only depend on the Emails
+ *
+ * Some expandos depend on the current time, e.g. `%<fmt>` and relative date
+ * conditionals, `%<[1d?...>`.  `index-format-hook` patterns may use relative
+ * dates too.
+ *
+ * @note Without a prefix, `%<` starts a conditional, e.g. `%<l?...>`
+ */
+bool index_format_is_cacheable(const char *fmt)
+{
+  if (!fmt)
+    return false;
+
+  for (const char *p = strchr(fmt, '%'); p; p = strchr(p, '%'))
+  {
+    p++;
+    if (*p == '%')
+    {
+      p++;
+      continue;
+    }
+
+    if ((*p == '?') || (*p == '<'))
+    {
+      p++;
+      if ((*p == '[') || (*p == '('))
+        return false;
+      continue;
+    }
+
+    p += strspn(p, "0123456789.-=_:");
+    if ((*p == '<') || (*p == '@'))
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * index_line_cache_alias_observer - Notification that an Alias has changed - Implements ::observer_t - @ingroup observer_api
+ */
+static int index_line_cache_alias_observer(struct NotifyCallback *nc)
+{
+  if (nc->event_type != NT_ALIAS)
+    return 0;
+  if (!nc->global_data)
+    return -1;
+
+  index_line_cache_reset(nc->global_data);
+  mutt_debug(LL_DEBUG5, "alias done\n");
+  return 0;
+}
+
+/**
+ * index_line_cache_new - Create a new IndexLineCache
+ * @retval ptr New IndexLineCache
+ */
+struct IndexLineCache *index_line_cache_new(void)
+{
+  struct IndexLineCache *lc = mutt_mem_calloc(1, sizeof(struct IndexLineCache));
+
+  if (NeoMutt)
+    notify_observer_add(NeoMutt->notify, NT_ALIAS, index_line_cache_alias_observer, lc);
+
+  return lc;
+}
+
+/**
+ * index_line_cache_reset - Forget all the cached lines
+ * @param lc IndexLineCache
+ */
+void index_line_cache_reset(struct IndexLineCache *lc)
+{
+  if (!lc)
+    return;
+
+  mutt_hash_free(&lc->lines);
+}
+
+/**
+ * index_line_cache_free - Free an IndexLineCache
+ * @param ptr IndexLineCache to free
+ */
+void index_line_cache_free(struct IndexLineCache **ptr)
+{
+  if (!ptr || !*ptr)
+    return;
+
+  if (NeoMutt)
+    notify_observer_remove(NeoMutt->notify, index_line_cache_alias_observer, *ptr);
+
+  index_line_cache_reset(*ptr);
+  FREE(ptr);
+}
+
+/**
+ * index_line_cache_get - Get the cached line for an Email
+ * @param lc        IndexLineCache
+ * @param e         Email
+ * @param cols      Screen width
+ * @param flags     Flags, e.g. #MUTT_FORMAT_TREE
+ * @param in_pager  Email is displayed in the Pager
+ * @retval ptr  Formatted line
+ * @retval NULL Line isn't cached, or is out of date
+ */
+const char *index_line_cache_get(struct IndexLineCache *lc, const struct Email *e,
+                                 int cols, MuttFormatFlags flags, bool in_pager)
+{
+  if (!lc || !lc->lines || !e)
+    return NULL;
+
+  const struct IndexLine *il = mutt_hash_int_find(lc->lines, e->sequence);
+  if (!il || !index_line_matches(il, e, cols, flags, in_pager))
+    return NULL;
+
+  return il->line;
+}
+
+/**
+ * index_line_cache_set - Cache the formatted line for an Email
+ * @param lc        IndexLineCache
+ * @param e         Email
+ * @param cols      Screen width
+ * @param flags     Flags, e.g. #MUTT_FORMAT_TREE
+ * @param in_pager  Email is displayed in the Pager
+ * @param line      Formatted line
+ */
+void index_line_cache_set(struct IndexLineCache *lc, const struct Email *e,
+                          int cols, MuttFormatFlags flags, bool in_pager, const char *line)
+{
+  if (!lc || !e || !line)
+    return;
+
+  if (!lc->lines)
+  {
+    lc->lines = mutt_hash_int_new(128, MUTT_HASH_NO_FLAGS);
+    mutt_hash_set_destructor(lc->lines, index_line_free, 0);
+  }
+
+  struct IndexLine *il = mutt_hash_int_find(lc->lines, e->sequence);
+  if (!il)
+  {
+    il = mutt_mem_calloc(1, sizeof(struct IndexLine));
+    mutt_hash_int_insert(lc->lines, e->sequence, il);
+  }
+
+  mutt_str_replace(&il->line, line);
+  mutt_str_replace(&il->tree, e->tree);
+  il->sequence = e->sequence;
+  il->generation = e->generation;
+  il->cols = cols;
+  il->flags = flags;
+  il->msgno = e->msgno;
+  il->score = e->score;
+  il->num_hidden = e->num_hidden;
+  il->collapsed = e->collapsed;
+  il->subject_changed = e->subject_changed;
+  il->in_pager = in_pager;
+}
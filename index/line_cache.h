@@ -0,0 +1,39 @@
+/**
+ * @file
+ * Cache of formatted Index lines
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUTT_INDEX_LINE_CACHE_H
+#define MUTT_INDEX_LINE_CACHE_H
+
+#include <stdbool.h>
+#include "format_flags.h"
+
+struct Email;
+struct IndexLineCache;
+
+bool                   index_format_is_cacheable(const char *fmt);
+void                   index_line_cache_free    (struct IndexLineCache **ptr);
+const char *           index_line_cache_get     (struct IndexLineCache *lc, const struct Email *e, int cols, MuttFormatFlags flags, bool in_pager);
+struct IndexLineCache *index_line_cache_new     (void);
+void                   index_line_cache_reset   (struct IndexLineCache *lc);
+void                   index_line_cache_set     (struct IndexLineCache *lc, const struct Email *e, int cols, MuttFormatFlags flags, bool in_pager, const char *line);
+
+#endif /* MUTT_INDEX_LINE_CACHE_H */
@@ -29,6 +29,7 @@
 #include "config.h"
 #include "mutt/lib.h"
 #include "private_data.h"
+#include "line_cache.h"
 
 /**
  * index_private_data_free - Free Private Index Data - Implements MuttWindow::wdata_free() - @ingroup window_wdata_free
@@ -38,6 +39,9 @@ void index_private_data_free(struct MuttWindow *win, void **ptr)
   if (!ptr || !*ptr)
     return;
 
+  struct IndexPrivateData *priv = *ptr;
+  index_line_cache_free(&priv->line_cache);
+
   FREE(ptr);
 }
 
@@ -52,6 +56,7 @@ struct IndexPrivateData *index_private_data_new(struct IndexSharedData *shared)
 
   priv->shared = shared;
   priv->oldcount = -1;
+  priv->line_cache = index_line_cache_new();
 
   return priv;
 }
@@ -25,6 +25,7 @@
 
 #include <stdbool.h>
 
+struct IndexLineCache;
 struct IndexSharedData;
 struct MuttWindow;
 
@@ -40,6 +41,7 @@ struct IndexPrivateData
   struct IndexSharedData *shared; ///< Shared Index data
   struct Menu *menu;              ///< Menu controlling the index
   struct MuttWindow *win_index;   ///< Window for the Index
+  struct IndexLineCache *line_cache; ///< Cache of formatted lines
 };
 
 void                     index_private_data_free(struct MuttWindow *win, void **ptr);
@@ -37,6 +37,7 @@
 #include "mutt/lib.h"
 #include "config/lib.h"
 #include "email/lib.h"
+#include "core/lib.h"
 #include "mailbox.h"
 #include "progress/lib.h"
 #include "edata.h"
@@ -50,6 +51,9 @@
 #include "monitor.h"
 #endif
 
+/// Handle for $flag_safe
+static struct ConfigHandle HandleFlagSafe = CONFIG_HANDLE("flag_safe");
+
 struct Progress;
 
 // Flags for maildir_check()
@@ -116,7 +120,7 @@ void maildir_parse_flags(struct Email *e, const char *path)
 
         case 'T': // Trashed
         {
-          const bool c_flag_safe = cs_subset_bool(NeoMutt->sub, "flag_safe");
+          const bool c_flag_safe = cc_bool(&HandleFlagSafe);
           if (!e->flagged || !c_flag_safe)
           {
             e->trash = true;
@@ -467,6 +467,26 @@ static void log_gui(void)
              RootWindow->state.rows);
 }
 
+/**
+ * save_debug_stats - Save the timing stats to $debug_stats_file
+ */
+static void save_debug_stats(void)
+{
+  const char *const c_debug_stats_file = cs_subset_path(NeoMutt->sub, "debug_stats_file");
+  if (!c_debug_stats_file)
+    return;
+
+  FILE *fp = mutt_file_fopen(c_debug_stats_file, "w");
+  if (!fp)
+  {
+    mutt_perror("%s", c_debug_stats_file);
+    return;
+  }
+
+  stats_dump_json(fp);
+  mutt_file_fclose(&fp);
+}
+
 /**
  * main_timeout_observer - Notification that a timeout has occurred - Implements ::observer_t - @ingroup observer_api
  */
@@ -899,6 +919,7 @@ main
     mutt_curses_set_color_by_id(MT_COLOR_NORMAL);
     clear();
     MuttLogger = log_disp_curses;
+    MuttLogLevel = cs_subset_number(NeoMutt->sub, "debug_level");
     log_queue_flush(log_disp_curses);
     log_queue_set_max_size(100);
   }
@@ -1418,6 +1439,7 @@ main_curses:
 main_exit:
   if (NeoMutt && NeoMutt->sub)
   {
+    save_debug_stats();
     notify_observer_remove(NeoMutt->sub->notify, main_hist_observer, NULL);
     notify_observer_remove(NeoMutt->sub->notify, main_log_observer, NULL);
     notify_observer_remove(NeoMutt->sub->notify, main_config_observer, NULL);
@@ -1425,6 +1447,7 @@ main_exit:
   }
   mutt_list_free(&commands);
   MuttLogger = log_disp_queue;
+  MuttLogLevel = LL_MAX;
   buf_dealloc(&folder);
   buf_dealloc(&expanded_infile);
   buf_dealloc(&tempfile);
@@ -1436,6 +1459,7 @@ main_exit:
   mutt_browser_cleanup();
   external_cleanup();
   menu_cleanup();
+  mutt_expando_cleanup();
   crypt_cleanup();
   mutt_ch_cache_cleanup();
   mutt_opts_cleanup();
@@ -1446,6 +1470,7 @@ main_exit:
   mutt_prex_cleanup();
   config_cache_cleanup();
   neomutt_free(&NeoMutt);
+  mutt_intern_cleanup();
   cs_free(&cs);
   log_queue_flush(log_disp_terminal);
   mutt_log_stop();
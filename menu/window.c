@@ -74,6 +74,9 @@
 #include "lib.h"
 #include "type.h"
 
+/// Time spent repainting Menus
+static struct StatsEntry StatsMenuRepaint = STATS_ENTRY("menu_repaint");
+
 /**
  * menu_recalc - Recalculate the Window data - Implements MuttWindow::recalc() - @ingroup window_recalc
  */
@@ -95,6 +98,7 @@ static int menu_repaint(struct MuttWindow *win)
   if (win->type != WT_MENU)
     return 0;
 
+  const uint64_t start = stats_timer_start();
   struct Menu *menu = win->wdata;
   menu->redraw |= MENU_REDRAW_FULL;
   menu_redraw(menu);
@@ -119,6 +123,7 @@ static int menu_repaint(struct MuttWindow *win)
     mutt_window_move(menu->win, menu->win->state.cols - 1, menu->current - menu->top);
   }
 
+  stats_timer_stop(&StatsMenuRepaint, start);
   mutt_debug(LL_DEBUG5, "repaint done\n");
   return 0;
 }
@@ -31,6 +31,7 @@
  */
 
 #include "config.h"
+#include <string.h>
 #include "base64.h"
 #include "buffer.h"
 #include "memory.h"
@@ -57,8 +58,10 @@ static const char B64Chars[64] = {
  * Encoding chars:
  * * utf7 A-Za-z0-9+,
  * * mime A-Za-z0-9+/
+ *
+ * The table covers every byte value, so it can be used without a range check.
  */
-const int Index64[128] = {
+const int Index64[256] = {
   // clang-format off
   -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
   -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
@@ -67,7 +70,15 @@ const int Index64[128] = {
   -1, 0, 1, 2,  3, 4, 5, 6,  7, 8, 9,10, 11,12,13,14,
   15,16,17,18, 19,20,21,22, 23,24,25,-1, -1,-1,-1,-1,
   -1,26,27,28, 29,30,31,32, 33,34,35,36, 37,38,39,40,
-  41,42,43,44, 45,46,47,48, 49,50,51,-1, -1,-1,-1,-1
+  41,42,43,44, 45,46,47,48, 49,50,51,-1, -1,-1,-1,-1,
+  -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
+  -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
+  -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
+  -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
+  -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
+  -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
+  -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
+  -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
   // clang-format on
 };
 
@@ -120,6 +131,44 @@ size_t mutt_b64_encode(const char *in, size_t inlen, char *out, size_t outlen)
   return out - (char *) begin;
 }
 
+/**
+ * mutt_b64_decode_quads - Decode complete groups of base64 characters
+ * @param[in]  in    Base64-encoded text
+ * @param[in]  inlen Length of the text
+ * @param[out] out   Buffer for the raw bytes, at least (inlen / 4) * 3 bytes
+ * @retval num Number of characters decoded, a multiple of 4
+ *
+ * Each group of four characters becomes three bytes.  Decoding stops at the
+ * first group that contains anything else, e.g. padding or a newline, so the
+ * caller can deal with it.
+ */
+size_t mutt_b64_decode_quads(const char *in, size_t inlen, char *out)
+{
+  if (!in || !out)
+    return 0;
+
+  const unsigned char *inu = (const unsigned char *) in;
+  const unsigned char *end = inu + (inlen & ~(size_t) 3);
+  const unsigned char *start = inu;
+
+  for (; inu < end; inu += 4)
+  {
+    const int c1 = base64val(inu[0]);
+    const int c2 = base64val(inu[1]);
+    const int c3 = base64val(inu[2]);
+    const int c4 = base64val(inu[3]);
+    if ((c1 | c2 | c3 | c4) < 0)
+      break;
+
+    const unsigned int triple = (c1 << 18) | (c2 << 12) | (c3 << 6) | c4;
+    *out++ = triple >> 16;
+    *out++ = triple >> 8;
+    *out++ = triple;
+  }
+
+  return inu - start;
+}
+
 /**
  * mutt_b64_decode - Convert null-terminated base64 string to raw bytes
  * @param in   Input  buffer for the null-terminated base64-encoded string
@@ -137,7 +186,11 @@ int mutt_b64_decode(const char *in, char *out, size_t olen)
   if (!in || !*in || !out)
     return -1;
 
-  int len = 0;
+  /* decode the bulk of the text, as many complete groups as will fit */
+  size_t num = mutt_b64_decode_quads(in, MIN(strlen(in), (olen / 3) * 4), out);
+  in += num;
+  out += (num / 4) * 3;
+  int len = (num / 4) * 3;
 
   for (; *in; in += 4)
   {
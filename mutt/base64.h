@@ -31,6 +31,7 @@ extern const int Index64[];
 #define base64val(ch) Index64[(unsigned int) (ch)]
 
 int    mutt_b64_decode(const char *in, char *out, size_t olen);
+size_t mutt_b64_decode_quads(const char *in, size_t inlen, char *out);
 size_t mutt_b64_encode(const char *in, size_t inlen, char *out, size_t outlen);
 
 int    mutt_b64_buffer_decode(struct Buffer *buf, const char *in);
@@ -0,0 +1,216 @@
+/**
+ * @file
+ * Dense set of bits
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @page mutt_bitset Dense set of bits
+ *
+ * A Bitset stores one bit per item, 64 to a word.  Counting the set bits, or
+ * finding the next set bit, skips over whole words at a time.
+ */
+
+#include "config.h"
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "bitset.h"
+#include "memory.h"
+
+/// Number of bits in a word
+#define BITSET_WORD_BITS 64
+
+/**
+ * bitset_words - Calculate the number of words needed
+ * @param size Number of bits
+ * @retval num Number of words
+ */
+static size_t bitset_words(size_t size)
+{
+  return (size + BITSET_WORD_BITS - 1) / BITSET_WORD_BITS;
+}
+
+/**
+ * popcount - Count the set bits in a word
+ * @param w Word
+ * @retval num Number of set bits
+ */
+static size_t popcount(uint64_t w)
+{
+  w = w - ((w >> 1) & 0x5555555555555555ULL);
+  w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+  w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return (w * 0x0101010101010101ULL) >> 56;
+}
+
+/**
+ * ctz - Count the trailing clear bits in a word
+ * @param w Word, must not be zero
+ * @retval num Index of the lowest set bit
+ */
+static size_t ctz(uint64_t w)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(w);
+#else
+  // Isolate the lowest set bit, then look it up with a de Bruijn sequence
+  // clang-format off
+  static const unsigned char index[64] = {
+    0,  1,  48, 2,  57, 49, 28, 3,  61, 58, 50, 42, 38, 29, 17, 4,
+    62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+    63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+    46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9,  13, 8,  7,  6,
+  };
+  // clang-format on
+  return index[((w & -w) * 0x03F79D71B4CB0A89ULL) >> 58];
+#endif
+}
+
+/**
+ * bitset_count - Count the set bits
+ * @param bs Bitset
+ * @retval num Number of set bits
+ */
+size_t bitset_count(const struct Bitset *bs)
+{
+  if (!bs || !bs->words)
+    return 0;
+
+  size_t count = 0;
+  const size_t num = bitset_words(bs->size);
+  for (size_t i = 0; i < num; i++)
+    count += popcount(bs->words[i]);
+
+  return count;
+}
+
+/**
+ * bitset_free - Free the memory of a Bitset
+ * @param bs Bitset
+ *
+ * @note The Bitset itself isn't freed
+ */
+void bitset_free(struct Bitset *bs)
+{
+  if (!bs)
+    return;
+
+  FREE(&bs->words);
+  bs->size = 0;
+}
+
+/**
+ * bitset_get - Get the value of a bit
+ * @param bs  Bitset
+ * @param idx Index of the bit
+ * @retval true The bit is set
+ */
+bool bitset_get(const struct Bitset *bs, size_t idx)
+{
+  if (!bs || (idx >= bs->size))
+    return false;
+
+  return bs->words[idx / BITSET_WORD_BITS] & ((uint64_t) 1 << (idx % BITSET_WORD_BITS));
+}
+
+/**
+ * bitset_next - Find the next set bit
+ * @param bs  Bitset
+ * @param idx Index to start searching from
+ * @retval num Index of the next set bit, or the size of the Bitset if there aren't any
+ */
+size_t bitset_next(const struct Bitset *bs, size_t idx)
+{
+  if (!bs || (idx >= bs->size))
+    return bs ? bs->size : 0;
+
+  size_t wi = idx / BITSET_WORD_BITS;
+  uint64_t w = bs->words[wi] & (~(uint64_t) 0 << (idx % BITSET_WORD_BITS));
+
+  const size_t num = bitset_words(bs->size);
+  while (w == 0)
+  {
+    if (++wi == num)
+      return bs->size;
+    w = bs->words[wi];
+  }
+
+  return MIN((wi * BITSET_WORD_BITS) + ctz(w), bs->size);
+}
+
+/**
+ * bitset_reset - Clear all the bits
+ * @param bs Bitset
+ */
+void bitset_reset(struct Bitset *bs)
+{
+  if (!bs || !bs->words)
+    return;
+
+  memset(bs->words, 0, bitset_words(bs->size) * sizeof(uint64_t));
+}
+
+/**
+ * bitset_resize - Change the number of bits
+ * @param bs   Bitset
+ * @param size New number of bits
+ *
+ * Any new bits will be clear.
+ */
+void bitset_resize(struct Bitset *bs, size_t size)
+{
+  if (!bs)
+    return;
+
+  const size_t old_num = bitset_words(bs->size);
+  const size_t new_num = bitset_words(size);
+
+  // Clear the unused bits of the last word
+  if ((size < bs->size) && (size % BITSET_WORD_BITS))
+    bs->words[new_num - 1] &= ((uint64_t) 1 << (size % BITSET_WORD_BITS)) - 1;
+
+  if (new_num != old_num)
+  {
+    mutt_mem_realloc(&bs->words, new_num * sizeof(uint64_t));
+    if (new_num > old_num)
+      memset(bs->words + old_num, 0, (new_num - old_num) * sizeof(uint64_t));
+  }
+
+  bs->size = size;
+}
+
+/**
+ * bitset_set - Set or clear a bit
+ * @param bs    Bitset
+ * @param idx   Index of the bit
+ * @param value Value of the bit
+ */
+void bitset_set(struct Bitset *bs, size_t idx, bool value)
+{
+  if (!bs || (idx >= bs->size))
+    return;
+
+  const uint64_t bit = (uint64_t) 1 << (idx % BITSET_WORD_BITS);
+  if (value)
+    bs->words[idx / BITSET_WORD_BITS] |= bit;
+  else
+    bs->words[idx / BITSET_WORD_BITS] &= ~bit;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file
+ * Dense set of bits
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUTT_MUTT_BITSET_H
+#define MUTT_MUTT_BITSET_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * struct Bitset - Dense set of bits
+ */
+struct Bitset
+{
+  uint64_t *words; ///< Storage for the bits
+  size_t size;     ///< Number of bits
+};
+
+size_t bitset_count (const struct Bitset *bs);
+void   bitset_free  (struct Bitset *bs);
+bool   bitset_get   (const struct Bitset *bs, size_t idx);
+size_t bitset_next  (const struct Bitset *bs, size_t idx);
+void   bitset_reset (struct Bitset *bs);
+void   bitset_resize(struct Bitset *bs, size_t size);
+void   bitset_set   (struct Bitset *bs, size_t idx, bool value);
+
+#endif /* MUTT_MUTT_BITSET_H */
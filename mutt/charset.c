@@ -82,14 +82,37 @@ TAILQ_HEAD(LookupList, Lookup);
 /// Lookup table of preferred character set names
 static struct LookupList Lookups = TAILQ_HEAD_INITIALIZER(Lookups);
 
+/// Incremented whenever the Lookups change
+static unsigned int LookupGeneration = 0;
+
+/**
+ * enum IconvFastPath - Conversions that can be done without iconv()
+ */
+enum IconvFastPath
+{
+  ICONV_FAST_NONE = 0, ///< Use iconv()
+  ICONV_FAST_ASCII,    ///< us-ascii to utf-8
+  ICONV_FAST_UTF8,     ///< utf-8 to utf-8
+  ICONV_FAST_LATIN1,   ///< iso-8859-1 to utf-8
+};
+
 /**
  * struct IconvCacheEntry - Cached iconv conversion descriptor
+ *
+ * The entry can be found by the canonical names of the character sets, or by
+ * the names the caller used last time.  The latter are only valid while the
+ * charset-hooks are unchanged.
  */
 struct IconvCacheEntry
 {
-  char *fromcode1; ///< Source character set
-  char *tocode1;   ///< Destination character set
-  iconv_t cd;      ///< iconv conversion descriptor
+  char *fromcode1;           ///< Source character set
+  char *tocode1;             ///< Destination character set
+  iconv_t cd;                ///< iconv conversion descriptor
+  char *fromcode;            ///< Source character set, as requested
+  char *tocode;              ///< Destination character set, as requested
+  uint8_t flags;             ///< Flags, e.g. #MUTT_ICONV_HOOK_FROM
+  unsigned int generation;   ///< LookupGeneration of the requested names
+  enum IconvFastPath fast;   ///< Conversion that doesn't need iconv()
 };
 
 /// Max size of the iconv cache
@@ -443,6 +466,9 @@ bool mutt_ch_chscmp(const char *cs1, const char *cs2)
   if (!cs1 || !cs2)
     return false;
 
+  if (mutt_istr_equal(cs1, cs2))
+    return true;
+
   char buf[256] = { 0 };
 
   mutt_ch_canonical_charset(buf, sizeof(buf), cs1);
@@ -528,6 +554,7 @@ bool mutt_ch_lookup_add(enum LookupType type, const char *pat,
   l->regex.pat_not = false;
 
   TAILQ_INSERT_TAIL(&Lookups, l, entries);
+  LookupGeneration++;
 
   return true;
 }
@@ -547,6 +574,7 @@ void mutt_ch_lookup_remove(void)
     TAILQ_REMOVE(&Lookups, l, entries);
     lookup_free(&l);
   }
+  LookupGeneration++;
 }
 
 /**
@@ -563,6 +591,70 @@ const char *mutt_ch_charset_lookup(const char *chs)
   return lookup_charset(MUTT_LOOKUP_CHARSET, chs);
 }
 
+/**
+ * iconv_fast_path - Can a conversion be done without iconv()?
+ * @param tocode   Destination character set, as passed to iconv_open()
+ * @param fromcode Source character set, as passed to iconv_open()
+ * @retval enum Conversion, e.g. #ICONV_FAST_UTF8
+ */
+static enum IconvFastPath iconv_fast_path(const char *tocode, const char *fromcode)
+{
+  if (!mutt_istr_equal(tocode, "utf-8"))
+    return ICONV_FAST_NONE;
+
+  if (mutt_istr_equal(fromcode, "utf-8"))
+    return ICONV_FAST_UTF8;
+  if (mutt_istr_equal(fromcode, "us-ascii"))
+    return ICONV_FAST_ASCII;
+  if (mutt_istr_equal(fromcode, "iso-8859-1"))
+    return ICONV_FAST_LATIN1;
+
+  return ICONV_FAST_NONE;
+}
+
+/**
+ * iconv_cache_set_names - Remember the names a caller used for a conversion
+ * @param ice      Cache entry
+ * @param tocode   Destination character set
+ * @param fromcode Source character set
+ * @param flags    Flags, e.g. #MUTT_ICONV_HOOK_FROM
+ */
+static void iconv_cache_set_names(struct IconvCacheEntry *ice, const char *tocode,
+                                  const char *fromcode, uint8_t flags)
+{
+  mutt_str_replace(&ice->tocode, tocode);
+  mutt_str_replace(&ice->fromcode, fromcode);
+  ice->flags = flags;
+  ice->generation = LookupGeneration;
+}
+
+/**
+ * iconv_cache_use - Use a cached iconv descriptor
+ * @param i Index into the cache
+ * @retval ptr iconv handle
+ *
+ * The entry is moved to the top of the cache and the descriptor is reset.
+ */
+static iconv_t iconv_cache_use(int i)
+{
+  iconv_t cd = IconvCache[i].cd;
+
+  /* make room for this one at the top */
+  struct IconvCacheEntry top = IconvCache[i];
+  for (int j = i; j-- > 0;)
+  {
+    IconvCache[j + 1] = IconvCache[j];
+  }
+  IconvCache[0] = top;
+
+  if (iconv_t_valid(cd))
+  {
+    /* reset state */
+    iconv(cd, NULL, NULL, NULL, NULL);
+  }
+  return cd;
+}
+
 /**
  * mutt_ch_iconv_open - Set up iconv for conversions
  * @param tocode   Current character set
@@ -580,7 +672,8 @@ const char *mutt_ch_charset_lookup(const char *chs)
  * in some setups.
  *
  * Since calling iconv_open() repeatedly can be expensive, we keep a cache of
- * the most recently used iconv_t objects, kept in LRU order. This means that
+ * the most recently used iconv_t objects, kept in LRU order.  Repeated calls
+ * with the same names don't need to canonicalise them again. This means that
  * you should not call iconv_close() on the object yourself. All remaining
  * objects in the cache will exit when main() calls mutt_ch_cache_cleanup().
  *
@@ -592,6 +685,17 @@ const char *mutt_ch_charset_lookup(const char *chs)
  */
 iconv_t mutt_ch_iconv_open(const char *tocode, const char *fromcode, uint8_t flags)
 {
+  /* check if we've been asked for these names before */
+  for (int i = 0; i < IconvCacheUsed; ++i)
+  {
+    const struct IconvCacheEntry *ice = &IconvCache[i];
+    if ((ice->generation == LookupGeneration) && (ice->flags == flags) &&
+        mutt_str_equal(tocode, ice->tocode) && mutt_str_equal(fromcode, ice->fromcode))
+    {
+      return iconv_cache_use(i);
+    }
+  }
+
   char tocode1[128] = { 0 };
   char fromcode1[128] = { 0 };
   const char *tocode2 = NULL, *fromcode2 = NULL;
@@ -617,22 +721,8 @@ iconv_t mutt_ch_iconv_open(const char *tocode, const char *fromcode, uint8_t fla
     if (strcmp(tocode1, IconvCache[i].tocode1) == 0 &&
         strcmp(fromcode1, IconvCache[i].fromcode1) == 0)
     {
-      iconv_t cd = IconvCache[i].cd;
-
-      /* make room for this one at the top */
-      struct IconvCacheEntry top = IconvCache[i];
-      for (int j = i; j-- > 0;)
-      {
-        IconvCache[j + 1] = IconvCache[j];
-      }
-      IconvCache[0] = top;
-
-      if (iconv_t_valid(cd))
-      {
-        /* reset state */
-        iconv(cd, NULL, NULL, NULL, NULL);
-      }
-      return cd;
+      iconv_cache_set_names(&IconvCache[i], tocode, fromcode, flags);
+      return iconv_cache_use(i);
     }
   }
 
@@ -654,6 +744,8 @@ iconv_t mutt_ch_iconv_open(const char *tocode, const char *fromcode, uint8_t fla
     /* get rid of the oldest entry */
     FREE(&IconvCache[IconvCacheUsed - 1].fromcode1);
     FREE(&IconvCache[IconvCacheUsed - 1].tocode1);
+    FREE(&IconvCache[IconvCacheUsed - 1].fromcode);
+    FREE(&IconvCache[IconvCacheUsed - 1].tocode);
     if (iconv_t_valid(IconvCache[IconvCacheUsed - 1].cd))
     {
       iconv_close(IconvCache[IconvCacheUsed - 1].cd);
@@ -673,10 +765,191 @@ iconv_t mutt_ch_iconv_open(const char *tocode, const char *fromcode, uint8_t fla
   IconvCache[0].fromcode1 = strdup(fromcode1);
   IconvCache[0].tocode1 = strdup(tocode1);
   IconvCache[0].cd = cd;
+  IconvCache[0].fromcode = NULL;
+  IconvCache[0].tocode = NULL;
+  iconv_cache_set_names(&IconvCache[0], tocode, fromcode, flags);
+  IconvCache[0].fast = iconv_t_valid(cd) ? iconv_fast_path(tocode2, fromcode2) :
+                                           ICONV_FAST_NONE;
 
   return cd;
 }
 
+/**
+ * ascii_len - Count the leading ASCII characters of a string
+ * @param str String
+ * @param len Length of the string
+ * @retval num Number of ASCII characters
+ */
+static size_t ascii_len(const char *str, size_t len)
+{
+  size_t i = 0;
+
+  /* check eight characters at a time */
+  for (; (i + sizeof(uint64_t)) <= len; i += sizeof(uint64_t))
+  {
+    uint64_t word;
+    memcpy(&word, str + i, sizeof(word));
+    if (word & 0x8080808080808080ULL)
+      break;
+  }
+
+  while ((i < len) && !(str[i] & 0x80))
+    i++;
+
+  return i;
+}
+
+/**
+ * utf8_valid_len - Count the leading valid utf-8 characters of a string
+ * @param str String
+ * @param len Length of the string
+ * @retval num Number of bytes of complete, valid characters
+ *
+ * Overlong encodings, surrogates and characters beyond U+10FFFF are invalid.
+ */
+static size_t utf8_valid_len(const char *str, size_t len)
+{
+  const unsigned char *s = (const unsigned char *) str;
+  size_t i = 0;
+
+  while (i < len)
+  {
+    i += ascii_len(str + i, len - i);
+    if (i == len)
+      break;
+
+    /* valid range of the second byte */
+    unsigned char lo = 0x80;
+    unsigned char hi = 0xBF;
+    size_t n;
+
+    const unsigned char c = s[i];
+    if ((c >= 0xC2) && (c <= 0xDF))
+      n = 2;
+    else if (c == 0xE0)
+    {
+      n = 3;
+      lo = 0xA0;
+    }
+    else if (c == 0xED)
+    {
+      n = 3;
+      hi = 0x9F;
+    }
+    else if ((c >= 0xE1) && (c <= 0xEF))
+      n = 3;
+    else if (c == 0xF0)
+    {
+      n = 4;
+      lo = 0x90;
+    }
+    else if ((c >= 0xF1) && (c <= 0xF3))
+      n = 4;
+    else if (c == 0xF4)
+    {
+      n = 4;
+      hi = 0x8F;
+    }
+    else
+      break;
+
+    if (((i + n) > len) || (s[i + 1] < lo) || (s[i + 1] > hi))
+      break;
+    if ((n > 2) && ((s[i + 2] & 0xC0) != 0x80))
+      break;
+    if ((n > 3) && ((s[i + 3] & 0xC0) != 0x80))
+      break;
+
+    i += n;
+  }
+
+  return i;
+}
+
+/**
+ * iconv_fast - Convert the start of a string without using iconv()
+ * @param[in]     fast         Conversion, e.g. #ICONV_FAST_UTF8
+ * @param[in,out] inbuf        Buffer to convert
+ * @param[in,out] inbytesleft  Length of buffer to convert
+ * @param[in,out] outbuf       Buffer for the result
+ * @param[in,out] outbytesleft Length of result buffer
+ *
+ * Conversion stops at anything that iconv() needs to deal with, e.g. an
+ * invalid or incomplete character, or when the output buffer is full.
+ */
+static void iconv_fast(enum IconvFastPath fast, const char **inbuf,
+                       size_t *inbytesleft, char **outbuf, size_t *outbytesleft)
+{
+  const char *ib = *inbuf;
+  size_t ibl = *inbytesleft;
+  char *ob = *outbuf;
+  size_t obl = *outbytesleft;
+  size_t n;
+
+  switch (fast)
+  {
+    case ICONV_FAST_ASCII:
+    case ICONV_FAST_UTF8:
+      if (fast == ICONV_FAST_ASCII)
+        n = ascii_len(ib, MIN(ibl, obl));
+      else
+        n = utf8_valid_len(ib, MIN(ibl, obl));
+      memcpy(ob, ib, n);
+      ib += n;
+      ibl -= n;
+      ob += n;
+      obl -= n;
+      break;
+
+    case ICONV_FAST_LATIN1:
+      while (true)
+      {
+        n = ascii_len(ib, MIN(ibl, obl));
+        memcpy(ob, ib, n);
+        ib += n;
+        ibl -= n;
+        ob += n;
+        obl -= n;
+        if ((ibl == 0) || (obl < 2))
+          break;
+
+        const unsigned char c = *ib++;
+        ibl--;
+        *ob++ = 0xC0 | (c >> 6);
+        *ob++ = 0x80 | (c & 0x3F);
+        obl -= 2;
+      }
+      break;
+
+    default:
+      return;
+  }
+
+  *inbuf = ib;
+  *inbytesleft = ibl;
+  *outbuf = ob;
+  *outbytesleft = obl;
+}
+
+/**
+ * iconv_find_fast_path - Find the fast path for an iconv descriptor
+ * @param cd iconv conversion descriptor
+ * @retval enum Conversion, e.g. #ICONV_FAST_UTF8
+ */
+static enum IconvFastPath iconv_find_fast_path(iconv_t cd)
+{
+  if (!iconv_t_valid(cd))
+    return ICONV_FAST_NONE;
+
+  for (int i = 0; i < IconvCacheUsed; ++i)
+  {
+    if (IconvCache[i].cd == cd)
+      return IconvCache[i].fast;
+  }
+
+  return ICONV_FAST_NONE;
+}
+
 /**
  * mutt_ch_iconv - Change the encoding of a string
  * @param[in]     cd           Iconv conversion descriptor
@@ -692,6 +965,9 @@ iconv_t mutt_ch_iconv_open(const char *tocode, const char *fromcode, uint8_t fla
  * Like iconv, but keeps going even when the input is invalid
  * If you're supplying inrepls, the source charset should be stateless;
  * if you're supplying an outrepl, the target charset should be.
+ *
+ * Conversions from us-ascii, utf-8 and iso-8859-1 to utf-8 are done without
+ * iconv(), as far as possible.
  */
 size_t mutt_ch_iconv(iconv_t cd, const char **inbuf, size_t *inbytesleft,
                      char **outbuf, size_t *outbytesleft, const char **inrepls,
@@ -702,9 +978,12 @@ size_t mutt_ch_iconv(iconv_t cd, const char **inbuf, size_t *inbytesleft,
   size_t ibl = *inbytesleft;
   char *ob = *outbuf;
   size_t obl = *outbytesleft;
+  const enum IconvFastPath fast = iconv_find_fast_path(cd);
 
   while (true)
   {
+    iconv_fast(fast, &ib, &ibl, &ob, &obl);
+
     errno = 0;
     const size_t ret1 = iconv(cd, (ICONV_CONST char **) &ib, &ibl, &ob, &obl);
     if (ret1 != ICONV_ILLEGAL_SEQ)
@@ -1180,6 +1459,8 @@ void mutt_ch_cache_cleanup(void)
   {
     FREE(&IconvCache[i].fromcode1);
     FREE(&IconvCache[i].tocode1);
+    FREE(&IconvCache[i].fromcode);
+    FREE(&IconvCache[i].tocode);
     if (iconv_t_valid(IconvCache[i].cd))
     {
       iconv_close(IconvCache[i].cd);
@@ -25,34 +25,65 @@
  * @page mutt_hash Hash Table data structure
  *
  * Hash Table data structure.
+ *
+ * Each element stores the full hash of its key, so the Hash Table can be
+ * resized without rehashing the keys, and most mismatches are rejected without
+ * comparing the keys.
+ *
+ * The number of buckets is always a power of two.  When the average chain
+ * length exceeds #HASH_MAX_LOAD, the number of buckets is doubled.
+ *
+ * @note Don't insert elements while walking the Hash Table.
  */
 
 #include "config.h"
 #include <ctype.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include "hash.h"
 #include "memory.h"
 #include "string2.h"
 
-#define SOME_PRIME 149711
+/// Maximum number of elements per bucket, on average, before the table grows
+#define HASH_MAX_LOAD 1
+
+/**
+ * hash_mix - Scramble the bits of a hash
+ * @param hash Hash to scramble
+ * @retval num Scrambled hash
+ *
+ * The bucket is chosen using the low bits of the hash, so make sure that every
+ * bit of the input affects them.
+ */
+static inline size_t hash_mix(uint64_t hash)
+{
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return (size_t) hash;
+}
 
 /**
  * gen_hash_string - Generate a hash from a string - Implements ::hash_gen_hash_t - @ingroup hash_gen_hash_api
  *
  * @note If the key is NULL or empty, the retval will be 0
  */
-static size_t gen_hash_string(union HashKey key, size_t num_elems)
+static size_t gen_hash_string(union HashKey key)
 {
-  size_t hash = 0;
   const unsigned char *s = (const unsigned char *) key.strkey;
-  if (!s)
+  if (!s || (*s == '\0'))
     return 0;
 
+  uint64_t hash = 0xcbf29ce484222325ULL; // FNV-1a
   while (*s != '\0')
-    hash += ((hash << 7) + *s++);
-  hash = (hash * SOME_PRIME) % num_elems;
+  {
+    hash ^= *s++;
+    hash *= 0x100000001b3ULL;
+  }
 
-  return hash;
+  return hash_mix(hash);
 }
 
 /**
@@ -68,18 +99,20 @@ static int cmp_key_string(union HashKey a, union HashKey b)
  *
  * @note If the key is NULL or empty, the retval will be 0
  */
-static size_t gen_hash_case_string(union HashKey key, size_t num_elems)
+static size_t gen_hash_case_string(union HashKey key)
 {
-  size_t hash = 0;
   const unsigned char *s = (const unsigned char *) key.strkey;
-  if (!s)
+  if (!s || (*s == '\0'))
     return 0;
 
+  uint64_t hash = 0xcbf29ce484222325ULL; // FNV-1a
   while (*s != '\0')
-    hash += ((hash << 7) + tolower(*s++));
-  hash = (hash * SOME_PRIME) % num_elems;
+  {
+    hash ^= (unsigned char) tolower(*s++);
+    hash *= 0x100000001b3ULL;
+  }
 
-  return hash;
+  return hash_mix(hash);
 }
 
 /**
@@ -93,9 +126,9 @@ static int cmp_key_case_string(union HashKey a, union HashKey b)
 /**
  * gen_hash_int - Generate a hash from an integer - Implements ::hash_gen_hash_t - @ingroup hash_gen_hash_api
  */
-static size_t gen_hash_int(union HashKey key, size_t num_elems)
+static size_t gen_hash_int(union HashKey key)
 {
-  return (key.intkey % num_elems);
+  return hash_mix(key.intkey);
 }
 
 /**
@@ -115,26 +148,79 @@ static int cmp_key_int(union HashKey a, union HashKey b)
  * @param num_elems Number of elements it should contain
  * @retval ptr New Hash Table
  *
- * The Hash Table can contain more elements than num_elems, but they will be
- * chained together.
+ * The number of buckets is rounded up to a power of two.
+ * The Hash Table will grow as elements are added.
  */
 static struct HashTable *hash_new(size_t num_elems)
 {
   struct HashTable *table = mutt_mem_calloc(1, sizeof(struct HashTable));
-  if (num_elems == 0)
-    num_elems = 2;
-  table->num_elems = num_elems;
-  table->table = mutt_mem_calloc(num_elems, sizeof(struct HashElem *));
+  size_t size = 2;
+  while (size < num_elems)
+    size <<= 1;
+  table->num_elems = size;
+  table->table = mutt_mem_calloc(size, sizeof(struct HashElem *));
   return table;
 }
 
+/**
+ * hash_bucket - Get the bucket for a hash
+ * @param table Hash Table
+ * @param hash  Hash of the key
+ * @retval num Index of the bucket
+ */
+static inline size_t hash_bucket(const struct HashTable *table, size_t hash)
+{
+  return hash & (table->num_elems - 1);
+}
+
+/**
+ * hash_grow - Double the number of buckets in a Hash Table
+ * @param table Hash Table to resize
+ *
+ * Each chain is split in two, preserving the order of its elements, so
+ * duplicate keys are still found in the order they were inserted.
+ */
+static void hash_grow(struct HashTable *table)
+{
+  const size_t old_size = table->num_elems;
+  struct HashElem **old_table = table->table;
+
+  table->num_elems = old_size * 2;
+  table->table = mutt_mem_calloc(table->num_elems, sizeof(struct HashElem *));
+
+  for (size_t i = 0; i < old_size; i++)
+  {
+    struct HashElem **lo = &table->table[i];
+    struct HashElem **hi = &table->table[i + old_size];
+
+    for (struct HashElem *he = old_table[i], *next = NULL; he; he = next)
+    {
+      next = he->next;
+      he->next = NULL;
+      if (hash_bucket(table, he->hash) == i)
+      {
+        *lo = he;
+        lo = &he->next;
+      }
+      else
+      {
+        *hi = he;
+        hi = &he->next;
+      }
+    }
+  }
+
+  FREE(&old_table);
+}
+
 /**
  * union_hash_insert - Insert into a hash table using a union as a key
  * @param table Hash Table to update
  * @param key   Key to hash on
  * @param type  Data type
  * @param data  Data to associate with key
- * @retval ptr Newly inserted HashElem
+ * @retval ptr  Newly inserted HashElem
+ * @retval NULL The key already exists (and duplicates aren't allowed)
  */
 static struct HashElem *union_hash_insert(struct HashTable *table,
                                           union HashKey key, int type, void *data)
@@ -142,38 +228,31 @@ static struct HashElem *union_hash_insert(struct HashTable *table,
   if (!table)
     return NULL; // LCOV_EXCL_LINE
 
-  struct HashElem *he = mutt_mem_calloc(1, sizeof(struct HashElem));
-  size_t hash = table->gen_hash(key, table->num_elems);
-  he->key = key;
-  he->data = data;
-  he->type = type;
+  const size_t hash = table->gen_hash(key);
 
-  if (table->allow_dups)
-  {
-    he->next = table->table[hash];
-    table->table[hash] = he;
-  }
-  else
+  if (!table->allow_dups)
   {
-    struct HashElem *tmp = NULL, *last = NULL;
-
-    for (tmp = table->table[hash], last = NULL; tmp; last = tmp, tmp = tmp->next)
+    for (struct HashElem *he = table->table[hash_bucket(table, hash)]; he; he = he->next)
     {
-      const int rc = table->cmp_key(tmp->key, key);
-      if (rc == 0)
-      {
-        FREE(&he);
+      if ((he->hash == hash) && (table->cmp_key(he->key, key) == 0))
         return NULL;
-      }
-      if (rc > 0)
-        break;
     }
-    if (last)
-      last->next = he;
-    else
-      table->table[hash] = he;
-    he->next = tmp;
   }
+
+  if (table->num_items >= (table->num_elems * HASH_MAX_LOAD))
+    hash_grow(table);
+
+  struct HashElem *he = mutt_mem_calloc(1, sizeof(struct HashElem));
+  he->key = key;
+  he->hash = hash;
+  he->data = data;
+  he->type = type;
+
+  const size_t bucket = hash_bucket(table, hash);
+  he->next = table->table[bucket];
+  table->table[bucket] = he;
+  table->num_items++;
+
   return he;
 }
 
@@ -188,11 +267,11 @@ static struct HashElem *union_hash_find_elem(const struct HashTable *table, unio
   if (!table)
     return NULL; // LCOV_EXCL_LINE
 
-  size_t hash = table->gen_hash(key, table->num_elems);
-  struct HashElem *he = table->table[hash];
+  const size_t hash = table->gen_hash(key);
+  struct HashElem *he = table->table[hash_bucket(table, hash)];
   for (; he; he = he->next)
   {
-    if (table->cmp_key(key, he->key) == 0)
+    if ((he->hash == hash) && (table->cmp_key(key, he->key) == 0))
       return he;
   }
   return NULL;
@@ -225,13 +304,15 @@ static void union_hash_delete(struct HashTable *table, union HashKey key, const
   if (!table)
     return; // LCOV_EXCL_LINE
 
-  size_t hash = table->gen_hash(key, table->num_elems);
-  struct HashElem *he = table->table[hash];
-  struct HashElem **he_last = &table->table[hash];
+  const size_t hash = table->gen_hash(key);
+  const size_t bucket = hash_bucket(table, hash);
+  struct HashElem *he = table->table[bucket];
+  struct HashElem **he_last = &table->table[bucket];
 
   while (he)
   {
-    if (((data == he->data) || !data) && (table->cmp_key(he->key, key) == 0))
+    if (((data == he->data) || !data) && (he->hash == hash) &&
+        (table->cmp_key(he->key, key) == 0))
     {
       *he_last = he->next;
       if (table->hdata_free)
@@ -239,6 +320,7 @@ static void union_hash_delete(struct HashTable *table, union HashKey key, const
       if (table->strdup_keys)
         FREE(&he->key.strkey);
       FREE(&he);
+      table->num_items--;
 
       he = *he_last;
     }
@@ -322,7 +404,10 @@ struct HashElem *mutt_hash_typed_insert(struct HashTable *table,
 
   union HashKey key;
   key.strkey = table->strdup_keys ? mutt_str_dup(strkey) : strkey;
-  return union_hash_insert(table, key, type, data);
+  struct HashElem *he = union_hash_insert(table, key, type, data);
+  if (!he && table->strdup_keys)
+    FREE(&key.strkey);
+  return he;
 }
 
 /**
@@ -414,8 +499,7 @@ struct HashElem *mutt_hash_find_bucket(const struct HashTable *table, const char
   union HashKey key;
 
   key.strkey = strkey;
-  size_t hash = table->gen_hash(key, table->num_elems);
-  return table->table[hash];
+  return table->table[hash_bucket(table, table->gen_hash(key))];
 }
 
 /**
@@ -479,6 +563,31 @@ void mutt_hash_free(struct HashTable **ptr)
   FREE(ptr);
 }
 
+/**
+ * mutt_hash_mem_size - Calculate the memory used by a Hash Table
+ * @param table Hash Table
+ * @retval num Size in bytes
+ *
+ * The data stored in the Hash Table isn't counted.
+ */
+size_t mutt_hash_mem_size(const struct HashTable *table)
+{
+  if (!table)
+    return 0;
+
+  size_t size = sizeof(*table) + (table->num_elems * sizeof(struct HashElem *)) +
+                (table->num_items * sizeof(struct HashElem));
+
+  if (table->strdup_keys)
+  {
+    for (size_t i = 0; i < table->num_elems; i++)
+      for (struct HashElem *he = table->table[i]; he; he = he->next)
+        size += mutt_str_mem_size(he->key.strkey);
+  }
+
+  return size;
+}
+
 /**
  * mutt_hash_walk - Iterate through all the HashElem's in a Hash Table
  * @param table Hash Table to search
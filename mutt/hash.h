@@ -43,6 +43,7 @@ struct HashElem
 {
   int type;              ///< Type of data stored in Hash Table, e.g. #DT_STRING
   union HashKey key;     ///< Key representing the data
+  size_t hash;           ///< Hash of the key
   void *data;            ///< User-supplied data
   struct HashElem *next; ///< Linked List
 };
@@ -65,13 +66,12 @@ typedef void (*hash_hdata_free_t)(int type, void *obj, intptr_t data);
  *
  * Prototype for a Key hashing function
  *
- * @param key       Key to hash
- * @param num_elems Number of elements in the Hash Table
+ * @param key Key to hash
  *
  * Turn a Key (a string or an integer) into a hash id.
- * The hash id will be a number between 0 and (num_elems-1).
+ * The Hash Table uses the low bits of the hash id to pick a bucket.
  */
-typedef size_t (*hash_gen_hash_t)(union HashKey key, size_t num_elems);
+typedef size_t (*hash_gen_hash_t)(union HashKey key);
 
 /**
  * @defgroup hash_cmp_key_api Hash Table Compare API
@@ -90,12 +90,11 @@ typedef int (*hash_cmp_key_t)(union HashKey a, union HashKey b);
 
 /**
  * struct HashTable - A Hash Table
- *
- * @note The number of actual elements in the HashTable isn't recorded.
  */
 struct HashTable
 {
-  size_t num_elems;             ///< Number of buckets in the Hash Table
+  size_t num_elems;             ///< Number of buckets in the Hash Table (a power of two)
+  size_t num_items;             ///< Number of elements in the Hash Table
   bool strdup_keys : 1;         ///< if set, the key->strkey is strdup()'d
   bool allow_dups  : 1;         ///< if set, duplicate keys are allowed
   struct HashElem **table;      ///< Array of Hash keys
@@ -121,6 +120,7 @@ void              mutt_hash_int_delete    (struct HashTable *table, unsigned int
 void *            mutt_hash_int_find      (const struct HashTable *table, unsigned int intkey);
 struct HashElem * mutt_hash_int_insert    (struct HashTable *table, unsigned int intkey, void *data);
 struct HashTable *mutt_hash_int_new       (size_t num_elems, HashFlags flags);
+size_t            mutt_hash_mem_size      (const struct HashTable *table);
 struct HashTable *mutt_hash_new           (size_t num_elems, HashFlags flags);
 void              mutt_hash_set_destructor(struct HashTable *table, hash_hdata_free_t fn, intptr_t fn_data);
 struct HashElem * mutt_hash_typed_insert  (struct HashTable *table, const char *strkey, int type, void *data);
@@ -0,0 +1,161 @@
+/**
+ * @file
+ * Shared, reference-counted strings
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @page mutt_intern Shared, reference-counted strings
+ *
+ * Many Emails in a Mailbox carry identical strings.  Interning them keeps a
+ * single copy of each, and equal strings can be compared by pointer.
+ *
+ * An interned string must not be modified or freed.  Each call to
+ * mutt_intern_get() must be matched by a call to mutt_intern_release().
+ */
+
+#include "config.h"
+#include <stddef.h>
+#include <string.h>
+#include "intern.h"
+#include "hash.h"
+#include "memory.h"
+
+/**
+ * struct InternString - A shared string
+ */
+struct InternString
+{
+  size_t refs; ///< Number of users
+  char str[];  ///< String
+};
+
+/// Table of all the interned strings
+static struct HashTable *InternTable = NULL;
+/// Number of interned strings
+static size_t InternCount = 0;
+/// Memory used by the interned strings
+static size_t InternBytes = 0;
+
+/**
+ * intern_from_str - Get the InternString containing a string
+ * @param str Interned string
+ * @retval ptr InternString
+ */
+static struct InternString *intern_from_str(const char *str)
+{
+  return (struct InternString *) (str - offsetof(struct InternString, str));
+}
+
+/**
+ * mutt_intern_get - Get a shared copy of a string
+ * @param str String to intern
+ * @retval ptr  Interned string
+ * @retval NULL str was NULL or empty
+ *
+ * @note The caller must release the string with mutt_intern_release()
+ */
+const char *mutt_intern_get(const char *str)
+{
+  if (!str || (*str == '\0'))
+    return NULL;
+
+  if (!InternTable)
+    InternTable = mutt_hash_new(1024, MUTT_HASH_NO_FLAGS);
+
+  struct InternString *is = mutt_hash_find(InternTable, str);
+  if (!is)
+  {
+    const size_t len = strlen(str);
+    is = mutt_mem_malloc(sizeof(struct InternString) + len + 1);
+    is->refs = 0;
+    memcpy(is->str, str, len + 1);
+    mutt_hash_insert(InternTable, is->str, is);
+    InternCount++;
+    InternBytes += sizeof(struct InternString) + len + 1;
+  }
+
+  is->refs++;
+  return is->str;
+}
+
+/**
+ * mutt_intern_release - Release a shared string
+ * @param ptr Interned string to release
+ *
+ * When the last user has released the string, it will be freed.
+ */
+void mutt_intern_release(const char **ptr)
+{
+  if (!ptr || !*ptr)
+    return;
+
+  struct InternString *is = intern_from_str(*ptr);
+  *ptr = NULL;
+
+  if (--is->refs > 0)
+    return;
+
+  InternBytes -= sizeof(struct InternString) + strlen(is->str) + 1;
+  mutt_hash_delete(InternTable, is->str, is);
+  InternCount--;
+  FREE(&is);
+}
+
+/**
+ * mutt_intern_count - Count the interned strings
+ * @retval num Number of distinct strings
+ */
+size_t mutt_intern_count(void)
+{
+  return InternCount;
+}
+
+/**
+ * mutt_intern_mem_size - Calculate the memory used by the interned strings
+ * @retval num Size in bytes, including the table
+ */
+size_t mutt_intern_mem_size(void)
+{
+  return InternBytes + mutt_hash_mem_size(InternTable);
+}
+
+/**
+ * intern_free - Free an InternString - Implements ::hash_hdata_free_t - @ingroup hash_hdata_free_api
+ */
+static void intern_free(int type, void *obj, intptr_t data)
+{
+  FREE(&obj);
+}
+
+/**
+ * mutt_intern_cleanup - Free all the interned strings
+ *
+ * @note Any strings still in use will become invalid
+ */
+void mutt_intern_cleanup(void)
+{
+  if (!InternTable)
+    return;
+
+  mutt_hash_set_destructor(InternTable, intern_free, 0);
+  mutt_hash_free(&InternTable);
+  InternCount = 0;
+  InternBytes = 0;
+}
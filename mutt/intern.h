@@ -0,0 +1,34 @@
+/**
+ * @file
+ * Shared, reference-counted strings
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUTT_MUTT_INTERN_H
+#define MUTT_MUTT_INTERN_H
+
+#include <stddef.h>
+
+void        mutt_intern_cleanup (void);
+size_t      mutt_intern_count   (void);
+const char *mutt_intern_get     (const char *str);
+size_t      mutt_intern_mem_size(void);
+void        mutt_intern_release (const char **ptr);
+
+#endif /* MUTT_MUTT_INTERN_H */
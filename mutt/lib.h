@@ -32,6 +32,7 @@
  * | mutt/array.h     | @subpage mutt_array     |
  * | mutt/atoi.c      | @subpage mutt_atoi      |
  * | mutt/base64.c    | @subpage mutt_base64    |
+ * | mutt/bitset.c    | @subpage mutt_bitset    |
  * | mutt/buffer.c    | @subpage mutt_buffer    |
  * | mutt/charset.c   | @subpage mutt_charset   |
  * | mutt/date.c      | @subpage mutt_date      |
@@ -41,6 +42,7 @@
  * | mutt/file.c      | @subpage mutt_file      |
  * | mutt/filter.c    | @subpage mutt_filter    |
  * | mutt/hash.c      | @subpage mutt_hash      |
+ * | mutt/intern.c    | @subpage mutt_intern    |
  * | mutt/list.c      | @subpage mutt_list      |
  * | mutt/logging.c   | @subpage mutt_logging   |
  * | mutt/mapping.c   | @subpage mutt_mapping   |
@@ -55,8 +57,10 @@
  * | mutt/random.c    | @subpage mutt_random    |
  * | mutt/regex.c     | @subpage mutt_regex     |
  * | mutt/signal.c    | @subpage mutt_signal    |
+ * | mutt/slab.c      | @subpage mutt_slab      |
  * | mutt/slist.c     | @subpage mutt_slist     |
  * | mutt/state.c     | @subpage mutt_state     |
+ * | mutt/stats.c     | @subpage mutt_stats     |
  * | mutt/string.c    | @subpage mutt_string    |
  *
  * @note The library is self-contained -- some files may depend on others in
@@ -73,6 +77,7 @@
 #include "array.h"
 #include "atoi.h"
 #include "base64.h"
+#include "bitset.h"
 #include "buffer.h"
 #include "charset.h"
 #include "date.h"
@@ -82,6 +87,7 @@
 #include "file.h"
 #include "filter.h"
 #include "hash.h"
+#include "intern.h"
 #include "list.h"
 #include "logging2.h"
 #include "mapping.h"
@@ -100,8 +106,10 @@
 #include "random.h"
 #include "regex3.h"
 #include "signal2.h"
+#include "slab.h"
 #include "slist.h"
 #include "state.h"
+#include "stats.h"
 #include "string2.h"
 // IWYU pragma: end_keep
 
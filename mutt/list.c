@@ -136,6 +136,25 @@ void mutt_list_free(struct ListHead *h)
   STAILQ_INIT(h);
 }
 
+/**
+ * mutt_list_mem_size - Calculate the memory used by a List of strings
+ * @param h Head of the List
+ * @retval num Size in bytes
+ */
+size_t mutt_list_mem_size(const struct ListHead *h)
+{
+  if (!h)
+    return 0;
+
+  size_t size = 0;
+  struct ListNode *np = NULL;
+  STAILQ_FOREACH(np, h, entries)
+  {
+    size += sizeof(*np) + mutt_str_mem_size(np->data);
+  }
+  return size;
+}
+
 /**
  * mutt_list_free_type - Free a List of type
  * @param h Head of the List
@@ -56,6 +56,7 @@ struct ListNode *mutt_list_insert_after(struct ListHead *h, struct ListNode *n,
 struct ListNode *mutt_list_insert_head (struct ListHead *h, char *s);
 struct ListNode *mutt_list_insert_tail (struct ListHead *h, char *s);
 bool             mutt_list_match       (const char *s, struct ListHead *h);
+size_t           mutt_list_mem_size    (const struct ListHead *h);
 size_t           mutt_list_str_split   (struct ListHead *head, const char *src, char sep);
 
 #endif /* MUTT_MUTT_LIST_H */
@@ -52,6 +52,14 @@ const char *LevelAbbr = "PEWM12345N"; ///< Abbreviations of logging level names
  */
 log_dispatcher_t MuttLogger = log_disp_terminal;
 
+/**
+ * MuttLogLevel - Highest level the log dispatcher will record - @ingroup logging_api
+ *
+ * mutt_debug() checks this before doing any work.  Whoever changes
+ * #MuttLogger is responsible for keeping it up to date.
+ */
+enum LogLevel MuttLogLevel = LL_MAX;
+
 static FILE *LogFileFP = NULL;      ///< Log file handle
 static char *LogFileName = NULL;    ///< Log file name
 static int LogFileLevel = 0;        ///< Log file level
@@ -441,6 +449,10 @@ int log_disp_queue(time_t stamp, const char *file, int line, const char *functio
 int log_disp_terminal(time_t stamp, const char *file, int line, const char *function,
                       enum LogLevel level, const char *format, ...)
 {
+  // Debug lines are only written to the log file
+  if ((level > LL_MESSAGE) && (!LogFileFP || (level > LogFileLevel)))
+    return 0;
+
   char buf[LOG_LINE_MAX_LEN] = { 0 };
 
   va_list ap;
@@ -70,6 +70,12 @@ typedef int (*log_dispatcher_t)(time_t stamp, const char *file, int line, const
 __attribute__((__format__(__printf__, 6, 7)));
 
 extern log_dispatcher_t MuttLogger;
+extern enum LogLevel MuttLogLevel;
+
+#ifndef LOG_LEVEL_MAX
+/// Highest debug level compiled in, see configure --with-log-level
+#define LOG_LEVEL_MAX LL_NOTIFY
+#endif
 
 /**
  * struct LogLine - A Log line
@@ -86,7 +92,18 @@ struct LogLine
 };
 STAILQ_HEAD(LogLineList, LogLine);
 
-#define mutt_debug(LEVEL, ...) MuttLogger(0, __FILE__, __LINE__, __func__, LEVEL,      __VA_ARGS__) ///< @ingroup logging_api
+/**
+ * mutt_debug - Log a debugging message
+ *
+ * The level is checked before the arguments are evaluated, so a disabled
+ * message costs a compare.  Levels above #LOG_LEVEL_MAX are compiled out.
+ */
+#define mutt_debug(LEVEL, ...)                                                 \
+  do                                                                           \
+  {                                                                            \
+    if (((LEVEL) <= LOG_LEVEL_MAX) && ((LEVEL) <= MuttLogLevel))               \
+      MuttLogger(0, __FILE__, __LINE__, __func__, LEVEL, __VA_ARGS__);         \
+  } while (0)
 #define mutt_warning(...)      MuttLogger(0, __FILE__, __LINE__, __func__, LL_WARNING, __VA_ARGS__) ///< @ingroup logging_api
 #define mutt_message(...)      MuttLogger(0, __FILE__, __LINE__, __func__, LL_MESSAGE, __VA_ARGS__) ///< @ingroup logging_api
 #define mutt_error(...)        MuttLogger(0, __FILE__, __LINE__, __func__, LL_ERROR,   __VA_ARGS__) ///< @ingroup logging_api
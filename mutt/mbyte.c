@@ -414,7 +414,7 @@ bool mutt_mb_is_display_corrupting_utf8(wchar_t wc)
  *
  * Unprintable characters will be replaced with #ReplacementChar.
  *
- * @note The source string will be freed and a newly allocated string will be
+ * @note The source string may be freed and a newly allocated string will be
  * returned in its place.  The caller should free the returned string.
  */
 int mutt_mb_filter_unprintable(char **s)
@@ -422,10 +422,17 @@ int mutt_mb_filter_unprintable(char **s)
   if (!s || !*s)
     return -1;
 
+  /* Printable ASCII doesn't need changing */
+  char *p = *s;
+  while ((*p >= 0x20) && (*p < 0x7f))
+    p++;
+  if (*p == '\0')
+    return 0;
+
   wchar_t wc = 0;
   size_t k, k2;
   char scratch[MB_LEN_MAX + 1];
-  char *p = *s;
+  p = *s;
   mbstate_t mbstate1 = { 0 };
   mbstate_t mbstate2 = { 0 };
 
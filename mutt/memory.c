@@ -27,15 +27,23 @@
  *
  * @note If any of the allocators fail, the user is notified and the program is
  *       stopped immediately.
+ *
+ * The wrappers keep a count of the heap operations, see mutt_mem_stats().
  */
 
 #include "config.h"
 #include <stdlib.h>
+#ifdef HAVE_MALLINFO2
+#include <malloc.h>
+#endif
 #include "memory.h"
 #include "exit.h"
 #include "logging2.h"
 #include "message.h"
 
+/// Counts of heap operations
+static struct MemoryStats MemStats = { 0 };
+
 /**
  * mutt_mem_calloc - Allocate zeroed memory on the heap
  * @param nmemb Number of blocks
@@ -58,6 +66,9 @@ void *mutt_mem_calloc(size_t nmemb, size_t size)
     mutt_error(_("Out of memory")); // LCOV_EXCL_LINE
     mutt_exit(1);                   // LCOV_EXCL_LINE
   }
+
+  MemStats.allocs++;
+  MemStats.bytes += nmemb * size;
   return p;
 }
 
@@ -74,6 +85,7 @@ void mutt_mem_free(void *ptr)
   {
     free(*p);
     *p = NULL;
+    MemStats.frees++;
   }
 }
 
@@ -98,6 +110,9 @@ void *mutt_mem_malloc(size_t size)
     mutt_error(_("Out of memory")); // LCOV_EXCL_LINE
     mutt_exit(1);                   // LCOV_EXCL_LINE
   }
+
+  MemStats.allocs++;
+  MemStats.bytes += size;
   return p;
 }
 
@@ -124,6 +139,7 @@ void mutt_mem_realloc(void *ptr, size_t size)
     {
       free(*p);
       *p = NULL;
+      MemStats.frees++;
     }
     return;
   }
@@ -135,5 +151,31 @@ void mutt_mem_realloc(void *ptr, size_t size)
     mutt_exit(1);                   // LCOV_EXCL_LINE
   }
 
+  if (*p)
+    MemStats.reallocs++;
+  else
+    MemStats.allocs++;
+  MemStats.bytes += size;
+
   *p = r;
 }
+
+/**
+ * mutt_mem_stats - Get the counts of heap operations
+ * @param[out] stats Counts
+ *
+ * Only the wrappers are counted, not allocations made by libraries, or by
+ * functions such as strdup().
+ */
+void mutt_mem_stats(struct MemoryStats *stats)
+{
+  if (!stats)
+    return;
+
+  *stats = MemStats;
+
+#ifdef HAVE_MALLINFO2
+  struct mallinfo2 mi = mallinfo2();
+  stats->in_use = mi.uordblks + mi.hblkhd;
+#endif
+}
@@ -37,10 +37,23 @@
 
 #define mutt_array_size(x) (sizeof(x) / sizeof((x)[0]))
 
+/**
+ * struct MemoryStats - Counts of heap operations
+ */
+struct MemoryStats
+{
+  size_t allocs;   ///< Number of blocks allocated
+  size_t reallocs; ///< Number of blocks resized
+  size_t frees;    ///< Number of blocks freed
+  size_t bytes;    ///< Total bytes requested
+  size_t in_use;   ///< Bytes in use by the whole heap, if known (otherwise 0)
+};
+
 void *mutt_mem_calloc(size_t nmemb, size_t size);
 void  mutt_mem_free(void *ptr);
 void *mutt_mem_malloc(size_t size);
 void  mutt_mem_realloc(void *ptr, size_t size);
+void  mutt_mem_stats(struct MemoryStats *stats);
 
 #define FREE(x) mutt_mem_free(x)
 
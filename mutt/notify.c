@@ -24,11 +24,18 @@
  * @page mutt_notify Notification API
  *
  * Notification API
+ *
+ * Each Notify object keeps a mask of the event types its observers want, so
+ * events can skip objects that have no interested observers.
+ *
+ * A batch, notify_batch_begin() / notify_batch_end(), collapses many identical
+ * events, e.g. one per Email while tagging, into a single event.
  */
 
 #include "config.h"
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include "notify.h"
 #include "logging2.h"
 #include "memory.h"
@@ -53,8 +60,28 @@ struct Notify
 {
   struct Notify *parent;         ///< Parent of the notification object
   struct ObserverList observers; ///< List of observers of this object
+  uint32_t types;                ///< Event types observed, see notify_type_mask()
+
+  int batch_depth;               ///< Nesting level of notify_batch_begin()
+  enum NotifyType batch_type;    ///< Type of event being batched
+  int batch_subtype;             ///< Subtype of event being batched
+  size_t batch_count;            ///< Number of events held back
 };
 
+/**
+ * notify_type_mask - Get the bit representing an event type
+ * @param type Event type, e.g. #NT_WINDOW
+ * @retval num Bit mask
+ *
+ * An observer of #NT_ALL is interested in every type.
+ */
+static uint32_t notify_type_mask(enum NotifyType type)
+{
+  if (type == NT_ALL)
+    return UINT32_MAX;
+  return (uint32_t) 1 << (type % 32);
+}
+
 /**
  * notify_new - Create a new notifications handler
  * @retval ptr New notification handler
@@ -125,20 +152,23 @@ static bool send(struct Notify *source, struct Notify *current,
 
   mutt_debug(LL_NOTIFY, "send: %d, %p\n", event_type, event_data);
   struct ObserverNode *np = NULL;
-  STAILQ_FOREACH(np, &current->observers, entries)
+  if (current->types & notify_type_mask(event_type))
   {
-    struct Observer *o = np->observer;
-    if (!o)
-      continue;
-
-    if ((o->type == NT_ALL) || (event_type == o->type))
+    STAILQ_FOREACH(np, &current->observers, entries)
     {
-      struct NotifyCallback nc = { current, event_type, event_subtype,
-                                   event_data, o->global_data };
-      if (o->callback(&nc) < 0)
+      struct Observer *o = np->observer;
+      if (!o)
+        continue;
+
+      if ((o->type == NT_ALL) || (event_type == o->type))
       {
-        mutt_debug(LL_DEBUG1, "failed to send notification: %s/%d, global %p, event %p\n",
-                   NotifyTypeNames[event_type], event_subtype, o->global_data, event_data);
+        struct NotifyCallback nc = { current, event_type, event_subtype,
+                                     event_data, o->global_data };
+        if (o->callback(&nc) < 0)
+        {
+          mutt_debug(LL_DEBUG1, "failed to send notification: %s/%d, global %p, event %p\n",
+                     NotifyTypeNames[event_type], event_subtype, o->global_data, event_data);
+        }
       }
     }
   }
@@ -148,10 +178,14 @@ static bool send(struct Notify *source, struct Notify *current,
 
   // Garbage collection time
   struct ObserverNode *tmp = NULL;
+  current->types = 0;
   STAILQ_FOREACH_SAFE(np, &current->observers, entries, tmp)
   {
     if (np->observer)
+    {
+      current->types |= notify_type_mask(np->observer->type);
       continue;
+    }
 
     STAILQ_REMOVE(&current->observers, np, ObserverNode, entries);
     FREE(&np);
@@ -169,10 +203,19 @@ static bool send(struct Notify *source, struct Notify *current,
  * @retval true Successfully sent
  *
  * See send() for more details.
+ *
+ * @note During a batch, matching events are held back, see notify_batch_begin()
  */
 bool notify_send(struct Notify *notify, enum NotifyType event_type,
                  int event_subtype, void *event_data)
 {
+  if (notify && (notify->batch_depth > 0) && (event_type == notify->batch_type) &&
+      (event_subtype == notify->batch_subtype))
+  {
+    notify->batch_count++;
+    return true;
+  }
+
   mutt_debug(LL_NOTIFY, "sending: %s/%d\n", NotifyTypeNames[event_type], event_subtype);
   return send(notify, notify, event_type, event_subtype, event_data);
 }
@@ -212,6 +255,7 @@ bool notify_observer_add(struct Notify *notify, enum NotifyType type,
   np = mutt_mem_calloc(1, sizeof(*np));
   np->observer = o;
   STAILQ_INSERT_HEAD(&notify->observers, np, entries);
+  notify->types |= notify_type_mask(type);
 
   return true;
 }
@@ -266,4 +310,54 @@ void notify_observer_remove_all(struct Notify *notify)
     FREE(&np->observer);
     FREE(&np);
   }
+  notify->types = 0;
+}
+
+/**
+ * notify_batch_begin - Start collapsing events into one
+ * @param notify        Notification handler
+ * @param event_type    Type of event to batch, e.g. #NT_MAILBOX
+ * @param event_subtype Subtype of event to batch, e.g. #NT_MAILBOX_CHANGE
+ *
+ * Until notify_batch_end() is called, matching events sent to this handler
+ * will be held back.  Other events are sent as normal.
+ *
+ * Batches may be nested.  A nested batch uses the outer batch's event type.
+ */
+void notify_batch_begin(struct Notify *notify, enum NotifyType event_type, int event_subtype)
+{
+  if (!notify)
+    return;
+
+  if (notify->batch_depth++ > 0)
+    return;
+
+  notify->batch_type = event_type;
+  notify->batch_subtype = event_subtype;
+  notify->batch_count = 0;
+}
+
+/**
+ * notify_batch_end - Finish collapsing events into one
+ * @param notify     Notification handler
+ * @param event_data Private data associated with the summary event
+ * @retval true A summary event was sent
+ *
+ * If any events were held back, a single event of the batched type is sent.
+ */
+bool notify_batch_end(struct Notify *notify, void *event_data)
+{
+  if (!notify || (notify->batch_depth == 0))
+    return false;
+
+  if (--notify->batch_depth > 0)
+    return false;
+
+  if (notify->batch_count == 0)
+    return false;
+
+  mutt_debug(LL_NOTIFY, "batch: %s/%d, %zu events\n", NotifyTypeNames[notify->batch_type],
+             notify->batch_subtype, notify->batch_count);
+  notify->batch_count = 0;
+  return notify_send(notify, notify->batch_type, notify->batch_subtype, event_data);
 }
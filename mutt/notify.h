@@ -38,4 +38,7 @@ bool notify_observer_add(struct Notify *notify, enum NotifyType type, observer_t
 bool notify_observer_remove(struct Notify *notify, const observer_t callback, const void *global_data);
 void notify_observer_remove_all(struct Notify *notify);
 
+void notify_batch_begin(struct Notify *notify, enum NotifyType event_type, int event_subtype);
+bool notify_batch_end  (struct Notify *notify, void *event_data);
+
 #endif /* MUTT_MUTT_NOTIFY_H */
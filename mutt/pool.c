@@ -24,41 +24,75 @@
  * @page mutt_pool A global pool of Buffers
  *
  * A shared pool of Buffers to save lots of allocs/frees.
+ *
+ * The pool keeps Buffers in size classes, 1KiB, 2KiB, 4KiB and 8KiB.
+ * A released Buffer keeps its memory, up to the largest class, so code that
+ * routinely builds long paths or header lines doesn't have to grow its Buffer
+ * every time.  buf_pool_get() hands out the largest Buffer available.
+ *
+ * @note The pool isn't thread-safe.  NeoMutt doesn't use threads.
  */
 
 #include "config.h"
 #include <stdio.h>
+#include <string.h>
 #include "pool.h"
 #include "buffer.h"
 #include "logging2.h"
 #include "memory.h"
 
-/// Number of buffers in the pool
-static size_t BufferPoolCount = 0;
-/// Total size of the pool
-static size_t BufferPoolLen = 0;
+/// Number of size classes
+#define POOL_NUM_CLASSES 4
+
 /// Amount to increase the size of the pool
 static const size_t BufferPoolIncrement = 20;
 /// Minimum size for a buffer
 static const size_t BufferPoolInitialBufferSize = 1024;
-/// A pool of buffers
-static struct Buffer **BufferPool = NULL;
 
 /**
- * pool_increase_size - Increase the size of the Buffer pool
+ * struct PoolClass - Buffers of one size class
+ */
+struct PoolClass
+{
+  struct Buffer **buffers; ///< Unused Buffers
+  size_t count;            ///< Number of Buffers in the class
+  size_t len;              ///< Size of the buffers array
+};
+
+/// Size classes of buffers, each twice the size of the previous
+static struct PoolClass BufferPool[POOL_NUM_CLASSES] = { 0 };
+/// Usage statistics
+static struct BufferPoolStats BufferPoolStats = { 0 };
+
+/**
+ * pool_class - Find the size class of a Buffer
+ * @param size Size of the Buffer's memory
+ * @retval num Index into BufferPool
+ *
+ * @pre size is between the smallest and largest class sizes
  */
-static void pool_increase_size(void)
+static int pool_class(size_t size)
 {
-  BufferPoolLen += BufferPoolIncrement;
-  mutt_debug(LL_DEBUG1, "%zu\n", BufferPoolLen);
+  int cls = 0;
+  while ((cls < (POOL_NUM_CLASSES - 1)) && (size >= (BufferPoolInitialBufferSize << (cls + 1))))
+    cls++;
+  return cls;
+}
 
-  mutt_mem_realloc(&BufferPool, BufferPoolLen * sizeof(struct Buffer *));
-  while (BufferPoolCount < BufferPoolIncrement)
+/**
+ * pool_push - Add a Buffer to a size class
+ * @param buf Buffer to add
+ */
+static void pool_push(struct Buffer *buf)
+{
+  struct PoolClass *pc = &BufferPool[pool_class(buf->dsize)];
+  if (pc->count >= pc->len)
   {
-    struct Buffer *newbuf = buf_new(NULL);
-    buf_alloc(newbuf, BufferPoolInitialBufferSize);
-    BufferPool[BufferPoolCount++] = newbuf;
+    pc->len += BufferPoolIncrement;
+    mutt_mem_realloc(&pc->buffers, pc->len * sizeof(struct Buffer *));
   }
+
+  pc->buffers[pc->count++] = buf;
 }
 
 /**
@@ -66,12 +100,20 @@ static void pool_increase_size(void)
  */
 void buf_pool_cleanup(void)
 {
-  mutt_debug(LL_DEBUG1, "%zu of %zu returned to pool\n", BufferPoolCount, BufferPoolLen);
+  mutt_debug(LL_DEBUG1, "%zu gets, %zu new, %zu resized, %zu in use, %zu max\n",
+             BufferPoolStats.gets, BufferPoolStats.allocs, BufferPoolStats.resizes,
+             BufferPoolStats.in_use, BufferPoolStats.max_in_use);
 
-  while (BufferPoolCount)
-    buf_free(&BufferPool[--BufferPoolCount]);
-  FREE(&BufferPool);
-  BufferPoolLen = 0;
+  for (int i = 0; i < POOL_NUM_CLASSES; i++)
+  {
+    struct PoolClass *pc = &BufferPool[i];
+    while (pc->count)
+      buf_free(&pc->buffers[--pc->count]);
+    FREE(&pc->buffers);
+    pc->len = 0;
+  }
+
+  memset(&BufferPoolStats, 0, sizeof(BufferPoolStats));
 }
 
 /**
@@ -80,9 +122,22 @@ void buf_pool_cleanup(void)
  */
 struct Buffer *buf_pool_get(void)
 {
-  if (BufferPoolCount == 0)
-    pool_increase_size();
-  return BufferPool[--BufferPoolCount];
+  BufferPoolStats.gets++;
+  BufferPoolStats.in_use++;
+  if (BufferPoolStats.in_use > BufferPoolStats.max_in_use)
+    BufferPoolStats.max_in_use = BufferPoolStats.in_use;
+
+  for (int i = POOL_NUM_CLASSES - 1; i >= 0; i--)
+  {
+    struct PoolClass *pc = &BufferPool[i];
+    if (pc->count > 0)
+      return pc->buffers[--pc->count];
+  }
+
+  BufferPoolStats.allocs++;
+  struct Buffer *buf = buf_new(NULL);
+  buf_alloc(buf, BufferPoolInitialBufferSize);
+  return buf;
 }
 
 /**
@@ -96,25 +151,34 @@ void buf_pool_release(struct Buffer **ptr)
   if (!ptr || !*ptr)
     return;
 
-  if (BufferPoolCount >= BufferPoolLen)
-  {
-    // LCOV_EXCL_START
-    mutt_debug(LL_DEBUG1, "Internal buffer pool error\n");
-    buf_free(ptr);
-    return;
-    // LCOV_EXCL_STOP
-  }
+  if (BufferPoolStats.in_use > 0)
+    BufferPoolStats.in_use--;
 
   // Reset the size if it's too big or too small
   struct Buffer *buf = *ptr;
-  if ((buf->dsize > (2 * BufferPoolInitialBufferSize)) ||
-      (buf->dsize < BufferPoolInitialBufferSize))
+  const size_t max_size = BufferPoolInitialBufferSize << (POOL_NUM_CLASSES - 1);
+  if ((buf->dsize > max_size) || (buf->dsize < BufferPoolInitialBufferSize))
   {
-    buf->dsize = BufferPoolInitialBufferSize;
+    BufferPoolStats.resizes++;
+    buf->dsize = (buf->dsize > max_size) ? max_size : BufferPoolInitialBufferSize;
     mutt_mem_realloc(&buf->data, buf->dsize);
   }
   buf_reset(buf);
-  BufferPool[BufferPoolCount++] = buf;
+  pool_push(buf);
 
   *ptr = NULL;
 }
+
+/**
+ * buf_pool_stats - Get the Buffer pool's usage statistics
+ * @param[out] stats Statistics
+ */
+void buf_pool_stats(struct BufferPoolStats *stats)
+{
+  if (!stats)
+    return;
+
+  *stats = BufferPoolStats;
+  for (int i = 0; i < POOL_NUM_CLASSES; i++)
+    stats->pooled += BufferPool[i].count;
+}
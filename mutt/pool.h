@@ -23,10 +23,26 @@
 #ifndef MUTT_MUTT_POOL_H
 #define MUTT_MUTT_POOL_H
 
+#include <stddef.h>
+
 struct Buffer;
 
+/**
+ * struct BufferPoolStats - Usage statistics of the Buffer pool
+ */
+struct BufferPoolStats
+{
+  size_t gets;       ///< Number of calls to buf_pool_get()
+  size_t allocs;     ///< Number of Buffers created
+  size_t resizes;    ///< Number of Buffers resized on release
+  size_t in_use;     ///< Number of Buffers currently in use
+  size_t max_in_use; ///< Most Buffers in use at once
+  size_t pooled;     ///< Number of Buffers waiting in the pool
+};
+
 void           buf_pool_cleanup(void);
 struct Buffer *buf_pool_get    (void);
 void           buf_pool_release(struct Buffer **ptr);
+void           buf_pool_stats  (struct BufferPoolStats *stats);
 
 #endif /* MUTT_MUTT_POOL_H */
@@ -143,17 +143,6 @@ static struct PrexStorage *prex(enum Prex which)
       "([" QUERY_PART "]+)=([" QUERY_PART "]+)"   // query + ' '
 #undef QUERY_PART
     },
-    {
-      PREX_RFC2047_ENCODED_WORD,
-      PREX_RFC2047_ENCODED_WORD_MATCH_MAX,
-      "=\\?"
-      "([^][()<>@,;:\\\"/?. =]+)" // charset
-      "\\?"
-      "([qQbB])" // encoding
-      "\\?"
-      "([^?]+)" // encoded text - we accept whitespace, see #1189
-      "\\?="
-    },
     {
       PREX_GNUTLS_CERT_HOST_HASH,
       PREX_GNUTLS_CERT_HOST_HASH_MATCH_MAX,
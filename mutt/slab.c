@@ -0,0 +1,263 @@
+/**
+ * @file
+ * Fixed-size object allocator
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @page mutt_slab Fixed-size object allocator
+ *
+ * A Slab hands out zeroed objects of a single size.  They're carved out of
+ * large chunks of memory, so opening a big mailbox doesn't cost one malloc()
+ * for every Email, Envelope and Body, and the objects don't end up scattered
+ * around the heap.
+ *
+ * Each object is preceded by a pointer to its chunk.  Every chunk keeps its own
+ * free list and count of objects in use, so a chunk is released as soon as
+ * all its objects have been freed, e.g. when a Mailbox is closed, even if
+ * other Mailboxes are still open.  One empty chunk is kept back, so that
+ * allocating and freeing at a chunk boundary doesn't thrash the heap.
+ *
+ * When built with the Address Sanitizer, a Slab uses the regular allocator,
+ * so that misuse of the objects can still be detected.
+ */
+
+#include "config.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "slab.h"
+#include "memory.h"
+
+/// Number of objects in each chunk
+#define SLAB_CHUNK_OBJECTS 256
+
+/// Alignment of the objects
+#define SLAB_ALIGN (2 * sizeof(void *))
+
+/**
+ * struct SlabChunk - A block of memory holding many objects
+ *
+ * The objects follow the header.
+ */
+struct SlabChunk
+{
+  struct SlabChunk *prev; ///< Previous chunk with unused objects
+  struct SlabChunk *next; ///< Next chunk with unused objects
+  void *free_list;        ///< Unused objects in this chunk
+  size_t num_used;        ///< Number of objects in use from this chunk
+};
+
+/// Size of the chunk header, keeping the objects aligned
+#define SLAB_HEADER_SIZE ROUND_UP(sizeof(struct SlabChunk), SLAB_ALIGN)
+
+/// Size of the pointer to the chunk, in front of each object
+#define SLAB_BACKPTR_SIZE ROUND_UP(sizeof(struct SlabChunk *), SLAB_ALIGN)
+
+#if defined(__SANITIZE_ADDRESS__)
+#define SLAB_PASSTHROUGH
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define SLAB_PASSTHROUGH
+#endif
+#endif
+
+/**
+ * slab_object_size - Get the size of the Slab's objects, including padding
+ * @param slab Slab
+ * @retval num Size of each object
+ */
+static size_t slab_object_size(const struct Slab *slab)
+{
+  const size_t size = (slab->obj_size < sizeof(void *)) ? sizeof(void *) : slab->obj_size;
+  return ROUND_UP(size, SLAB_ALIGN);
+}
+
+/**
+ * slab_chunk_of - Find the chunk that holds an object
+ * @param ptr Object
+ * @retval ptr Chunk
+ */
+static struct SlabChunk *slab_chunk_of(void *ptr)
+{
+  return *(struct SlabChunk **) ((char *) ptr - SLAB_BACKPTR_SIZE);
+}
+
+/**
+ * slab_link - Add a chunk to the front of the Slab's list
+ * @param slab  Slab
+ * @param chunk Chunk with unused objects
+ */
+static void slab_link(struct Slab *slab, struct SlabChunk *chunk)
+{
+  chunk->prev = NULL;
+  chunk->next = slab->chunks;
+  if (slab->chunks)
+    slab->chunks->prev = chunk;
+  slab->chunks = chunk;
+}
+
+/**
+ * slab_unlink - Remove a chunk from the Slab's list
+ * @param slab  Slab
+ * @param chunk Chunk to remove
+ */
+static void slab_unlink(struct Slab *slab, struct SlabChunk *chunk)
+{
+  if (chunk->prev)
+    chunk->prev->next = chunk->next;
+  else
+    slab->chunks = chunk->next;
+
+  if (chunk->next)
+    chunk->next->prev = chunk->prev;
+
+  chunk->prev = NULL;
+  chunk->next = NULL;
+}
+
+/**
+ * slab_grow - Add a chunk of unused objects to the Slab
+ * @param slab Slab
+ */
+static void slab_grow(struct Slab *slab)
+{
+  const size_t slot = SLAB_BACKPTR_SIZE + slab_object_size(slab);
+
+  struct SlabChunk *chunk = mutt_mem_malloc(SLAB_HEADER_SIZE + (slot * SLAB_CHUNK_OBJECTS));
+  chunk->free_list = NULL;
+  chunk->num_used = 0;
+
+  // Thread the objects onto the free list, first object at the front
+  char *obj = (char *) chunk + SLAB_HEADER_SIZE + (slot * SLAB_CHUNK_OBJECTS);
+  for (int i = 0; i < SLAB_CHUNK_OBJECTS; i++)
+  {
+    obj -= slot;
+    *(struct SlabChunk **) obj = chunk;
+    *(void **) (obj + SLAB_BACKPTR_SIZE) = chunk->free_list;
+    chunk->free_list = obj + SLAB_BACKPTR_SIZE;
+  }
+
+  slab_link(slab, chunk);
+  slab->num_chunks++;
+}
+
+/**
+ * slab_release - Free all the Slab's chunks
+ * @param slab Slab
+ *
+ * @pre None of the Slab's objects are in use
+ */
+static void slab_release(struct Slab *slab)
+{
+  struct SlabChunk *next = NULL;
+  for (struct SlabChunk *chunk = slab->chunks; chunk; chunk = next)
+  {
+    next = chunk->next;
+    FREE(&chunk);
+  }
+
+  slab->chunks = NULL;
+  slab->num_chunks = 0;
+}
+
+/**
+ * slab_alloc - Allocate an object from a Slab
+ * @param slab Slab
+ * @retval ptr New, zeroed, object
+ */
+void *slab_alloc(struct Slab *slab)
+{
+  if (!slab)
+    return NULL;
+
+  slab->num_used++;
+
+#ifdef SLAB_PASSTHROUGH
+  return mutt_mem_calloc(1, slab->obj_size);
+#else
+  if (!slab->chunks)
+    slab_grow(slab);
+
+  struct SlabChunk *chunk = slab->chunks;
+  void *obj = chunk->free_list;
+  chunk->free_list = *(void **) obj;
+  chunk->num_used++;
+
+  // Full chunks leave the list until an object is freed
+  if (!chunk->free_list)
+    slab_unlink(slab, chunk);
+
+  memset(obj, 0, slab_object_size(slab));
+  return obj;
+#endif
+}
+
+/**
+ * slab_free - Return an object to a Slab
+ * @param slab Slab
+ * @param ptr  Object to free, may be NULL
+ *
+ * If this leaves the object's chunk empty, the chunk is released, unless it's
+ * the only chunk with unused objects.  When the Slab's last object is freed,
+ * all its chunks are released.
+ *
+ * @pre The object must have been allocated from this Slab
+ */
+void slab_free(struct Slab *slab, void *ptr)
+{
+  if (!slab || !ptr)
+    return;
+
+  slab->num_used--;
+
+#ifdef SLAB_PASSTHROUGH
+  FREE(&ptr);
+#else
+  struct SlabChunk *chunk = slab_chunk_of(ptr);
+
+  // A full chunk has space again
+  const bool was_full = !chunk->free_list;
+
+  *(void **) ptr = chunk->free_list;
+  chunk->free_list = ptr;
+  chunk->num_used--;
+
+  if (was_full)
+    slab_link(slab, chunk);
+
+  if (chunk->num_used > 0)
+    return;
+
+  // Every chunk is empty, including any kept back
+  if (slab->num_used == 0)
+  {
+    slab_release(slab);
+    return;
+  }
+
+  // Keep one empty chunk back
+  if (!chunk->prev && !chunk->next)
+    return;
+
+  slab_unlink(slab, chunk);
+  FREE(&chunk);
+  slab->num_chunks--;
+#endif
+}
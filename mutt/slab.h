@@ -0,0 +1,50 @@
+/**
+ * @file
+ * Fixed-size object allocator
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUTT_MUTT_SLAB_H
+#define MUTT_MUTT_SLAB_H
+
+#include <stddef.h>
+
+struct SlabChunk;
+
+/**
+ * struct Slab - Allocator for objects of one size
+ */
+struct Slab
+{
+  size_t obj_size;          ///< Size of each object
+  struct SlabChunk *chunks; ///< Blocks of memory with unused objects
+  size_t num_used;          ///< Number of objects in use
+  size_t num_chunks;        ///< Number of chunks allocated
+};
+
+/**
+ * SLAB_INIT - Initialise a Slab
+ * @param TYPE Type of object to allocate, e.g. `struct Email`
+ */
+#define SLAB_INIT(TYPE) { sizeof(TYPE), NULL, 0, 0 }
+
+void *slab_alloc(struct Slab *slab);
+void  slab_free (struct Slab *slab, void *ptr);
+
+#endif /* MUTT_MUTT_SLAB_H */
@@ -0,0 +1,184 @@
+/**
+ * @file
+ * Hot-path timers and counters
+ *
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @page mutt_stats Hot-path timers and counters
+ *
+ * Named timers and counters for the places where NeoMutt spends its time,
+ * e.g. opening a Mailbox, or sorting the index.
+ *
+ * Each entry is a static StatsEntry, declared next to the code it measures.
+ * The first time it's used, it's added to a list, so only entries that have
+ * been used will be reported.
+ *
+ * ```c
+ * static struct StatsEntry StatsSortThreads = STATS_ENTRY("mutt_sort_threads");
+ *
+ * uint64_t start = stats_timer_start();
+ * ...
+ * stats_timer_stop(&StatsSortThreads, start);
+ * ```
+ */
+
+#include "config.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "stats.h"
+
+/// List of entries that have been used
+static struct StatsEntry *StatsList = NULL;
+
+/**
+ * stats_register - Add an entry to the list of used entries
+ * @param se Entry
+ *
+ * The list is kept sorted by name.
+ */
+static void stats_register(struct StatsEntry *se)
+{
+  struct StatsEntry **pp = &StatsList;
+  while (*pp && (strcmp((*pp)->name, se->name) < 0))
+    pp = &(*pp)->next;
+
+  se->next = *pp;
+  *pp = se;
+  se->registered = true;
+}
+
+/**
+ * stats_timer_start - Start timing something
+ * @retval num Current time in nanoseconds, to pass to stats_timer_stop()
+ */
+uint64_t stats_timer_start(void)
+{
+  struct timespec ts = { 0, 0 };
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t) ts.tv_sec * 1000000000) + ts.tv_nsec;
+}
+
+/**
+ * stats_timer_stop - Stop timing something
+ * @param se    Timer
+ * @param start Time from stats_timer_start()
+ */
+void stats_timer_stop(struct StatsEntry *se, uint64_t start)
+{
+  if (!se)
+    return;
+
+  const uint64_t elapsed = stats_timer_start() - start;
+
+  if (!se->registered)
+    stats_register(se);
+
+  se->count++;
+  se->total_ns += elapsed;
+  if (elapsed > se->max_ns)
+    se->max_ns = elapsed;
+}
+
+/**
+ * stats_count - Increase a counter
+ * @param se  Counter
+ * @param num Amount to add
+ */
+void stats_count(struct StatsEntry *se, uint64_t num)
+{
+  if (!se)
+    return;
+
+  if (!se->registered)
+    stats_register(se);
+
+  se->count += num;
+}
+
+/**
+ * stats_dump_text - Write the stats in a human-readable table
+ * @param fp File to write to
+ */
+void stats_dump_text(FILE *fp)
+{
+  if (!fp)
+    return;
+
+  fprintf(fp, "%-32s %10s %12s %12s %12s\n", "name", "count", "total ms", "mean us", "max us");
+
+  for (struct StatsEntry *se = StatsList; se; se = se->next)
+  {
+    if (se->total_ns == 0)
+    {
+      fprintf(fp, "%-32s %10llu\n", se->name, (unsigned long long) se->count);
+      continue;
+    }
+
+    const double mean = (double) se->total_ns / (se->count ? se->count : 1);
+    fprintf(fp, "%-32s %10llu %12.3f %12.3f %12.3f\n", se->name,
+            (unsigned long long) se->count, se->total_ns / 1e6, mean / 1e3,
+            se->max_ns / 1e3);
+  }
+}
+
+/**
+ * stats_dump_json - Write the stats as JSON
+ * @param fp File to write to
+ *
+ * All the times are in nanoseconds.
+ */
+void stats_dump_json(FILE *fp)
+{
+  if (!fp)
+    return;
+
+  fputs("{\n", fp);
+  for (struct StatsEntry *se = StatsList; se; se = se->next)
+  {
+    fprintf(fp, "  \"%s\": { \"count\": %llu, \"total_ns\": %llu, \"max_ns\": %llu }%s\n",
+            se->name, (unsigned long long) se->count,
+            (unsigned long long) se->total_ns, (unsigned long long) se->max_ns,
+            se->next ? "," : "");
+  }
+  fputs("}\n", fp);
+}
+
+/**
+ * stats_reset - Forget all the stats
+ */
+void stats_reset(void)
+{
+  struct StatsEntry *se = StatsList;
+  while (se)
+  {
+    struct StatsEntry *next = se->next;
+    se->count = 0;
+    se->total_ns = 0;
+    se->max_ns = 0;
+    se->registered = false;
+    se->next = NULL;
+    se = next;
+  }
+  StatsList = NULL;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file
+ * Hot-path timers and counters
+ *
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUTT_MUTT_STATS_H
+#define MUTT_MUTT_STATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * struct StatsEntry - A named timer or counter
+ */
+struct StatsEntry
+{
+  const char *name;        ///< Name, e.g. "mx_mbox_open"
+  uint64_t count;          ///< Number of calls, or events
+  uint64_t total_ns;       ///< Total time spent (timers only)
+  uint64_t max_ns;         ///< Longest single call (timers only)
+  bool registered;         ///< Entry is in the list of used entries
+  struct StatsEntry *next; ///< Next used entry
+};
+
+/**
+ * STATS_ENTRY - Initialise a StatsEntry
+ * @param NAME Name of the timer or counter
+ */
+#define STATS_ENTRY(NAME) { NAME, 0, 0, 0, false, NULL }
+
+uint64_t stats_timer_start(void);
+void     stats_timer_stop (struct StatsEntry *se, uint64_t start);
+void     stats_count      (struct StatsEntry *se, uint64_t num);
+
+void     stats_dump_json  (FILE *fp);
+void     stats_dump_text  (FILE *fp);
+void     stats_reset      (void);
+
+#endif /* MUTT_MUTT_STATS_H */
@@ -547,6 +547,16 @@ size_t mutt_str_len(const char *a)
   return a ? strlen(a) : 0;
 }
 
+/**
+ * mutt_str_mem_size - Calculate the memory used by a string
+ * @param a String to measure
+ * @retval num Size in bytes, including the NUL terminator
+ */
+size_t mutt_str_mem_size(const char *a)
+{
+  return a ? strlen(a) + 1 : 0;
+}
+
 /**
  * mutt_str_coll - Collate two strings (compare using locale), safely
  * @param a First string to compare
@@ -574,20 +584,7 @@ const char *mutt_istr_find(const char *haystack, const char *needle)
   if (!needle)
     return haystack;
 
-  const char *p = NULL, *q = NULL;
-
-  while (*(p = haystack))
-  {
-    for (q = needle;
-         *p && *q && (tolower((unsigned char) *p) == tolower((unsigned char) *q));
-         p++, q++)
-    {
-    }
-    if ((*q == '\0'))
-      return haystack;
-    haystack++;
-  }
-  return NULL;
+  return strcasestr(haystack, needle);
 }
 
 /**
@@ -63,6 +63,7 @@ bool        mutt_str_is_ascii(const char *str, size_t len);
 size_t      mutt_str_len(const char *a);
 char *      mutt_str_lower(char *str);
 size_t      mutt_str_lws_len(const char *s, size_t n);
+size_t      mutt_str_mem_size(const char *a);
 void        mutt_str_remove_trailing_ws(char *s);
 char *      mutt_str_replace(char **p, const char *s);
 char *      mutt_str_sep(char **stringp, const char *delim);
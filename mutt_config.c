@@ -211,6 +211,9 @@ static struct ConfigDef MainVars[] = {
   { "debug_level", DT_NUMBER, 0, 0, level_validator,
     "Logging level for debug logs"
   },
+  { "debug_stats_file", DT_PATH|D_PATH_FILE, 0, 0, NULL,
+    "File to save timing stats to, on exit"
+  },
   { "default_hook", DT_STRING, IP "~f %s !~P | (~P ~C %s)", 0, NULL,
     "Pattern to use for hooks that only have a simple regex"
   },
@@ -58,7 +58,7 @@
  * @param m     Mailbox
  * @param label Label
  */
-static void label_ref_dec(struct Mailbox *m, char *label)
+static void label_ref_dec(struct Mailbox *m, const char *label)
 {
   struct HashElem *he = mutt_hash_find_elem(m->label_hash, label);
   if (!he)
@@ -80,7 +80,7 @@ static void label_ref_dec(struct Mailbox *m, char *label)
  * @param m     Mailbox
  * @param label Label
  */
-static void label_ref_inc(struct Mailbox *m, char *label)
+static void label_ref_inc(struct Mailbox *m, const char *label)
 {
   uintptr_t count;
 
@@ -113,11 +113,15 @@ static bool label_message(struct Mailbox *m, struct Email *e, char *new_label)
 
   if (e->env->x_label)
     label_ref_dec(m, e->env->x_label);
-  if (mutt_str_replace(&e->env->x_label, new_label))
+  mutt_intern_release(&e->env->x_label);
+  e->env->x_label = mutt_intern_get(new_label);
+  if (e->env->x_label)
     label_ref_inc(m, e->env->x_label);
 
   e->changed = true;
   e->env->changed |= MUTT_ENV_CHANGED_XLABEL;
+  e->generation++;
+  mutt_reset_header_color(e, MUTT_PAT_DEP_HEADERS);
   return true;
 }
 
@@ -49,6 +49,9 @@ static uint64_t LastError = 0; ///< Time of the last error message (in milliseco
 static char *CurrentFile = NULL; ///< The previous log file name
 static const int NumOfLogs = 5;  ///< How many log files to rotate
 
+/// Handle for $debug_level
+static struct ConfigHandle HandleDebugLevel = CONFIG_HANDLE("debug_level");
+
 #define S_TO_MS 1000L
 
 /**
@@ -88,8 +91,7 @@ void mutt_clear_error(void)
 int log_disp_curses(time_t stamp, const char *file, int line, const char *function,
                     enum LogLevel level, const char *format, ...)
 {
-  const short c_debug_level = cs_subset_number(NeoMutt->sub, "debug_level");
-  if (level > c_debug_level)
+  if (level > cc_number(&HandleDebugLevel))
     return 0;
 
   char buf[LOG_LINE_MAX_LEN] = { 0 };
@@ -235,6 +237,11 @@ int mutt_log_set_level(enum LogLevel level, bool verbose)
     return -1;
 
   cs_subset_str_native_set(NeoMutt->sub, "debug_level", level, NULL);
+
+  // Everything else is dropped by log_disp_curses()
+  if (MuttLogger == log_disp_curses)
+    MuttLogLevel = level;
+
   return 0;
 }
 
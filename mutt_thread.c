@@ -48,6 +48,26 @@
 #include "protos.h"
 #include "sort.h"
 
+/// Handle for $hide_thread_subject
+static struct ConfigHandle HandleHideThreadSubject = CONFIG_HANDLE("hide_thread_subject");
+/// Handle for $hide_top_missing
+static struct ConfigHandle HandleHideTopMissing = CONFIG_HANDLE("hide_top_missing");
+/// Handle for $hide_missing
+static struct ConfigHandle HandleHideMissing = CONFIG_HANDLE("hide_missing");
+/// Handle for $hide_top_limited
+static struct ConfigHandle HandleHideTopLimited = CONFIG_HANDLE("hide_top_limited");
+/// Handle for $hide_limited
+static struct ConfigHandle HandleHideLimited = CONFIG_HANDLE("hide_limited");
+/// Handle for $narrow_tree
+static struct ConfigHandle HandleNarrowTree = CONFIG_HANDLE("narrow_tree");
+/// Handle for $thread_received
+static struct ConfigHandle HandleThreadReceived = CONFIG_HANDLE("thread_received");
+/// Handle for $sort_re
+static struct ConfigHandle HandleSortRe = CONFIG_HANDLE("sort_re");
+
+/// Time spent threading
+static struct StatsEntry StatsSortThreads = STATS_ENTRY("mutt_sort_threads");
+
 /**
  * UseThreadsMethods - Choices for '$use_threads' for the index
  */
@@ -138,7 +158,7 @@ static bool need_display_subject(struct Email *e)
   struct MuttThread *tree = e->thread;
 
   /* if the user disabled subject hiding, display it */
-  const bool c_hide_thread_subject = cs_subset_bool(NeoMutt->sub, "hide_thread_subject");
+  const bool c_hide_thread_subject = cc_bool(&HandleHideThreadSubject);
   if (!c_hide_thread_subject)
     return true;
 
@@ -241,11 +261,11 @@ static void calculate_visibility(struct MuttThread *tree, int *max_depth)
 
   struct MuttThread *tmp = NULL;
   struct MuttThread *orig_tree = tree;
-  const bool c_hide_top_missing = cs_subset_bool(NeoMutt->sub, "hide_top_missing");
-  const bool c_hide_missing = cs_subset_bool(NeoMutt->sub, "hide_missing");
+  const bool c_hide_top_missing = cc_bool(&HandleHideTopMissing);
+  const bool c_hide_missing = cc_bool(&HandleHideMissing);
   int hide_top_missing = c_hide_top_missing && !c_hide_missing;
-  const bool c_hide_top_limited = cs_subset_bool(NeoMutt->sub, "hide_top_limited");
-  const bool c_hide_limited = cs_subset_bool(NeoMutt->sub, "hide_limited");
+  const bool c_hide_top_limited = cc_bool(&HandleHideTopLimited);
+  const bool c_hide_limited = cc_bool(&HandleHideLimited);
   int hide_top_limited = c_hide_top_limited && !c_hide_limited;
   int depth = 0;
 
@@ -398,7 +418,7 @@ void mutt_draw_tree(struct ThreadsContext *tctx)
   const bool reverse = (mutt_thread_style() == UT_REVERSE);
   enum TreeChar corner = reverse ? MUTT_TREE_ULCORNER : MUTT_TREE_LLCORNER;
   enum TreeChar vtee = reverse ? MUTT_TREE_BTEE : MUTT_TREE_TTEE;
-  const bool c_narrow_tree = cs_subset_bool(NeoMutt->sub, "narrow_tree");
+  const bool c_narrow_tree = cc_bool(&HandleNarrowTree);
   int depth = 0, start_depth = 0, max_depth = 0, width = c_narrow_tree ? 1 : 2;
   struct MuttThread *nextdisp = NULL, *pseudo = NULL, *parent = NULL;
 
@@ -409,8 +429,8 @@ void mutt_draw_tree(struct ThreadsContext *tctx)
   calculate_visibility(tree, &max_depth);
   pfx = mutt_mem_malloc((width * max_depth) + 2);
   arrow = mutt_mem_malloc((width * max_depth) + 2);
-  const bool c_hide_limited = cs_subset_bool(NeoMutt->sub, "hide_limited");
-  const bool c_hide_missing = cs_subset_bool(NeoMutt->sub, "hide_missing");
+  const bool c_hide_limited = cc_bool(&HandleHideLimited);
+  const bool c_hide_missing = cc_bool(&HandleHideMissing);
   while (tree)
   {
     if (depth != 0)
@@ -529,8 +549,8 @@ static void make_subject_list(struct ListHead *subjects, struct MuttThread *cur,
   time_t thisdate;
   int rc = 0;
 
-  const bool c_thread_received = cs_subset_bool(NeoMutt->sub, "thread_received");
-  const bool c_sort_re = cs_subset_bool(NeoMutt->sub, "sort_re");
+  const bool c_thread_received = cc_bool(&HandleThreadReceived);
+  const bool c_sort_re = cc_bool(&HandleSortRe);
   while (true)
   {
     while (!cur->message)
@@ -549,14 +569,15 @@ static void make_subject_list(struct ListHead *subjects, struct MuttThread *cur,
       struct ListNode *np = NULL;
       STAILQ_FOREACH(np, subjects, entries)
       {
-        rc = mutt_str_cmp(env->real_subj, np->data);
+        /* Subjects are interned, so identical ones share a pointer */
+        rc = (env->real_subj == np->data) ? 0 : mutt_str_cmp(env->real_subj, np->data);
         if (rc >= 0)
           break;
       }
       if (!np)
-        mutt_list_insert_head(subjects, env->real_subj);
+        mutt_list_insert_head(subjects, (char *) env->real_subj);
       else if (rc > 0)
-        mutt_list_insert_after(subjects, np, env->real_subj);
+        mutt_list_insert_after(subjects, np, (char *) env->real_subj);
     }
 
     while (!cur->next && (cur != start))
@@ -591,7 +612,7 @@ static struct MuttThread *find_subject(struct Mailbox *m, struct MuttThread *cur
   make_subject_list(&subjects, cur, &date);
 
   struct ListNode *np = NULL;
-  const bool c_thread_received = cs_subset_bool(NeoMutt->sub, "thread_received");
+  const bool c_thread_received = cc_bool(&HandleThreadReceived);
   STAILQ_FOREACH(np, &subjects, entries)
   {
     for (he = mutt_hash_find_bucket(m->subj_hash, np->data); he; he = he->next)
@@ -1034,6 +1055,7 @@ void mutt_sort_threads(struct ThreadsContext *tctx, bool init)
   if (!tctx || !tctx->mailbox_view)
     return;
 
+  const uint64_t start = stats_timer_start();
   struct MailboxView *mv = tctx->mailbox_view;
   struct Mailbox *m = mv->mailbox;
 
@@ -1275,6 +1297,8 @@ void mutt_sort_threads(struct ThreadsContext *tctx, bool init)
     /* Draw the thread tree. */
     mutt_draw_tree(tctx);
   }
+
+  stats_timer_stop(&StatsSortThreads, start);
 }
 
 /**
@@ -1397,6 +1421,36 @@ int mutt_parent_message(struct Email *e, bool find_root)
   return e_parent->vnum;
 }
 
+/**
+ * number_visible - Number the Emails with a virtual number
+ * @param[in]  m       Mailbox
+ * @param[in]  padding Padding between messages, see mx_msg_padding_size()
+ * @param[out] vsize   Size in bytes of all messages shown
+ * @retval true  Success
+ * @retval false The Bitset doesn't match the Emails
+ */
+static bool number_visible(struct Mailbox *m, int padding, off_t *vsize)
+{
+  m->vcount = 0;
+  *vsize = 0;
+
+  // Only visit the Emails with a virtual number
+  const struct Bitset *bs = &m->bits[MB_VISIBLE];
+  for (size_t i = bitset_next(bs, 0); i < bs->size; i = bitset_next(bs, i + 1))
+  {
+    struct Email *e = m->emails[i];
+    if (!e || (e->vnum < 0))
+      return false;
+
+    e->vnum = m->vcount;
+    m->v2r[m->vcount] = i;
+    m->vcount++;
+    *vsize += e->body->length + e->body->offset - e->body->hdr_offset + padding;
+  }
+
+  return true;
+}
+
 /**
  * mutt_set_vnum - Set the virtual index number of all the messages in a mailbox
  * @param m       Mailbox
@@ -1410,21 +1464,14 @@ off_t mutt_set_vnum(struct Mailbox *m)
   off_t vsize = 0;
   const int padding = mx_msg_padding_size(m);
 
-  m->vcount = 0;
+  // New Emails have arrived, or the Emails have moved
+  if (mailbox_bits_stale(m, MB_VISIBLE))
+    mailbox_bits_rebuild(m);
 
-  for (int i = 0; i < m->msg_count; i++)
+  if (!number_visible(m, padding, &vsize))
   {
-    struct Email *e = m->emails[i];
-    if (!e)
-      break;
-
-    if (e->vnum >= 0)
-    {
-      e->vnum = m->vcount;
-      m->v2r[m->vcount] = i;
-      m->vcount++;
-      vsize += e->body->length + e->body->offset - e->body->hdr_offset + padding;
-    }
+    mailbox_bits_rebuild(m);
+    number_visible(m, padding, &vsize);
   }
 
   return vsize;
@@ -1432,11 +1479,12 @@ off_t mutt_set_vnum(struct Mailbox *m)
 
 /**
  * mutt_traverse_thread - Recurse through an email thread, matching messages
+ * @param m     Mailbox, only needed to collapse or uncollapse
  * @param e_cur Current Email
  * @param flag  Flag to set, see #MuttThreadFlags
  * @retval num Number of matches
  */
-int mutt_traverse_thread(struct Email *e_cur, MuttThreadFlags flag)
+int mutt_traverse_thread(struct Mailbox *m, struct Email *e_cur, MuttThreadFlags flag)
 {
   struct MuttThread *thread = NULL, *top = NULL;
   struct Email *e_root = NULL;
@@ -1541,12 +1589,12 @@ int mutt_traverse_thread(struct Email *e_cur, MuttThreadFlags flag)
         if (flag & MUTT_THREAD_COLLAPSE)
         {
           if (e_cur != e_root)
-            e_cur->vnum = -1;
+            mailbox_vnum_set(m, e_cur, -1);
         }
         else
         {
           if (e_cur->visible)
-            e_cur->vnum = e_cur->msgno;
+            mailbox_vnum_set(m, e_cur, e_cur->msgno);
         }
       }
 
@@ -1768,6 +1816,7 @@ bool mutt_link_threads(struct Email *parent, struct EmailArray *children, struct
  */
 void mutt_thread_collapse_collapsed(struct ThreadsContext *tctx)
 {
+  struct Mailbox *m = tctx->mailbox_view ? tctx->mailbox_view->mailbox : NULL;
   struct MuttThread *thread = NULL;
   struct MuttThread *top = tctx->tree;
   while ((thread = top))
@@ -1777,7 +1826,7 @@ void mutt_thread_collapse_collapsed(struct ThreadsContext *tctx)
 
     struct Email *e = thread->message;
     if (e->collapsed)
-      mutt_collapse_thread(e);
+      mutt_collapse_thread(m, e);
     top = top->next;
   }
 }
@@ -1789,6 +1838,7 @@ void mutt_thread_collapse_collapsed(struct ThreadsContext *tctx)
  */
 void mutt_thread_collapse(struct ThreadsContext *tctx, bool collapse)
 {
+  struct Mailbox *m = tctx->mailbox_view ? tctx->mailbox_view->mailbox : NULL;
   struct MuttThread *thread = NULL;
   struct MuttThread *top = tctx->tree;
   while ((thread = top))
@@ -1801,9 +1851,9 @@ void mutt_thread_collapse(struct ThreadsContext *tctx, bool collapse)
     if (e->collapsed != collapse)
     {
       if (e->collapsed)
-        mutt_uncollapse_thread(e);
+        mutt_uncollapse_thread(m, e);
       else if (mutt_thread_can_collapse(e))
-        mutt_collapse_thread(e);
+        mutt_collapse_thread(m, e);
     }
     top = top->next;
   }
@@ -103,12 +103,12 @@ enum UseThreads
 
 extern const struct EnumDef UseThreadsTypeDef;
 
-int mutt_traverse_thread(struct Email *e, MuttThreadFlags flag);
-#define mutt_collapse_thread(e)         mutt_traverse_thread(e, MUTT_THREAD_COLLAPSE)
-#define mutt_uncollapse_thread(e)       mutt_traverse_thread(e, MUTT_THREAD_UNCOLLAPSE)
-#define mutt_thread_contains_unread(e)  mutt_traverse_thread(e, MUTT_THREAD_UNREAD)
-#define mutt_thread_contains_flagged(e) mutt_traverse_thread(e, MUTT_THREAD_FLAGGED)
-#define mutt_thread_next_unread(e)      mutt_traverse_thread(e, MUTT_THREAD_NEXT_UNREAD)
+int mutt_traverse_thread(struct Mailbox *m, struct Email *e, MuttThreadFlags flag);
+#define mutt_collapse_thread(m, e)      mutt_traverse_thread(m, e, MUTT_THREAD_COLLAPSE)
+#define mutt_uncollapse_thread(m, e)    mutt_traverse_thread(m, e, MUTT_THREAD_UNCOLLAPSE)
+#define mutt_thread_contains_unread(e)  mutt_traverse_thread(NULL, e, MUTT_THREAD_UNREAD)
+#define mutt_thread_contains_flagged(e) mutt_traverse_thread(NULL, e, MUTT_THREAD_FLAGGED)
+#define mutt_thread_next_unread(e)      mutt_traverse_thread(NULL, e, MUTT_THREAD_NEXT_UNREAD)
 
 enum UseThreads mutt_thread_style(void);
 #define mutt_using_threads() (mutt_thread_style() > UT_FLAT)
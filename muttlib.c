@@ -726,546 +726,6 @@ void mutt_safe_path(struct Buffer *dest, const struct Address *a)
       *p = '_';
 }
 
-/**
- * mutt_expando_format - Expand expandos (%x) in a string - @ingroup expando_api
- * @param[out] buf      Buffer in which to save string
- * @param[in]  buflen   Buffer length
- * @param[in]  col      Starting column
- * @param[in]  cols     Number of screen columns
- * @param[in]  src      Printf-like format string
- * @param[in]  callback Callback - Implements ::format_t
- * @param[in]  data     Callback data
- * @param[in]  flags    Callback flags
- */
-void mutt_expando_format(char *buf, size_t buflen, size_t col, int cols, const char *src,
-                         format_t callback, intptr_t data, MuttFormatFlags flags)
-{
-  char prefix[128] = { 0 };
-  char tmp[1024] = { 0 };
-  char *cp = NULL, *wptr = buf;
-  char ch;
-  char if_str[128] = { 0 };
-  char else_str[128] = { 0 };
-  size_t wlen, count, len, wid;
-  FILE *fp_filter = NULL;
-  char *recycler = NULL;
-
-  char src2[1024] = { 0 };
-  mutt_str_copy(src2, src, mutt_str_len(src) + 1);
-  src = src2;
-
-  const bool c_arrow_cursor = cs_subset_bool(NeoMutt->sub, "arrow_cursor");
-  const char *const c_arrow_string = cs_subset_string(NeoMutt->sub, "arrow_string");
-  const int arrow_width = mutt_strwidth(c_arrow_string);
-
-  prefix[0] = '\0';
-  buflen--; /* save room for the terminal \0 */
-  wlen = ((flags & MUTT_FORMAT_ARROWCURSOR) && c_arrow_cursor) ? arrow_width + 1 : 0;
-  col += wlen;
-
-  if ((flags & MUTT_FORMAT_NOFILTER) == 0)
-  {
-    int off = -1;
-
-    /* Do not consider filters if no pipe at end */
-    int n = mutt_str_len(src);
-    if ((n > 1) && (src[n - 1] == '|'))
-    {
-      /* Scan backwards for backslashes */
-      off = n;
-      while ((off > 0) && (src[off - 2] == '\\'))
-        off--;
-    }
-
-    /* If number of backslashes is even, the pipe is real. */
-    /* n-off is the number of backslashes. */
-    if ((off > 0) && (((n - off) % 2) == 0))
-    {
-      char srccopy[1024] = { 0 };
-      int i = 0;
-
-      mutt_debug(LL_DEBUG3, "fmtpipe = %s\n", src);
-
-      strncpy(srccopy, src, n);
-      srccopy[n - 1] = '\0';
-
-      /* prepare Buffers */
-      struct Buffer srcbuf = buf_make(0);
-      buf_addstr(&srcbuf, srccopy);
-      /* note: we are resetting dptr and *reading* from the buffer, so we don't
-       * want to use buf_reset(). */
-      buf_seek(&srcbuf, 0);
-      struct Buffer word = buf_make(0);
-      struct Buffer cmd = buf_make(0);
-
-      /* Iterate expansions across successive arguments */
-      do
-      {
-        /* Extract the command name and copy to command line */
-        mutt_debug(LL_DEBUG3, "fmtpipe +++: %s\n", srcbuf.dptr);
-        if (word.data)
-          *word.data = '\0';
-        parse_extract_token(&word, &srcbuf, TOKEN_NO_FLAGS);
-        mutt_debug(LL_DEBUG3, "fmtpipe %2d: %s\n", i++, word.data);
-        buf_addch(&cmd, '\'');
-        mutt_expando_format(tmp, sizeof(tmp), 0, cols, word.data, callback,
-                            data, flags | MUTT_FORMAT_NOFILTER);
-        for (char *p = tmp; p && (*p != '\0'); p++)
-        {
-          if (*p == '\'')
-          {
-            /* shell quoting doesn't permit escaping a single quote within
-             * single-quoted material.  double-quoting instead will lead
-             * shell variable expansions, so break out of the single-quoted
-             * span, insert a double-quoted single quote, and resume. */
-            buf_addstr(&cmd, "'\"'\"'");
-          }
-          else
-          {
-            buf_addch(&cmd, *p);
-          }
-        }
-        buf_addch(&cmd, '\'');
-        buf_addch(&cmd, ' ');
-      } while (MoreArgs(&srcbuf));
-
-      mutt_debug(LL_DEBUG3, "fmtpipe > %s\n", cmd.data);
-
-      col -= wlen; /* reset to passed in value */
-      wptr = buf;  /* reset write ptr */
-      pid_t pid = filter_create(cmd.data, NULL, &fp_filter, NULL, EnvList);
-      if (pid != -1)
-      {
-        int rc;
-
-        n = fread(buf, 1, buflen /* already decremented */, fp_filter);
-        mutt_file_fclose(&fp_filter);
-        rc = filter_wait(pid);
-        if (rc != 0)
-          mutt_debug(LL_DEBUG1, "format pipe cmd exited code %d\n", rc);
-        if (n > 0)
-        {
-          buf[n] = '\0';
-          while ((n > 0) && ((buf[n - 1] == '\n') || (buf[n - 1] == '\r')))
-            buf[--n] = '\0';
-          mutt_debug(LL_DEBUG5, "fmtpipe < %s\n", buf);
-
-          /* If the result ends with '%', this indicates that the filter
-           * generated %-tokens that neomutt can expand.  Eliminate the '%'
-           * marker and recycle the string through mutt_expando_format().
-           * To literally end with "%", use "%%". */
-          if ((n > 0) && (buf[n - 1] == '%'))
-          {
-            n--;
-            buf[n] = '\0'; /* remove '%' */
-            if ((n > 0) && (buf[n - 1] != '%'))
-            {
-              recycler = mutt_str_dup(buf);
-              if (recycler)
-              {
-                /* buflen is decremented at the start of this function
-                 * to save space for the terminal nul char.  We can add
-                 * it back for the recursive call since the expansion of
-                 * format pipes does not try to append a nul itself.  */
-                mutt_expando_format(buf, buflen + 1, col, cols, recycler,
-                                    callback, data, flags);
-                FREE(&recycler);
-              }
-            }
-          }
-        }
-        else
-        {
-          /* read error */
-          mutt_debug(LL_DEBUG1, "error reading from fmtpipe: %s (errno=%d)\n",
-                     strerror(errno), errno);
-          *wptr = '\0';
-        }
-      }
-      else
-      {
-        /* Filter failed; erase write buffer */
-        *wptr = '\0';
-      }
-
-      buf_dealloc(&cmd);
-      buf_dealloc(&srcbuf);
-      buf_dealloc(&word);
-      return;
-    }
-  }
-
-  while (*src && (wlen < buflen))
-  {
-    if (*src == '%')
-    {
-      if (*++src == '%')
-      {
-        *wptr++ = '%';
-        wlen++;
-        col++;
-        src++;
-        continue;
-      }
-
-      if (*src == '?')
-      {
-        /* change original %? to new %< notation */
-        /* %?x?y&z? to %<x?y&z> where y and z are nestable */
-        char *p = (char *) src;
-        *p = '<';
-        /* skip over "x" */
-        for (; *p && (*p != '?'); p++)
-          ; // do nothing
-
-        /* nothing */
-        if (*p == '?')
-          p++;
-        /* fix up the "y&z" section */
-        for (; *p && (*p != '?'); p++)
-        {
-          /* escape '<' and '>' to work inside nested-if */
-          if ((*p == '<') || (*p == '>'))
-          {
-            memmove(p + 2, p, mutt_str_len(p) + 1);
-            *p++ = '\\';
-            *p++ = '\\';
-          }
-        }
-        if (*p == '?')
-          *p = '>';
-      }
-
-      if (*src == '<')
-      {
-        flags |= MUTT_FORMAT_OPTIONAL;
-        ch = *(++src); /* save the character to switch on */
-        src++;
-        cp = prefix;
-        count = 0;
-        while ((count < (sizeof(prefix) - 1)) && (*src != '\0') && (*src != '?'))
-        {
-          *cp++ = *src++;
-          count++;
-        }
-        *cp = '\0';
-      }
-      else
-      {
-        flags &= ~MUTT_FORMAT_OPTIONAL;
-
-        /* eat the format string */
-        cp = prefix;
-        count = 0;
-        while ((count < (sizeof(prefix) - 1)) && strchr("0123456789.-=", *src))
-        {
-          *cp++ = *src++;
-          count++;
-        }
-        *cp = '\0';
-
-        if (*src == '\0')
-          break; /* bad format */
-
-        ch = *src++; /* save the character to switch on */
-      }
-
-      if (flags & MUTT_FORMAT_OPTIONAL)
-      {
-        int lrbalance;
-
-        if (*src != '?')
-          break; /* bad format */
-        src++;
-
-        /* eat the 'if' part of the string */
-        cp = if_str;
-        count = 0;
-        lrbalance = 1;
-        while ((lrbalance > 0) && (count < sizeof(if_str)) && *src)
-        {
-          if ((src[0] == '%') && (src[1] == '>'))
-          {
-            /* This is a padding expando; copy two chars and carry on */
-            *cp++ = *src++;
-            *cp++ = *src++;
-            count += 2;
-            continue;
-          }
-
-          if (*src == '\\')
-          {
-            src++;
-            *cp++ = *src++;
-          }
-          else if ((src[0] == '%') && (src[1] == '<'))
-          {
-            lrbalance++;
-          }
-          else if (src[0] == '>')
-          {
-            lrbalance--;
-          }
-          if (lrbalance == 0)
-            break;
-          if ((lrbalance == 1) && (src[0] == '&'))
-            break;
-          *cp++ = *src++;
-          count++;
-        }
-        *cp = '\0';
-
-        /* eat the 'else' part of the string (optional) */
-        if (*src == '&')
-          src++; /* skip the & */
-        cp = else_str;
-        count = 0;
-        while ((lrbalance > 0) && (count < sizeof(else_str)) && (*src != '\0'))
-        {
-          if ((src[0] == '%') && (src[1] == '>'))
-          {
-            /* This is a padding expando; copy two chars and carry on */
-            *cp++ = *src++;
-            *cp++ = *src++;
-            count += 2;
-            continue;
-          }
-
-          if (*src == '\\')
-          {
-            src++;
-            *cp++ = *src++;
-          }
-          else if ((src[0] == '%') && (src[1] == '<'))
-          {
-            lrbalance++;
-          }
-          else if (src[0] == '>')
-          {
-            lrbalance--;
-          }
-          if (lrbalance == 0)
-            break;
-          if ((lrbalance == 1) && (src[0] == '&'))
-            break;
-          *cp++ = *src++;
-          count++;
-        }
-        *cp = '\0';
-
-        if ((*src == '\0'))
-          break; /* bad format */
-
-        src++; /* move past the trailing '>' (formerly '?') */
-      }
-
-      /* handle generic cases first */
-      if ((ch == '>') || (ch == '*'))
-      {
-        /* %>X: right justify to EOL, left takes precedence
-         * %*X: right justify to EOL, right takes precedence */
-        int soft = ch == '*';
-        int pl, pw;
-        pl = mutt_mb_charlen(src, &pw);
-        if (pl <= 0)
-        {
-          pl = 1;
-          pw = 1;
-        }
-
-        /* see if there's room to add content, else ignore */
-        if (((col < cols) && (wlen < buflen)) || soft)
-        {
-          int pad;
-
-          /* get contents after padding */
-          mutt_expando_format(tmp, sizeof(tmp), 0, cols, src + pl, callback, data, flags);
-          len = mutt_str_len(tmp);
-          wid = mutt_strwidth(tmp);
-
-          pad = (cols - col - wid) / pw;
-          if (pad >= 0)
-          {
-            /* try to consume as many columns as we can, if we don't have
-             * memory for that, use as much memory as possible */
-            if (wlen + (pad * pl) + len > buflen)
-            {
-              pad = (buflen > (wlen + len)) ? ((buflen - wlen - len) / pl) : 0;
-            }
-            else
-            {
-              /* Add pre-spacing to make multi-column pad characters and
-               * the contents after padding line up */
-              while (((col + (pad * pw) + wid) < cols) && ((wlen + (pad * pl) + len) < buflen))
-              {
-                *wptr++ = ' ';
-                wlen++;
-                col++;
-              }
-            }
-            while (pad-- > 0)
-            {
-              memcpy(wptr, src, pl);
-              wptr += pl;
-              wlen += pl;
-              col += pw;
-            }
-          }
-          else if (soft)
-          {
-            int offset = ((flags & MUTT_FORMAT_ARROWCURSOR) && c_arrow_cursor) ?
-                             arrow_width + 1 :
-                             0;
-            int avail_cols = (cols > offset) ? (cols - offset) : 0;
-            /* \0-terminate buf for length computation in mutt_wstr_trunc() */
-            *wptr = '\0';
-            /* make sure right part is at most as wide as display */
-            len = mutt_wstr_trunc(tmp, buflen, avail_cols, &wid);
-            /* truncate left so that right part fits completely in */
-            wlen = mutt_wstr_trunc(buf, buflen - len, avail_cols - wid, &col);
-            wptr = buf + wlen;
-            /* Multi-column characters may be truncated in the middle.
-             * Add spacing so the right hand side lines up. */
-            while (((col + wid) < avail_cols) && ((wlen + len) < buflen))
-            {
-              *wptr++ = ' ';
-              wlen++;
-              col++;
-            }
-          }
-          if ((len + wlen) > buflen)
-            len = mutt_wstr_trunc(tmp, buflen - wlen, cols - col, NULL);
-          memcpy(wptr, tmp, len);
-          wptr += len;
-        }
-        break; /* skip rest of input */
-      }
-      else if (ch == '|')
-      {
-        /* pad to EOL */
-        int pl, pw;
-        pl = mutt_mb_charlen(src, &pw);
-        if (pl <= 0)
-        {
-          pl = 1;
-          pw = 1;
-        }
-
-        /* see if there's room to add content, else ignore */
-        if ((col < cols) && (wlen < buflen))
-        {
-          int c = (cols - col) / pw;
-          if ((c > 0) && ((wlen + (c * pl)) > buflen))
-            c = ((signed) (buflen - wlen)) / pl;
-          while (c > 0)
-          {
-            memcpy(wptr, src, pl);
-            wptr += pl;
-            wlen += pl;
-            col += pw;
-            c--;
-          }
-        }
-        break; /* skip rest of input */
-      }
-      else
-      {
-        bool to_lower = false;
-        bool no_dots = false;
-
-        while ((ch == '_') || (ch == ':'))
-        {
-          if (ch == '_')
-            to_lower = true;
-          else if (ch == ':')
-            no_dots = true;
-
-          ch = *src++;
-        }
-
-        /* use callback function to handle this case */
-        *tmp = '\0';
-        src = callback(tmp, sizeof(tmp), col, cols, ch, src, prefix, if_str,
-                       else_str, data, flags);
-
-        if (to_lower)
-          mutt_str_lower(tmp);
-        if (no_dots)
-        {
-          char *p = tmp;
-          for (; *p; p++)
-            if (*p == '.')
-              *p = '_';
-        }
-
-        len = mutt_str_len(tmp);
-        if ((len + wlen) > buflen)
-          len = mutt_wstr_trunc(tmp, buflen - wlen, cols - col, NULL);
-
-        memcpy(wptr, tmp, len);
-        wptr += len;
-        wlen += len;
-        col += mutt_strwidth(tmp);
-      }
-    }
-    else if (*src == '\\')
-    {
-      if (!*++src)
-        break;
-      switch (*src)
-      {
-        case 'f':
-          *wptr = '\f';
-          break;
-        case 'n':
-          *wptr = '\n';
-          break;
-        case 'r':
-          *wptr = '\r';
-          break;
-        case 't':
-          *wptr = '\t';
-          break;
-        case 'v':
-          *wptr = '\v';
-          break;
-        default:
-          *wptr = *src;
-          break;
-      }
-      src++;
-      wptr++;
-      wlen++;
-      col++;
-    }
-    else
-    {
-      int bytes, width;
-      /* in case of error, simply copy byte */
-      bytes = mutt_mb_charlen(src, &width);
-      if (bytes < 0)
-      {
-        bytes = 1;
-        width = 1;
-      }
-      if ((bytes > 0) && ((wlen + bytes) < buflen))
-      {
-        memcpy(wptr, src, bytes);
-        wptr += bytes;
-        src += bytes;
-        wlen += bytes;
-        col += width;
-      }
-      else
-      {
-        src += buflen - wlen;
-        wlen = buflen;
-      }
-    }
-  }
-  *wptr = '\0';
-}
-
 /**
  * mutt_open_read - Run a command to read from
  * @param[in]  path   Path to command
@@ -77,6 +77,7 @@ void mview_free(struct MailboxView **ptr)
   notify_free(&mv->notify);
   FREE(&mv->pattern);
   mutt_pattern_free(&mv->limit_pattern);
+  mutt_pattern_memo_free(&mv->memo);
 
   *ptr = NULL;
   FREE(&mv);
@@ -120,6 +121,7 @@ static void mview_clean(struct MailboxView *mv)
 {
   FREE(&mv->pattern);
   mutt_pattern_free(&mv->limit_pattern);
+  mutt_pattern_memo_free(&mv->memo);
   if (mv->mailbox)
     notify_observer_remove(mv->mailbox->notify, mview_mailbox_observer, mv);
 
@@ -146,14 +148,9 @@ void mview_update(struct MailboxView *mv)
   mutt_hash_free(&m->subj_hash);
   mutt_hash_free(&m->id_hash);
 
-  /* reset counters */
-  m->msg_unread = 0;
-  m->msg_flagged = 0;
-  m->msg_new = 0;
-  m->msg_deleted = 0;
-  m->msg_tagged = 0;
   m->vcount = 0;
   m->changed = false;
+  mailbox_bits_resize(m);
 
   mutt_clear_threads(mv->threads);
 
@@ -171,16 +168,16 @@ void mview_update(struct MailboxView *mv)
       e->security = crypt_query(e->body);
     }
 
+    e->msgno = msgno;
     if (mview_has_limit(mv))
     {
-      e->vnum = -1;
+      mailbox_vnum_set(m, e, -1);
     }
     else
     {
       m->v2r[m->vcount] = msgno;
-      e->vnum = m->vcount++;
+      mailbox_vnum_set(m, e, m->vcount++);
     }
-    e->msgno = msgno;
 
     if (e->env->supersedes)
     {
@@ -210,20 +207,11 @@ void mview_update(struct MailboxView *mv)
 
     if (e->changed)
       m->changed = true;
-    if (e->flagged)
-      m->msg_flagged++;
-    if (e->deleted)
-      m->msg_deleted++;
-    if (e->tagged)
-      m->msg_tagged++;
-    if (!e->read)
-    {
-      m->msg_unread++;
-      if (!e->old)
-        m->msg_new++;
-    }
+    mailbox_bits_set(m, e);
   }
 
+  mailbox_bits_count(m);
+
   /* rethread from scratch */
   mutt_sort_headers(mv, true);
 }
@@ -244,13 +232,9 @@ static void update_tables(struct MailboxView *mv)
   /* update memory to reflect the new state of the mailbox */
   m->vcount = 0;
   mv->vsize = 0;
-  m->msg_tagged = 0;
-  m->msg_deleted = 0;
-  m->msg_new = 0;
-  m->msg_unread = 0;
   m->changed = false;
-  m->msg_flagged = 0;
   padding = mx_msg_padding_size(m);
+  mailbox_bits_resize(m);
   const bool c_maildir_trash = cs_subset_bool(NeoMutt->sub, "maildir_trash");
   for (i = 0, j = 0; i < m->msg_count; i++)
   {
@@ -268,30 +252,20 @@ static void update_tables(struct MailboxView *mv)
       if (m->emails[j]->vnum != -1)
       {
         m->v2r[m->vcount] = j;
-        m->emails[j]->vnum = m->vcount++;
+        mailbox_vnum_set(m, m->emails[j], m->vcount++);
         struct Body *b = m->emails[j]->body;
         mv->vsize += b->length + b->offset - b->hdr_offset + padding;
       }
+      else
+      {
+        mailbox_vnum_set(m, m->emails[j], -1);
+      }
 
       m->emails[j]->changed = false;
       m->emails[j]->env->changed = false;
 
-      if ((m->type == MUTT_MAILDIR) && c_maildir_trash)
-      {
-        if (m->emails[j]->deleted)
-          m->msg_deleted++;
-      }
-
-      if (m->emails[j]->tagged)
-        m->msg_tagged++;
-      if (m->emails[j]->flagged)
-        m->msg_flagged++;
-      if (!m->emails[j]->read)
-      {
-        m->msg_unread++;
-        if (!m->emails[j]->old)
-          m->msg_new++;
-      }
+      // Deleted Emails are only kept when using $maildir_trash
+      mailbox_bits_set(m, m->emails[j]);
 
       j++;
     }
@@ -317,6 +291,9 @@ static void update_tables(struct MailboxView *mv)
     }
   }
   m->msg_count = j;
+
+  mailbox_bits_resize(m);
+  mailbox_bits_count(m);
 }
 
 /**
@@ -383,15 +360,37 @@ int ea_add_tagged(struct EmailArray *ea, struct MailboxView *mv, struct Email *e
       return -1;
 
     struct Mailbox *m = mv->mailbox;
-    for (int i = 0; i < m->msg_count; i++)
+    const struct Bitset *bs = &m->bits[MB_TAGGED];
+    const int start = ARRAY_SIZE(ea);
+
+    // Only visit the Emails that were tagged
+    int found = 0;
+    for (size_t i = bitset_next(bs, 0); i < bs->size; i = bitset_next(bs, i + 1))
     {
-      e = m->emails[i];
-      if (!e)
-        break;
-      if (!message_is_tagged(e))
+      e = ((int) i < m->msg_count) ? m->emails[i] : NULL;
+      if (!e || !e->tagged)
         continue;
 
-      ARRAY_ADD(ea, e);
+      found++;
+      if (e->visible)
+        ARRAY_ADD(ea, e);
+    }
+
+    // The Bitset is stale; walk all the Emails and rebuild it
+    if (found != m->msg_tagged)
+    {
+      ARRAY_SHRINK(ea, ARRAY_SIZE(ea) - start);
+      mailbox_bits_rebuild(m);
+      for (int i = 0; i < m->msg_count; i++)
+      {
+        e = m->emails[i];
+        if (!e)
+          break;
+        if (!message_is_tagged(e))
+          continue;
+
+        ARRAY_ADD(ea, e);
+      }
     }
   }
   else
@@ -499,7 +498,7 @@ bool mutt_limit_current_thread(struct MailboxView *mv, struct Email *e)
     if (!e)
       break;
 
-    e->vnum = -1;
+    mailbox_vnum_set(m, e, -1);
     e->visible = false;
     e->collapsed = false;
     e->num_hidden = 0;
@@ -508,7 +507,7 @@ bool mutt_limit_current_thread(struct MailboxView *mv, struct Email *e)
     {
       struct Body *body = e->body;
 
-      e->vnum = m->vcount;
+      mailbox_vnum_set(m, e, m->vcount);
       e->visible = true;
       m->v2r[m->vcount] = i;
       m->vcount++;
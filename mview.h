@@ -45,6 +45,7 @@ struct MailboxView
   int msg_in_pager;                  ///< Message currently shown in the pager
 
   struct Menu *menu;                 ///< Needed for pattern compilation
+  struct PatternMemo *memo;          ///< Cached results of recent limits
 
   bool collapsed : 1;                ///< Are all threads collapsed?
 
@@ -93,6 +93,9 @@ const struct EnumDef MboxTypeDef = {
   (struct Mapping *) &MboxTypeMap,
 };
 
+/// Time spent opening Mailboxes
+static struct StatsEntry StatsMboxOpen = STATS_ENTRY("mx_mbox_open");
+
 /**
  * MxOps - All the Mailbox backends
  */
@@ -277,13 +280,13 @@ bool mx_mbox_ac_link(struct Mailbox *m)
 }
 
 /**
- * mx_mbox_open - Open a mailbox and parse it
+ * mx_open_mailbox - Open a mailbox and parse it
  * @param m     Mailbox to open
  * @param flags Flags, see #OpenMailboxFlags
  * @retval true Success
  * @retval false Error
  */
-bool mx_mbox_open(struct Mailbox *m, OpenMailboxFlags flags)
+static bool mx_open_mailbox(struct Mailbox *m, OpenMailboxFlags flags)
 {
   if (!m)
     return false;
@@ -404,6 +407,21 @@ error:
   return false;
 }
 
+/**
+ * mx_mbox_open - Open a mailbox and parse it
+ * @param m     Mailbox to open
+ * @param flags Flags, see #OpenMailboxFlags
+ * @retval true Success
+ * @retval false Error
+ */
+bool mx_mbox_open(struct Mailbox *m, OpenMailboxFlags flags)
+{
+  const uint64_t start = stats_timer_start();
+  const bool rc = mx_open_mailbox(m, flags);
+  stats_timer_stop(&StatsMboxOpen, start);
+  return rc;
+}
+
 /**
  * mx_fastclose_mailbox - Free up memory associated with the Mailbox
  * @param m Mailbox
@@ -830,6 +848,7 @@ enum MxStatus mx_mbox_close(struct Mailbox *m)
 
         e->deleted = false;
         e->purge = false;
+        mailbox_email_changed(m, e);
       }
       m->msg_deleted = 0;
     }
@@ -959,6 +978,7 @@ enum MxStatus mx_mbox_sync(struct Mailbox *m)
             break;
           e->deleted = false;
           e->purge = false;
+          mailbox_email_changed(m, e);
         }
         m->msg_deleted = 0;
       }
@@ -1118,6 +1138,11 @@ enum MxStatus mx_mbox_check(struct Mailbox *m)
   {
     mailbox_changed(m, NT_MAILBOX_INVALID);
   }
+  else if (rc == MX_STATUS_FLAGS)
+  {
+    /* The backend may have written the flags directly */
+    mailbox_bits_rebuild(m);
+  }
 
   return rc;
 }
@@ -1295,7 +1320,12 @@ int mx_tags_commit(struct Mailbox *m, struct Email *e, const char *tags)
     return -1;
 
   if (m->mx_ops->tags_commit)
-    return m->mx_ops->tags_commit(m, e, tags);
+  {
+    const int rc = m->mx_ops->tags_commit(m, e, tags);
+    if (rc == 0)
+      e->generation++;
+    return rc;
+  }
 
   mutt_message(_("Folder doesn't support tagging, aborting"));
   return -1;
@@ -1566,6 +1566,7 @@ static enum MxStatus check_mailbox(struct Mailbox *m)
         nntp_article_status(m, m->emails[i], NULL, anum);
         if (!m->emails[i]->read)
           nntp_parse_xref(m, m->emails[i]);
+        mailbox_email_changed(m, m->emails[i]);
       }
       m->emails[j++] = m->emails[i];
     }
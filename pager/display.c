@@ -46,6 +46,23 @@
 #include "color/lib.h"
 #include "private_data.h"
 
+/// Handle for $markers
+static struct ConfigHandle HandleMarkers = CONFIG_HANDLE("markers");
+/// Handle for $smileys
+static struct ConfigHandle HandleSmileys = CONFIG_HANDLE("smileys");
+/// Handle for $quote_regex
+static struct ConfigHandle HandleQuoteRegex = CONFIG_HANDLE("quote_regex");
+/// Handle for $header_color_partial
+static struct ConfigHandle HandleHeaderColorPartial = CONFIG_HANDLE("header_color_partial");
+/// Handle for $wrap
+static struct ConfigHandle HandleWrap = CONFIG_HANDLE("wrap");
+/// Handle for $allow_ansi
+static struct ConfigHandle HandleAllowAnsi = CONFIG_HANDLE("allow_ansi");
+/// Handle for $toggle_quoted_show_levels
+static struct ConfigHandle HandleToggleQuotedShowLevels = CONFIG_HANDLE("toggle_quoted_show_levels");
+/// Handle for $smart_wrap
+static struct ConfigHandle HandleSmartWrap = CONFIG_HANDLE("smart_wrap");
+
 /**
  * check_sig - Check for an email signature
  * @param s      Text to examine
@@ -134,7 +151,7 @@ static void resolve_color(struct MuttWindow *win, struct Line *lines, int line_n
 
   if (lines[line_num].cont_line)
   {
-    const bool c_markers = cs_subset_bool(NeoMutt->sub, "markers");
+    const bool c_markers = cc_bool(&HandleMarkers);
     if (!cnt && c_markers)
     {
       last_color = *mutt_curses_set_color_by_id(MT_COLOR_MARKERS);
@@ -264,9 +281,10 @@ static void append_line(struct Line *lines, int line_num, int cnt)
   lines[line_num + 1].cont_line = true;
 
   /* find the real start of the line */
-  for (m = line_num; m >= 0; m--)
-    if (!lines[m].cont_line)
-      break;
+  if (lines[line_num].cont_line)
+    m = (lines[line_num].syntax)[0].first;
+  else
+    m = line_num;
 
   (lines[line_num + 1].syntax)[0].first = m;
   (lines[line_num + 1].syntax)[0].last = (lines[line_num].cont_line) ?
@@ -323,13 +341,13 @@ static int check_protected_header_marker(const char *p)
 bool mutt_is_quote_line(char *line, regmatch_t *pmatch)
 {
   bool is_quote = false;
-  const struct Regex *c_smileys = cs_subset_regex(NeoMutt->sub, "smileys");
+  const struct Regex *c_smileys = cc_regex(&HandleSmileys);
   regmatch_t pmatch_internal[1] = { 0 };
 
   if (!pmatch)
     pmatch = pmatch_internal;
 
-  const struct Regex *c_quote_regex = cs_subset_regex(NeoMutt->sub, "quote_regex");
+  const struct Regex *c_quote_regex = cc_regex(&HandleQuoteRegex);
   if (mutt_regex_capture(c_quote_regex, line, 1, pmatch))
   {
     regmatch_t smatch[1] = { 0 };
@@ -374,12 +392,9 @@ static void resolve_types(struct MuttWindow *win, char *buf, char *raw,
                           bool *force_redraw, bool q_classify)
 {
   struct RegexColor *color_line = NULL;
-  struct RegexColorList *head = NULL;
   regmatch_t pmatch[1] = { 0 };
-  bool found;
-  bool null_rx;
-  const bool c_header_color_partial = cs_subset_bool(NeoMutt->sub, "header_color_partial");
-  int offset, i = 0;
+  const bool c_header_color_partial = cc_bool(&HandleHeaderColorPartial);
+  int i = 0;
 
   if ((line_num == 0) || simple_color_is_header(lines[line_num - 1].cid) ||
       (check_protected_header_marker(raw) == 0))
@@ -489,6 +504,29 @@ static void resolve_types(struct MuttWindow *win, char *buf, char *raw,
   {
     lines[line_num].cid = MT_COLOR_NORMAL;
   }
+}
+
+/**
+ * resolve_syntax - Colour the text of a line using the body and attachment patterns
+ * @param buf      Formatted text
+ * @param lines    Line info array
+ * @param line_num Line number (index into lines)
+ *
+ * The line must already have been classified by resolve_types().  This is only
+ * done when the line is shown, so laying out a huge message, e.g. for
+ * `<bottom>`, doesn't match every colour rule against every line.
+ */
+static void resolve_syntax(char *buf, struct Line *lines, int line_num)
+{
+  struct RegexColor *color_line = NULL;
+  struct RegexColorList *head = NULL;
+  regmatch_t pmatch[1] = { 0 };
+  bool found;
+  bool null_rx;
+  const bool c_header_color_partial = cc_bool(&HandleHeaderColorPartial);
+  int offset, i = 0;
+
+  lines[line_num].has_syntax = true;
 
   /* body patterns */
   if ((lines[line_num].cid == MT_COLOR_NORMAL) || (lines[line_num].cid == MT_COLOR_QUOTED) ||
@@ -516,6 +554,7 @@ static void resolve_types(struct MuttWindow *win, char *buf, char *raw,
     STAILQ_FOREACH(color_line, head, entries)
     {
       color_line->stop_matching = false;
+      color_line->next_match.rm_so = -1;
     }
 
     do
@@ -527,18 +566,8 @@ static void resolve_types(struct MuttWindow *win, char *buf, char *raw,
       null_rx = false;
       STAILQ_FOREACH(color_line, head, entries)
       {
-        if (color_line->stop_matching)
-          continue;
-
-        if ((regexec(&color_line->regex, buf + offset, 1, pmatch,
-                     ((offset != 0) ? REG_NOTBOL : 0)) != 0))
-        {
-          /* Once a regex fails to match, don't try matching it again.
-           * On very long lines this can cause a performance issue if there
-           * are other regexes that have many matches. */
-          color_line->stop_matching = true;
+        if (!regex_color_match(color_line, buf, offset, pmatch))
           continue;
-        }
 
         if (pmatch[0].rm_eo == pmatch[0].rm_so)
         {
@@ -565,8 +594,6 @@ static void resolve_types(struct MuttWindow *win, char *buf, char *raw,
           }
         }
         i = lines[line_num].syntax_arr_size - 1;
-        pmatch[0].rm_so += offset;
-        pmatch[0].rm_eo += offset;
 
         if (!found || (pmatch[0].rm_so < (lines[line_num].syntax)[i].first) ||
             ((pmatch[0].rm_so == (lines[line_num].syntax)[i].first) &&
@@ -751,43 +778,68 @@ void buf_strip_formatting(struct Buffer *dest, const char *src, bool strip_marke
  * @param[in,out] bytes_read End of last read
  * @param[in]     offset     Position start reading from
  * @param[out]    buf        Buffer to fill
- * @param[out]    fmt        Copy of buffer, stripped of attributes
+ * @param[out]    fmt        Copy of buffer, stripped of attributes (optional)
  * @param[out]    blen       Length of the buffer
  * @param[in,out] buf_ready  true if the buffer already has data in it
+ * @param[in,out] cache      Last line read from the file
  * @retval >=0 Bytes read
  * @retval -1  Error
+ *
+ * A long line will be wrapped into many rows.  Each row needs the rest of the
+ * line, so it's served from the cache, rather than being read again.
+ *
+ * The stripped copy is only created if fmt is passed.
  */
 static int fill_buffer(FILE *fp, LOFF_T *bytes_read, LOFF_T offset, unsigned char **buf,
-                       unsigned char **fmt, size_t *blen, int *buf_ready)
+                       unsigned char **fmt, size_t *blen, int *buf_ready,
+                       struct PagerLineCache *cache)
 {
   static int b_read = 0;
 
   if (*buf_ready == 0)
   {
-    if (offset != *bytes_read)
+    const LOFF_T cache_end = cache->offset + buf_len(&cache->line);
+    if ((offset >= cache->offset) && (offset < cache_end))
     {
-      if (!mutt_file_seek(fp, offset, SEEK_SET))
+      b_read = (int) (cache_end - offset);
+      if (*blen < (b_read + 1))
       {
-        return -1;
+        *blen = b_read + 1;
+        mutt_mem_realloc(buf, *blen);
       }
+      memcpy(*buf, cache->line.data + (offset - cache->offset), b_read + 1);
     }
-
-    *buf = (unsigned char *) mutt_file_read_line((char *) *buf, blen, fp, NULL, MUTT_RL_EOL);
-    if (!*buf)
+    else
     {
-      fmt[0] = NULL;
-      return -1;
-    }
+      if (offset != *bytes_read)
+      {
+        if (!mutt_file_seek(fp, offset, SEEK_SET))
+        {
+          return -1;
+        }
+      }
 
-    *bytes_read = ftello(fp);
-    b_read = (int) (*bytes_read - offset);
+      *buf = (unsigned char *) mutt_file_read_line((char *) *buf, blen, fp, NULL, MUTT_RL_EOL);
+      if (!*buf)
+      {
+        return -1;
+      }
+
+      *bytes_read = ftello(fp);
+      b_read = (int) (*bytes_read - offset);
+
+      buf_reset(&cache->line);
+      buf_addstr_n(&cache->line, (const char *) *buf, b_read);
+      cache->offset = offset;
+    }
     *buf_ready = 1;
+  }
 
+  if (fmt && !*fmt)
+  {
     struct Buffer *stripped = buf_pool_get();
     buf_alloc(stripped, *blen);
     buf_strip_formatting(stripped, (const char *) *buf, 1);
-    /* This should be a noop, because *fmt should be NULL */
-    FREE(fmt);
     *fmt = (unsigned char *) buf_strdup(stripped);
     buf_pool_release(&stripped);
   }
@@ -795,6 +847,39 @@ static int fill_buffer(FILE *fp, LOFF_T *bytes_read, LOFF_T offset, unsigned cha
   return b_read;
 }
 
+/**
+ * fill_syntax - Colour a line of text, the first time it's shown
+ * @param fp         File to read from
+ * @param bytes_read Offset into file
+ * @param lines      Line info array
+ * @param line_num   Line number (index into lines), not a continuation
+ * @param cache      Last line read from the file
+ * @retval  0 Success
+ * @retval -1 Error
+ *
+ * The rows of a wrapped line are coloured using the syntax of its first row.
+ * That row may not be on screen, so it's read separately.
+ */
+static int fill_syntax(FILE *fp, LOFF_T *bytes_read, struct Line *lines,
+                       int line_num, struct PagerLineCache *cache)
+{
+  unsigned char *buf = NULL, *fmt = NULL;
+  size_t buflen = 0;
+  int buf_ready = 0;
+  int rc = -1;
+
+  if (fill_buffer(fp, bytes_read, lines[line_num].offset, &buf, &fmt, &buflen,
+                  &buf_ready, cache) >= 0)
+  {
+    resolve_syntax((char *) fmt, lines, line_num);
+    rc = 0;
+  }
+
+  FREE(&buf);
+  FREE(&fmt);
+  return rc;
+}
+
 /**
  * format_line - Display a line of text in the pager
  * @param[in]  win       Window
@@ -818,13 +903,13 @@ static int format_line(struct MuttWindow *win, struct Line **lines, int line_num
                        int *pspecial, int width, struct AttrColorList *ansi_list)
 {
   int space = -1; /* index of the last space or TAB */
-  const bool c_markers = cs_subset_bool(NeoMutt->sub, "markers");
+  const bool c_markers = cc_bool(&HandleMarkers);
   size_t col = c_markers ? (*lines)[line_num].cont_line : 0;
   size_t k;
   int ch, vch, last_special = -1, special = 0, t;
   wchar_t wc = 0;
   mbstate_t mbstate = { 0 }; // FIXME: this should come from lines
-  const size_t c_wrap = cs_subset_number(NeoMutt->sub, "wrap");
+  const size_t c_wrap = cc_number(&HandleWrap);
   size_t wrap_cols = mutt_window_wrap_cols(width, (flags & MUTT_PAGER_NOWRAP) ? 0 : c_wrap);
 
   if (check_attachment_marker((char *) buf) == 0)
@@ -833,7 +918,7 @@ static int format_line(struct MuttWindow *win, struct Line **lines, int line_num
   struct PagerPrivateData *priv = win->parent->wdata;
   enum PagerMode mode = priv->pview->mode;
   const bool c_allow_ansi = (mode == PAGER_MODE_OTHER) ||
-                            cs_subset_bool(NeoMutt->sub, "allow_ansi");
+                            cc_bool(&HandleAllowAnsi);
 
   for (ch = 0, vch = 0; ch < cnt; ch += k, vch += k)
   {
@@ -857,7 +942,17 @@ static int format_line(struct MuttWindow *win, struct Line **lines, int line_num
     if (ch >= cnt)
       break;
 
-    k = mbrtowc(&wc, (char *) buf + ch, cnt - ch, &mbstate);
+    // Printable ASCII is the same in every charset
+    bool is_ascii = (buf[ch] >= ' ') && (buf[ch] < 0x7f) && mbsinit(&mbstate);
+    if (is_ascii)
+    {
+      wc = buf[ch];
+      k = 1;
+    }
+    else
+    {
+      k = mbrtowc(&wc, (char *) buf + ch, cnt - ch, &mbstate);
+    }
     if ((k == ICONV_BUF_TOO_SMALL) || (k == ICONV_ILLEGAL_SEQ))
     {
       if (k == ICONV_ILLEGAL_SEQ)
@@ -891,8 +986,9 @@ static int format_line(struct MuttWindow *win, struct Line **lines, int line_num
 
     /* Handle backspace */
     special = 0;
-    if (IsWPrint(wc))
+    if (((ch + k) < cnt) && (buf[ch + k] == '\b') && IsWPrint(wc))
     {
+      is_ascii = false;
       wchar_t wc1 = 0;
       mbstate_t mbstate1 = mbstate;
       size_t k1 = mbrtowc(&wc1, (char *) buf + ch + k, cnt - ch - k, &mbstate1);
@@ -937,13 +1033,13 @@ static int format_line(struct MuttWindow *win, struct Line **lines, int line_num
     }
 
     /* no-break space, narrow no-break space */
-    if (IsWPrint(wc) || (CharsetIsUtf8 && ((wc == 0x00A0) || (wc == 0x202F))))
+    if (is_ascii || IsWPrint(wc) || (CharsetIsUtf8 && ((wc == 0x00A0) || (wc == 0x202F))))
     {
       if (wc == ' ')
       {
         space = ch;
       }
-      t = wcwidth(wc);
+      t = is_ascii ? 1 : wcwidth(wc);
       if (col + t > wrap_cols)
         break;
       col += t;
@@ -1048,7 +1144,9 @@ int display_line(FILE *fp, LOFF_T *bytes_read, struct Line **lines,
 
   if (*lines_used == *lines_max)
   {
-    mutt_mem_realloc(lines, sizeof(struct Line) * (*lines_max += LINES));
+    // Grow geometrically, so laying out a huge message doesn't take quadratic time
+    *lines_max += MAX(*lines_max, LINES);
+    mutt_mem_realloc(lines, sizeof(struct Line) * *lines_max);
     for (ch = *lines_used; ch < *lines_max; ch++)
     {
       memset(&((*lines)[ch]), 0, sizeof(struct Line));
@@ -1065,7 +1163,8 @@ int display_line(FILE *fp, LOFF_T *bytes_read, struct Line **lines,
   if (flags & MUTT_PAGER_LOGS)
   {
     /* determine the line class */
-    if (fill_buffer(fp, bytes_read, cur_line->offset, &buf, &fmt, &buflen, &buf_ready) < 0)
+    if (fill_buffer(fp, bytes_read, cur_line->offset, &buf, NULL, &buflen,
+                    &buf_ready, &priv->line_cache) < 0)
     {
       if (change_last)
         (*lines_used)--;
@@ -1089,7 +1188,8 @@ int display_line(FILE *fp, LOFF_T *bytes_read, struct Line **lines,
     if (cur_line->cid == -1)
     {
       /* determine the line class */
-      if (fill_buffer(fp, bytes_read, cur_line->offset, &buf, &fmt, &buflen, &buf_ready) < 0)
+      if (fill_buffer(fp, bytes_read, cur_line->offset, &buf, &fmt, &buflen,
+                      &buf_ready, &priv->line_cache) < 0)
       {
         if (change_last)
           (*lines_used)--;
@@ -1115,7 +1215,7 @@ int display_line(FILE *fp, LOFF_T *bytes_read, struct Line **lines,
     }
 
     /* this also prevents searching through the hidden lines */
-    const short c_toggle_quoted_show_levels = cs_subset_number(NeoMutt->sub, "toggle_quoted_show_levels");
+    const short c_toggle_quoted_show_levels = cc_number(&HandleToggleQuotedShowLevels);
     if ((flags & MUTT_HIDE) && (cur_line->cid == MT_COLOR_QUOTED) &&
         (!cur_line->quote || (cur_line->quote->quote_n >= c_toggle_quoted_show_levels)))
     {
@@ -1131,14 +1231,15 @@ int display_line(FILE *fp, LOFF_T *bytes_read, struct Line **lines,
   if ((flags & MUTT_SHOWCOLOR) && !cur_line->cont_line &&
       (cur_line->cid == MT_COLOR_QUOTED) && !cur_line->quote)
   {
-    if (fill_buffer(fp, bytes_read, cur_line->offset, &buf, &fmt, &buflen, &buf_ready) < 0)
+    if (fill_buffer(fp, bytes_read, cur_line->offset, &buf, &fmt, &buflen,
+                    &buf_ready, &priv->line_cache) < 0)
     {
       if (change_last)
         (*lines_used)--;
       goto out;
     }
 
-    const struct Regex *c_quote_regex = cs_subset_regex(NeoMutt->sub, "quote_regex");
+    const struct Regex *c_quote_regex = cc_regex(&HandleQuoteRegex);
     if (mutt_regex_capture(c_quote_regex, (char *) fmt, 1, pmatch))
     {
       cur_line->quote = qstyle_classify(quote_list, (char *) fmt + pmatch[0].rm_so,
@@ -1153,7 +1254,8 @@ int display_line(FILE *fp, LOFF_T *bytes_read, struct Line **lines,
 
   if ((flags & MUTT_SEARCH) && !cur_line->cont_line && (cur_line->search_arr_size == -1))
   {
-    if (fill_buffer(fp, bytes_read, cur_line->offset, &buf, &fmt, &buflen, &buf_ready) < 0)
+    if (fill_buffer(fp, bytes_read, cur_line->offset, &buf, &fmt, &buflen,
+                    &buf_ready, &priv->line_cache) < 0)
     {
       if (change_last)
         (*lines_used)--;
@@ -1205,7 +1307,20 @@ int display_line(FILE *fp, LOFF_T *bytes_read, struct Line **lines,
     goto out; /* fake display */
   }
 
-  b_read = fill_buffer(fp, bytes_read, cur_line->offset, &buf, &fmt, &buflen, &buf_ready);
+  if ((flags & MUTT_SHOWCOLOR) && (mode == PAGER_MODE_EMAIL))
+  {
+    m = cur_line->cont_line ? (cur_line->syntax)[0].first : line_num;
+    if (!(*lines)[m].has_syntax &&
+        (fill_syntax(fp, bytes_read, *lines, m, &priv->line_cache) < 0))
+    {
+      if (change_last)
+        (*lines_used)--;
+      goto out;
+    }
+  }
+
+  b_read = fill_buffer(fp, bytes_read, cur_line->offset, &buf, NULL, &buflen,
+                       &buf_ready, &priv->line_cache);
   if (b_read < 0)
   {
     if (change_last)
@@ -1219,7 +1334,7 @@ int display_line(FILE *fp, LOFF_T *bytes_read, struct Line **lines,
   buf_ptr = buf + cnt;
 
   /* move the break point only if smart_wrap is set */
-  const bool c_smart_wrap = cs_subset_bool(NeoMutt->sub, "smart_wrap");
+  const bool c_smart_wrap = cc_bool(&HandleSmartWrap);
   if (c_smart_wrap)
   {
     if ((cnt < b_read) && (ch != -1) &&
@@ -44,6 +44,15 @@ struct TextSyntax
 };
 ARRAY_HEAD(TextSyntaxArray, struct TextSyntax);
 
+/**
+ * struct PagerLineCache - The last line read from the Pager's file
+ */
+struct PagerLineCache
+{
+  struct Buffer line; ///< Text of the line, including the newline
+  LOFF_T offset;      ///< Offset of the line in the file
+};
+
 /**
  * struct Line - A line of text in the pager
  */
@@ -53,6 +62,7 @@ struct Line
   short cid;                 ///< Default line colour, e.g. #MT_COLOR_QUOTED
   bool cont_line   : 1;      ///< Continuation of a previous line (wrapped by NeoMutt)
   bool cont_header : 1;      ///< Continuation of a header line (wrapped by MTA)
+  bool has_syntax  : 1;      ///< Syntax has been matched against the colour patterns
 
   short syntax_arr_size;     ///< Number of items in syntax array
   struct TextSyntax *syntax; ///< Array of coloured text in the line
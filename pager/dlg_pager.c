@@ -321,6 +321,8 @@ int dlg_pager(struct PagerView *pview)
   priv->lines_max = LINES; // number of lines on screen, from curses
   priv->lines = mutt_mem_calloc(priv->lines_max, sizeof(struct Line));
   priv->fp = mutt_file_fopen(pview->pdata->fname, "r");
+  buf_reset(&priv->line_cache.line);
+  priv->line_cache.offset = 0;
   priv->has_types = ((pview->mode == PAGER_MODE_EMAIL) || (pview->flags & MUTT_SHOWCOLOR)) ?
                         MUTT_TYPES :
                         0; // main message or rfc822 attachment
@@ -563,6 +565,7 @@ int dlg_pager(struct PagerView *pview)
   //-------------------------------------------------------------------------
 
   mutt_file_fclose(&priv->fp);
+  buf_dealloc(&priv->line_cache.line);
   if (pview->mode == PAGER_MODE_EMAIL)
   {
     if (shared->mailbox_view)
@@ -366,12 +366,45 @@ static int up_n_lines(int nlines, struct Line *info, int cur, bool hiding)
   return cur;
 }
 
+/**
+ * pager_layout_lines - Lay out the rest of the message, without displaying it
+ * @param priv     Private Pager data
+ * @param deadline Time to stop, see mutt_date_now_ms(), or 0 for no limit
+ * @retval true  The whole message has been laid out
+ * @retval false The deadline was reached first
+ *
+ * The lines are classified, e.g. quoted or signature, but not coloured.
+ */
+bool pager_layout_lines(struct PagerPrivateData *priv, uint64_t deadline)
+{
+  if (priv->laid_out)
+    return true;
+
+  int line_num = priv->cur_line;
+  while (display_line(priv->fp, &priv->bytes_read, &priv->lines, line_num,
+                      &priv->lines_used, &priv->lines_max,
+                      priv->has_types | (priv->pview->flags & MUTT_PAGER_NOWRAP),
+                      &priv->quote_list, &priv->q_level, &priv->force_redraw,
+                      &priv->search_re, priv->pview->win_pager, &priv->ansi_list) == 0)
+  {
+    line_num++;
+    if ((deadline != 0) && ((line_num % 256) == 0) && (mutt_date_now_ms() >= deadline))
+      return false;
+  }
+
+  priv->laid_out = true;
+  return true;
+}
+
 /**
  * jump_to_bottom - Make sure the bottom line is displayed
  * @param priv   Private Pager data
  * @param pview PagerView
  * @retval true Something changed
  * @retval false Bottom was already displayed
+ *
+ * Once the message has been laid out, e.g. in the background by
+ * pager_timeout_observer(), this doesn't need to read the file.
  */
 bool jump_to_bottom(struct PagerPrivateData *priv, struct PagerView *pview)
 {
@@ -380,16 +413,8 @@ bool jump_to_bottom(struct PagerPrivateData *priv, struct PagerView *pview)
     return false;
   }
 
-  int line_num = priv->cur_line;
   /* make sure the types are defined to the end of file */
-  while (display_line(priv->fp, &priv->bytes_read, &priv->lines, line_num,
-                      &priv->lines_used, &priv->lines_max,
-                      priv->has_types | (pview->flags & MUTT_PAGER_NOWRAP),
-                      &priv->quote_list, &priv->q_level, &priv->force_redraw,
-                      &priv->search_re, priv->pview->win_pager, &priv->ansi_list) == 0)
-  {
-    line_num++;
-  }
+  pager_layout_lines(priv, 0);
   priv->top_line = up_n_lines(priv->pview->win_pager->state.rows, priv->lines,
                               priv->lines_used, priv->hide_quoted);
   notify_send(priv->notify, NT_PAGER, NT_PAGER_VIEW, priv);
@@ -24,6 +24,7 @@
 #define MUTT_PAGER_FUNCTIONS_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 struct IndexSharedData;
 struct MuttWindow;
@@ -54,5 +55,6 @@ struct PagerFunction
 
 int pager_function_dispatcher(struct MuttWindow *win, int op);
 bool jump_to_bottom(struct PagerPrivateData *priv, struct PagerView *pview);
+bool pager_layout_lines(struct PagerPrivateData *priv, uint64_t deadline);
 
 #endif /* MUTT_PAGER_FUNCTIONS_H */
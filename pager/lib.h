@@ -204,6 +204,7 @@ int external_pager(struct MailboxView *mv, struct Email *e, const char *command)
 void pager_queue_redraw(struct PagerPrivateData *priv, PagerRedrawFlags redraw);
 bool mutt_is_quote_line(char *buf, regmatch_t *pmatch);
 const char *pager_get_pager(struct ConfigSubset *sub);
+size_t pager_mem_size(void);
 
 void mutt_clear_pager_position(void);
 
@@ -49,15 +49,16 @@
  *
  * Once constructed, it is controlled by the following events:
  *
- * | Event Type            | Handler                 |
- * | :-------------------- | :---------------------- |
- * | #NT_COLOR             | pager_color_observer()  |
- * | #NT_CONFIG            | pager_config_observer() |
- * | #NT_INDEX             | pager_index_observer()  |
- * | #NT_PAGER             | pager_pager_observer()  |
- * | #NT_WINDOW            | pager_window_observer() |
- * | MuttWindow::recalc()  | pager_recalc()          |
- * | MuttWindow::repaint() | pager_repaint()         |
+ * | Event Type            | Handler                  |
+ * | :-------------------- | :----------------------- |
+ * | #NT_COLOR             | pager_color_observer()   |
+ * | #NT_CONFIG            | pager_config_observer()  |
+ * | #NT_INDEX             | pager_index_observer()   |
+ * | #NT_PAGER             | pager_pager_observer()   |
+ * | #NT_TIMEOUT           | pager_timeout_observer() |
+ * | #NT_WINDOW            | pager_window_observer()  |
+ * | MuttWindow::recalc()  | pager_recalc()           |
+ * | MuttWindow::repaint() | pager_repaint()          |
  */
 
 #include "config.h"
@@ -72,8 +73,15 @@
 #include "color/lib.h"
 #include "index/lib.h"
 #include "display.h"
+#include "functions.h"
 #include "private_data.h"
 
+/// Time to spend laying out the message, each time the user is idle
+#define PAGER_LAYOUT_SLICE_MS 100
+
+/// Time spent repainting the Pager
+static struct StatsEntry StatsPagerRepaint = STATS_ENTRY("pager_repaint");
+
 /**
  * config_pager_index_lines - React to changes to $pager_index_lines
  * @param win Pager Window
@@ -134,6 +142,7 @@ static int pager_repaint(struct MuttWindow *win)
   if (!priv || !priv->pview || !priv->pview->pdata)
     return 0;
 
+  const uint64_t start = stats_timer_start();
   dump_pager(priv);
 
   // We need to populate more lines, but not change position
@@ -151,6 +160,7 @@ static int pager_repaint(struct MuttWindow *win)
         priv->lines[i].offset = 0;
         priv->lines[i].cid = -1;
         priv->lines[i].cont_line = false;
+        priv->lines[i].has_syntax = false;
         priv->lines[i].syntax_arr_size = 0;
         priv->lines[i].search_arr_size = -1;
         priv->lines[i].quote = NULL;
@@ -159,6 +169,7 @@ static int pager_repaint(struct MuttWindow *win)
         if (priv->search_compiled && priv->lines[i].search)
           FREE(&(priv->lines[i].search));
       }
+      priv->laid_out = false;
 
       if (!repopulate)
       {
@@ -231,6 +242,7 @@ static int pager_repaint(struct MuttWindow *win)
   }
 
   priv->redraw = PAGER_REDRAW_NO_FLAGS;
+  stats_timer_stop(&StatsPagerRepaint, start);
   mutt_debug(LL_DEBUG5, "repaint done\n");
   return 0;
 }
@@ -265,6 +277,7 @@ static int pager_color_observer(struct NotifyCallback *nc)
       FREE(&(priv->lines[i].syntax));
     }
     priv->lines_used = 0;
+    priv->laid_out = false;
   }
 
   mutt_debug(LL_DEBUG5, "color done\n");
@@ -374,6 +387,33 @@ static int pager_pager_observer(struct NotifyCallback *nc)
   return 0;
 }
 
+/**
+ * pager_timeout_observer - Notification that a timeout has occurred - Implements ::observer_t - @ingroup observer_api
+ *
+ * While the user is idle, lay out a little more of the message.
+ * Once it's all done, `<bottom>` doesn't need to read the file.
+ */
+static int pager_timeout_observer(struct NotifyCallback *nc)
+{
+  if (nc->event_type != NT_TIMEOUT)
+    return 0;
+  if (!nc->global_data)
+    return -1;
+
+  struct MuttWindow *win_pager = nc->global_data;
+  struct PagerPrivateData *priv = win_pager->wdata;
+  if (!priv || !priv->pview || !priv->fp || !priv->lines || priv->laid_out)
+    return 0;
+
+  // Wait until the message has been drawn at the current size
+  if ((priv->lines_used == 0) || (priv->redraw & PAGER_REDRAW_FLOW))
+    return 0;
+
+  pager_layout_lines(priv, mutt_date_now_ms() + PAGER_LAYOUT_SLICE_MS);
+  mutt_debug(LL_DEBUG5, "timeout done\n");
+  return 0;
+}
+
 /**
  * pager_window_observer - Notification that a Window has changed - Implements ::observer_t - @ingroup observer_api
  */
@@ -402,6 +442,7 @@ static int pager_window_observer(struct NotifyCallback *nc)
   notify_observer_remove(NeoMutt->notify, pager_global_observer, win_pager);
   notify_observer_remove(shared->notify, pager_index_observer, win_pager);
   notify_observer_remove(shared->notify, pager_pager_observer, win_pager);
+  notify_observer_remove(NeoMutt->notify_timeout, pager_timeout_observer, win_pager);
   notify_observer_remove(win_pager->notify, pager_window_observer, win_pager);
 
   mutt_debug(LL_DEBUG5, "window delete done\n");
@@ -409,6 +450,40 @@ static int pager_window_observer(struct NotifyCallback *nc)
   return 0;
 }
 
+/**
+ * pager_mem_size - Calculate the memory used by the Pagers' lines
+ * @retval num Size in bytes
+ *
+ * Every Dialog containing a Pager is checked.
+ */
+size_t pager_mem_size(void)
+{
+  if (!AllDialogsWindow)
+    return 0;
+
+  size_t size = 0;
+  struct MuttWindow *dlg = NULL;
+  TAILQ_FOREACH(dlg, &AllDialogsWindow->children, entries)
+  {
+    struct MuttWindow *panel = window_find_child(dlg, WT_PAGER);
+    struct PagerPrivateData *priv = panel ? panel->wdata : NULL;
+    if (!priv || !priv->lines)
+      continue;
+
+    size += priv->lines_max * sizeof(struct Line);
+    for (int i = 0; i < priv->lines_max; i++)
+    {
+      const struct Line *line = &priv->lines[i];
+      if (line->syntax)
+        size += MAX(line->syntax_arr_size, 1) * sizeof(struct TextSyntax);
+      if (line->search && (line->search_arr_size > 0))
+        size += line->search_arr_size * sizeof(struct TextSyntax);
+    }
+  }
+
+  return size;
+}
+
 /**
  * pager_window_new - Create a new Pager Window (list of Emails)
  * @param shared Shared Index Data
@@ -430,6 +505,7 @@ struct MuttWindow *pager_window_new(struct IndexSharedData *shared,
   notify_observer_add(NeoMutt->notify, NT_GLOBAL, pager_global_observer, win);
   notify_observer_add(shared->notify, NT_ALL, pager_index_observer, win);
   notify_observer_add(shared->notify, NT_PAGER, pager_pager_observer, win);
+  notify_observer_add(NeoMutt->notify_timeout, NT_TIMEOUT, pager_timeout_observer, win);
   notify_observer_add(win->notify, NT_WINDOW, pager_window_observer, win);
 
   return win;
@@ -48,6 +48,7 @@ void pager_private_data_free(struct MuttWindow *win, void **ptr)
   notify_free(&priv->notify);
 
   attr_color_list_clear(&priv->ansi_list);
+  buf_dealloc(&priv->line_cache.line);
 
   FREE(ptr);
 }
@@ -31,6 +31,7 @@
 #include "mutt/lib.h"
 #include "lib.h"
 #include "color/lib.h"
+#include "display.h"
 
 struct MuttWindow;
 
@@ -44,11 +45,13 @@ struct PagerPrivateData
   FILE *fp;                    ///< File containing decrypted/decoded/weeded Email
   struct stat st;              ///< Stats about Email file
   LOFF_T bytes_read;           ///< Number of bytes read from file
+  struct PagerLineCache line_cache; ///< Last line read from file
 
   struct Line *lines;          ///< Array of text lines in pager
   int lines_used;              ///< Size of lines array (used entries)
   int lines_max;               ///< Capacity of lines array (total entries)
   int cur_line;                ///< Current line (last line visible on screen)
+  bool laid_out;               ///< The whole message has been laid out, see pager_layout_lines()
 
   int old_top_line;            ///< Old top line, used for repainting
   int win_height;              ///< Number of lines in the Window
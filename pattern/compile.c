@@ -61,6 +61,49 @@ typedef uint16_t ParseDateRangeFlags; ///< Flags for parse_date_range(), e.g. #M
 
 #define MUTT_PDR_ERRORDONE (MUTT_PDR_ERROR | MUTT_PDR_DONE)
 
+/// Characters that have a special meaning in an extended regex
+static const char *const RegexMetaChars = ".[]()*+?{}|^$\\";
+
+/**
+ * regex_to_literal - Convert a regex to a plain string, if possible
+ * @param[in]  regex    Regular expression
+ * @param[out] literal  Buffer for the plain string
+ * @param[out] anchored Set to true if the regex starts with '^'
+ * @retval true  The regex can be matched as a plain string
+ * @retval false The regex needs the regex engine
+ *
+ * Most patterns, e.g. `~s neomutt` or `~f ^bob\.smith`, don't use any regex
+ * features.  Escaped metacharacters are unescaped.  Anything non-ASCII is left
+ * to the regex engine, so that case-folding behaves identically.
+ */
+static bool regex_to_literal(const char *regex, struct Buffer *literal, bool *anchored)
+{
+  *anchored = (*regex == '^');
+  if (*anchored)
+    regex++;
+
+  for (const char *p = regex; *p; p++)
+  {
+    if ((unsigned char) *p & 0x80)
+      return false;
+
+    if (*p == '\\')
+    {
+      p++;
+      if ((*p == '\0') || !strchr(RegexMetaChars, *p))
+        return false;
+    }
+    else if (strchr(RegexMetaChars, *p))
+    {
+      return false;
+    }
+
+    buf_addch(literal, *p);
+  }
+
+  return !buf_is_empty(literal);
+}
+
 /**
  * eat_regex - Parse a regex - Implements ::eat_arg_t - @ingroup eat_arg_api
  */
@@ -68,6 +111,8 @@ static bool eat_regex(struct Pattern *pat, PatternCompFlags flags,
                       struct Buffer *s, struct Buffer *err)
 {
   struct Buffer *buf = buf_pool_get();
+  struct Buffer *lit = buf_pool_get();
+  bool anchored = false;
   bool rc = false;
   char *pexpr = s->dptr;
   if ((parse_extract_token(buf, s, TOKEN_PATTERN | TOKEN_COMMENT) != 0) || !buf->data)
@@ -90,6 +135,16 @@ static bool eat_regex(struct Pattern *pat, PatternCompFlags flags,
   {
     pat->p.group = mutt_pattern_group(buf->data);
   }
+  else if (regex_to_literal(buf_string(buf), lit, &anchored))
+  {
+    pat->literal = true;
+    pat->anchored = anchored;
+    pat->p.str = buf_strdup(lit);
+    pat->ign_case = mutt_mb_is_lower(buf->data);
+#ifdef USE_DEBUG_GRAPHVIZ
+    pat->raw_pattern = mutt_str_dup(buf->data);
+#endif
+  }
   else
   {
     pat->p.regex = mutt_mem_calloc(1, sizeof(regex_t));
@@ -112,6 +167,7 @@ static bool eat_regex(struct Pattern *pat, PatternCompFlags flags,
 
 out:
   buf_pool_release(&buf);
+  buf_pool_release(&lit);
   return rc;
 }
 
@@ -770,6 +826,94 @@ static /* const */ char *find_matching_paren(/* const */ char *s)
   return s;
 }
 
+/**
+ * pattern_deps - What does a Pattern's result depend upon?
+ * @param pat Pattern
+ * @retval num Dependencies, e.g. #MUTT_PAT_DEP_FLAGS
+ */
+static PatternDeps pattern_deps(const struct Pattern *pat)
+{
+  // Aliases and groups can change without the Email changing
+  if (pat->is_alias || pat->group_match)
+    return MUTT_PAT_DEP_OTHER;
+
+  switch (pat->op)
+  {
+    case MUTT_ALL:
+    case MUTT_NONE:
+      return MUTT_PAT_DEP_NONE;
+
+    case MUTT_NEW:
+    case MUTT_OLD:
+    case MUTT_REPLIED:
+    case MUTT_READ:
+    case MUTT_UNREAD:
+    case MUTT_DELETE:
+    case MUTT_UNDELETE:
+    case MUTT_PURGE:
+    case MUTT_DELETED:
+    case MUTT_FLAG:
+    case MUTT_TAG:
+    case MUTT_UNTAG:
+    case MUTT_EXPIRED:
+    case MUTT_SUPERSEDED:
+    case MUTT_TRASH:
+      return MUTT_PAT_DEP_FLAGS;
+
+    case MUTT_PAT_ADDRESS:
+    case MUTT_PAT_BCC:
+    case MUTT_PAT_CC:
+    case MUTT_PAT_FROM:
+    case MUTT_PAT_HORMEL:
+    case MUTT_PAT_ID:
+    case MUTT_PAT_NEWSGROUPS:
+    case MUTT_PAT_RECIPIENT:
+    case MUTT_PAT_REFERENCE:
+    case MUTT_PAT_SENDER:
+    case MUTT_PAT_SUBJECT:
+    case MUTT_PAT_TO:
+    case MUTT_PAT_XLABEL:
+      return MUTT_PAT_DEP_HEADERS;
+
+    case MUTT_PAT_DATE:
+    case MUTT_PAT_DATE_RECEIVED:
+      // Relative dates depend on the current time
+      return pat->dynamic ? MUTT_PAT_DEP_OTHER : MUTT_PAT_DEP_HEADERS;
+
+    case MUTT_PAT_AND:
+    case MUTT_PAT_OR:
+      return mutt_pattern_deps(pat->child);
+
+    default:
+      return MUTT_PAT_DEP_OTHER;
+  }
+}
+
+/**
+ * mutt_pattern_deps - What does a Pattern's result depend upon?
+ * @param pat Pattern
+ * @retval num Dependencies, e.g. #MUTT_PAT_DEP_FLAGS
+ *
+ * If an Email changes, a cached result only needs re-evaluating if the
+ * Pattern depends on what changed.  Patterns that look at other Emails, e.g.
+ * `~(...)`, at config, e.g. `~l`, at aliases or groups, e.g. `@~f` or `%f`,
+ * or at the backend's tags, `~Y`, depend on #MUTT_PAT_DEP_OTHER.
+ */
+PatternDeps mutt_pattern_deps(const struct PatternList *pat)
+{
+  PatternDeps deps = MUTT_PAT_DEP_NONE;
+  if (!pat)
+    return deps;
+
+  const struct Pattern *np = NULL;
+  SLIST_FOREACH(np, pat, entries)
+  {
+    deps |= pattern_deps(np);
+  }
+
+  return deps;
+}
+
 /**
  * mutt_pattern_free - Free a Pattern
  * @param[out] pat Pattern to free
@@ -789,7 +933,7 @@ void mutt_pattern_free(struct PatternList **pat)
     {
       mutt_list_free(&np->p.multi_cases);
     }
-    else if (np->string_match || np->dynamic)
+    else if (np->string_match || np->dynamic || np->literal)
     {
       FREE(&np->p.str);
     }
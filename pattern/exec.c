@@ -32,6 +32,7 @@
 
 #include "config.h"
 #include <assert.h>
+#include <ctype.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
@@ -59,10 +60,61 @@
 #include <sys/stat.h>
 #endif
 
+/// Handle for $thorough_search
+static struct ConfigHandle HandleThoroughSearch = CONFIG_HANDLE("thorough_search");
+
+/// Time spent matching Patterns against Emails
+static struct StatsEntry StatsPatternExec = STATS_ENTRY("mutt_pattern_exec");
+/// Nesting of mutt_pattern_exec(), thread patterns call it recursively
+static int PatternExecDepth = 0;
+
 static bool pattern_exec(struct Pattern *pat, PatternExecFlags flags,
                          struct Mailbox *m, struct Email *e,
                          struct Message *msg, struct PatternCache *cache);
 
+/**
+ * literal_match - Compare a string to a literal Pattern
+ * @param pat Pattern to use
+ * @param buf String to compare
+ * @retval true  Match
+ * @retval false No match
+ *
+ * Emulate the regex, which was compiled with REG_NEWLINE, so '^' matches at
+ * the start of the string, or after any newline.
+ */
+static bool literal_match(const struct Pattern *pat, const char *buf)
+{
+  const char *needle = pat->p.str;
+
+  if (pat->anchored)
+  {
+    for (const char *line = buf; line; line = strchr(line, '\n'))
+    {
+      if (*line == '\n')
+        line++;
+      if (pat->ign_case ? mutt_istr_startswith(line, needle) :
+                          mutt_str_startswith(line, needle))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  if (!pat->ign_case)
+    return strstr(buf, needle);
+
+  // Skip to the candidates, rather than comparing at every position
+  const size_t len = mutt_str_len(needle);
+  const char first[3] = { needle[0], toupper((unsigned char) needle[0]), '\0' };
+  for (const char *p = strpbrk(buf, first); p; p = strpbrk(p + 1, first))
+  {
+    if (mutt_istrn_equal(p, needle, len))
+      return true;
+  }
+  return false;
+}
+
 /**
  * patmatch - Compare a string to a Pattern
  * @param pat Pattern to use
@@ -78,6 +130,8 @@ static bool patmatch(const struct Pattern *pat, const char *buf)
     return pat->ign_case ? mutt_istr_find(buf, pat->p.str) : strstr(buf, pat->p.str);
   if (pat->group_match)
     return mutt_group_match(pat->p.group, buf);
+  if (pat->literal)
+    return literal_match(pat, buf);
   return (regexec(pat->p.regex, buf, 0, NULL, 0) == 0);
 }
 
@@ -128,7 +182,7 @@ static bool msg_search(struct Pattern *pat, struct Email *e, struct Message *msg
 
   const bool needs_head = (pat->op == MUTT_PAT_HEADER) || (pat->op == MUTT_PAT_WHOLE_MSG);
   const bool needs_body = (pat->op == MUTT_PAT_BODY) || (pat->op == MUTT_PAT_WHOLE_MSG);
-  const bool c_thorough_search = cs_subset_bool(NeoMutt->sub, "thorough_search");
+  const bool c_thorough_search = cc_bool(&HandleThoroughSearch);
   if (c_thorough_search)
   {
     /* decode the header / body */
@@ -1133,14 +1187,19 @@ static bool pattern_exec(struct Pattern *pat, PatternExecFlags flags,
 bool mutt_pattern_exec(struct Pattern *pat, PatternExecFlags flags,
                        struct Mailbox *m, struct Email *e, struct PatternCache *cache)
 {
+  const uint64_t start = (PatternExecDepth++ == 0) ? stats_timer_start() : 0;
+
+  bool matched = false;
   const bool needs_msg = pattern_needs_msg(m, pat);
   struct Message *msg = needs_msg ? mx_msg_open(m, e) : NULL;
-  if (needs_msg && !msg)
+  if (!needs_msg || msg)
   {
-    return false;
+    matched = pattern_exec(pat, flags, m, e, msg, cache);
+    mx_msg_close(m, &msg);
   }
-  const bool matched = pattern_exec(pat, flags, m, e, msg, cache);
-  mx_msg_close(m, &msg);
+
+  if (--PatternExecDepth == 0)
+    stats_timer_stop(&StatsPatternExec, start);
   return matched;
 }
 
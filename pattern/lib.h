@@ -35,6 +35,7 @@
  * | pattern/exec.c         | @subpage pattern_exec         |
  * | pattern/flags.c        | @subpage pattern_flags        |
  * | pattern/functions.c    | @subpage pattern_functions    |
+ * | pattern/memo.c         | @subpage pattern_memo         |
  * | pattern/message.c      | @subpage pattern_message      |
  * | pattern/pattern.c      | @subpage pattern_pattern      |
  * | pattern/search_state.c | @subpage pattern_search_state |
@@ -59,6 +60,7 @@ struct Envelope;
 struct Mailbox;
 struct MailboxView;
 struct Menu;
+struct PatternMemo;
 
 #define MUTT_ALIAS_SIMPLESEARCH "~f %s | ~t %s | ~c %s"
 
@@ -70,6 +72,12 @@ typedef uint8_t PatternCompFlags;           ///< Flags for mutt_pattern_comp(),
 #define MUTT_PC_PATTERN_DYNAMIC   (1 << 1)  ///< Enable runtime date range evaluation
 #define MUTT_PC_SEND_MODE_SEARCH  (1 << 2)  ///< Allow send-mode body searching
 
+typedef uint8_t PatternDeps;                ///< What a Pattern's result depends upon, e.g. #MUTT_PAT_DEP_FLAGS
+#define MUTT_PAT_DEP_NONE               0   ///< Result never changes, e.g. `~A`
+#define MUTT_PAT_DEP_FLAGS        (1 << 0)  ///< Email's flags, e.g. `~N`, `~F`
+#define MUTT_PAT_DEP_HEADERS      (1 << 1)  ///< Email's Envelope, e.g. `~f`, `~s`
+#define MUTT_PAT_DEP_OTHER        (1 << 2)  ///< Anything else, e.g. threads, the body, config
+
 /**
  * struct Pattern - A simple (non-regex) pattern
  */
@@ -85,13 +93,15 @@ struct Pattern
   bool dynamic      : 1;         ///< Evaluate date ranges at run time
   bool sendmode     : 1;         ///< Evaluate searches in send-mode
   bool is_multi     : 1;         ///< Multiple case (only for ~I pattern now)
+  bool literal      : 1;         ///< Regex is a plain string, matched without regexec()
+  bool anchored     : 1;         ///< Literal must match at the start of a line
   long min;                      ///< Minimum for range checks
   long max;                      ///< Maximum for range checks
   struct PatternList *child;     ///< Arguments to logical operation
   union {
     regex_t *regex;              ///< Compiled regex, for non-pattern matching
     struct Group *group;         ///< Address group if group_match is set
-    char *str;                   ///< String, if string_match is set
+    char *str;                   ///< String, if string_match or literal is set
     struct ListHead multi_cases; ///< Multiple strings for ~I pattern
   } p;
 #ifdef USE_DEBUG_GRAPHVIZ
@@ -185,9 +195,14 @@ bool mutt_pattern_exec(struct Pattern *pat, PatternExecFlags flags, struct Mailb
 bool mutt_pattern_alias_exec(struct Pattern *pat, PatternExecFlags flags,
                              struct AliasView *av, struct PatternCache *cache);
 
+PatternDeps mutt_pattern_deps(const struct PatternList *pat);
 struct PatternList *mutt_pattern_comp(struct MailboxView *mv, struct Menu *menu, const char *s, PatternCompFlags flags, struct Buffer *err);
 void mutt_check_simple(struct Buffer *s, const char *simple);
 void mutt_pattern_free(struct PatternList **pat);
+
+struct PatternMemo *mutt_pattern_memo_new  (void);
+void                mutt_pattern_memo_free (struct PatternMemo **ptr);
+void                mutt_pattern_memo_reset(struct PatternMemo *memo);
 bool dlg_pattern(char *buf, size_t buflen);
 
 int mutt_which_case(const char *s);
@@ -0,0 +1,329 @@
+/**
+ * @file
+ * Remember the results of recent limit patterns
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @page pattern_memo Remember the results of recent limit patterns
+ *
+ * Switching between a few limits means evaluating the same patterns against
+ * the same Emails over and over.  The PatternMemo remembers, for the last few
+ * patterns, which Emails matched.
+ *
+ * Each result is stored alongside the Email's generation number.  Whenever an
+ * Email's flags or Envelope change, its generation is bumped, so only that
+ * Email will be re-evaluated.  New Emails have never been seen, so they're
+ * evaluated too.  Any config change discards all the results.
+ *
+ * Emails are identified by their sequence number, which is unique.
+ */
+
+#include "config.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "private.h"
+#include "mutt/lib.h"
+#include "config/lib.h"
+#include "email/lib.h"
+#include "core/lib.h"
+#include "lib.h"
+
+/// Number of patterns to remember
+#define MEMO_MAX_ENTRIES 4
+
+/**
+ * struct MemoEntry - The results of one Pattern
+ */
+struct MemoEntry
+{
+  char *pattern;           ///< Expanded Pattern string
+  size_t base;             ///< Sequence number of the first slot
+  size_t size;             ///< Number of slots
+  unsigned int *gens;      ///< Email generation + 1, or 0 if unknown
+  uint64_t *matches;       ///< Bitset of results
+  unsigned long last_used; ///< For choosing an entry to discard
+};
+
+/**
+ * struct PatternMemo - Remember the results of recent limit patterns
+ */
+struct PatternMemo
+{
+  struct MemoEntry entries[MEMO_MAX_ENTRIES]; ///< Results of recent Patterns
+  unsigned long clock;                        ///< Usage counter
+};
+
+/**
+ * memo_entry_clear - Forget the results of a Pattern
+ * @param me Entry to clear
+ */
+static void memo_entry_clear(struct MemoEntry *me)
+{
+  FREE(&me->pattern);
+  FREE(&me->gens);
+  FREE(&me->matches);
+  memset(me, 0, sizeof(*me));
+}
+
+/**
+ * memo_config_observer - Notification that a Config Variable has changed - Implements ::observer_t - @ingroup observer_api
+ *
+ * Many config variables affect matching, e.g. $thorough_search, so forget
+ * everything.
+ */
+static int memo_config_observer(struct NotifyCallback *nc)
+{
+  if (nc->event_type != NT_CONFIG)
+    return 0;
+  if (!nc->global_data)
+    return -1;
+
+  mutt_pattern_memo_reset(nc->global_data);
+  mutt_debug(LL_DEBUG5, "config done\n");
+  return 0;
+}
+
+/**
+ * mutt_pattern_memo_new - Create a new PatternMemo
+ * @retval ptr New PatternMemo
+ */
+struct PatternMemo *mutt_pattern_memo_new(void)
+{
+  struct PatternMemo *memo = mutt_mem_calloc(1, sizeof(struct PatternMemo));
+
+  if (NeoMutt)
+    notify_observer_add(NeoMutt->notify, NT_CONFIG, memo_config_observer, memo);
+
+  return memo;
+}
+
+/**
+ * mutt_pattern_memo_reset - Forget all the cached results
+ * @param memo PatternMemo
+ */
+void mutt_pattern_memo_reset(struct PatternMemo *memo)
+{
+  if (!memo)
+    return;
+
+  for (int i = 0; i < MEMO_MAX_ENTRIES; i++)
+    memo_entry_clear(&memo->entries[i]);
+}
+
+/**
+ * mutt_pattern_memo_free - Free a PatternMemo
+ * @param ptr PatternMemo to free
+ */
+void mutt_pattern_memo_free(struct PatternMemo **ptr)
+{
+  if (!ptr || !*ptr)
+    return;
+
+  struct PatternMemo *memo = *ptr;
+
+  if (NeoMutt)
+    notify_observer_remove(NeoMutt->notify, memo_config_observer, memo);
+
+  mutt_pattern_memo_reset(memo);
+  FREE(ptr);
+}
+
+/**
+ * pattern_is_memoisable - Can the results of a Pattern be cached?
+ * @param pat Pattern to check
+ * @retval true Results only depend on the Email's own flags and contents
+ *
+ * Patterns that look at other Emails (threads, duplicates), the view (message
+ * numbers, collapsed threads), aliases and groups, or data from outside
+ * NeoMutt can't be cached.
+ *
+ * Date patterns are never cached.  Relative dates, e.g. `~d <1d`, are turned
+ * into a fixed range when the pattern is compiled, so the range moves each
+ * time the same pattern string is compiled again.
+ */
+static bool pattern_is_memoisable(const struct PatternList *pat)
+{
+  const struct Pattern *np = NULL;
+  SLIST_FOREACH(np, pat, entries)
+  {
+    // Aliases and groups can change without notice
+    if (np->dynamic || np->is_alias || np->group_match)
+      return false;
+
+    switch (np->op)
+    {
+      case MUTT_PAT_THREAD:
+      case MUTT_PAT_PARENT:
+      case MUTT_PAT_CHILDREN:
+      case MUTT_PAT_COLLAPSED:
+      case MUTT_PAT_DUPLICATED:
+      case MUTT_PAT_UNREFERENCED:
+      case MUTT_PAT_BROKEN:
+      case MUTT_PAT_MESSAGE:
+      case MUTT_PAT_SCORE:
+      case MUTT_PAT_ID_EXTERNAL:
+      case MUTT_PAT_SERVERSEARCH:
+      case MUTT_PAT_DRIVER_TAGS:
+      case MUTT_PAT_RECIPIENT:
+      case MUTT_PAT_LIST:
+      case MUTT_PAT_SUBSCRIBED_LIST:
+      case MUTT_PAT_PERSONAL_RECIP:
+      case MUTT_PAT_PERSONAL_FROM:
+      case MUTT_PAT_CRYPT_VERIFIED:
+      case MUTT_PAT_DATE:
+      case MUTT_PAT_DATE_RECEIVED:
+      case MUTT_PAT_MIMEATTACH:
+      case MUTT_SUPERSEDED:
+      case MUTT_EXPIRED:
+        return false;
+
+      case MUTT_PAT_BODY:
+      case MUTT_PAT_HEADER:
+      case MUTT_PAT_WHOLE_MSG:
+        // IMAP may have searched these server-side
+        if (np->string_match)
+          return false;
+        break;
+
+      default:
+        break;
+    }
+
+    if (np->child && !pattern_is_memoisable(np->child))
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * memo_get - Find the cached results of a Pattern
+ * @param memo PatternMemo
+ * @param m    Mailbox
+ * @param str  Expanded pattern string
+ * @param pat  Compiled Pattern
+ * @retval ptr  Entry for the Pattern
+ * @retval NULL The Pattern can't be cached
+ *
+ * If the Pattern hasn't been seen recently, the least recently used entry will
+ * be recycled.
+ */
+struct MemoEntry *memo_get(struct PatternMemo *memo, struct Mailbox *m,
+                           const char *str, const struct PatternList *pat)
+{
+  if (!memo || !m || !str || !pat || !pattern_is_memoisable(pat))
+    return NULL;
+
+  struct MemoEntry *me = NULL;
+  struct MemoEntry *oldest = &memo->entries[0];
+  for (int i = 0; i < MEMO_MAX_ENTRIES; i++)
+  {
+    if (mutt_str_equal(memo->entries[i].pattern, str))
+    {
+      me = &memo->entries[i];
+      break;
+    }
+    if (memo->entries[i].last_used < oldest->last_used)
+      oldest = &memo->entries[i];
+  }
+
+  if (!me)
+  {
+    me = oldest;
+    memo_entry_clear(me);
+    me->pattern = mutt_str_dup(str);
+    me->base = SIZE_MAX;
+    for (int i = 0; i < m->msg_count; i++)
+    {
+      const struct Email *e = m->emails[i];
+      if (e && (e->sequence < me->base))
+        me->base = e->sequence;
+    }
+  }
+
+  me->last_used = ++memo->clock;
+  return me;
+}
+
+/**
+ * memo_entry_grow - Make room for an Email
+ * @param me  Entry
+ * @param m   Mailbox
+ * @param idx Slot that's needed
+ * @retval true Slot is available
+ */
+static bool memo_entry_grow(struct MemoEntry *me, struct Mailbox *m, size_t idx)
+{
+  if (idx < me->size)
+    return true;
+
+  // Emails have been recreated, e.g. the Mailbox was reopened
+  if (idx > ((size_t) m->msg_count * 2) + 1024)
+    return false;
+
+  size_t size = MAX(idx + 1, me->size * 2);
+  size = ROUND_UP(size, 64);
+
+  mutt_mem_realloc(&me->gens, size * sizeof(*me->gens));
+  memset(me->gens + me->size, 0, (size - me->size) * sizeof(*me->gens));
+
+  mutt_mem_realloc(&me->matches, (size / 64) * sizeof(*me->matches));
+  memset(me->matches + (me->size / 64), 0, ((size - me->size) / 64) * sizeof(*me->matches));
+
+  me->size = size;
+  return true;
+}
+
+/**
+ * memo_exec - Match a Pattern against an Email, using cached results
+ * @param me    Entry from memo_get(), may be NULL
+ * @param pat   Compiled Pattern
+ * @param flags Flags, e.g. #MUTT_MATCH_FULL_ADDRESS
+ * @param m     Mailbox
+ * @param e     Email
+ * @retval true The Email matches the Pattern
+ */
+bool memo_exec(struct MemoEntry *me, struct PatternList *pat,
+               PatternExecFlags flags, struct Mailbox *m, struct Email *e)
+{
+  if (me && (me->base == SIZE_MAX))
+    me->base = e->sequence;
+
+  if (!me || (e->sequence < me->base) || !memo_entry_grow(me, m, e->sequence - me->base))
+    return mutt_pattern_exec(SLIST_FIRST(pat), flags, m, e, NULL);
+
+  const size_t idx = e->sequence - me->base;
+  const uint64_t bit = (uint64_t) 1 << (idx % 64);
+
+  const unsigned int gen = e->generation + 1;
+
+  if ((gen != 0) && (me->gens[idx] == gen))
+    return (me->matches[idx / 64] & bit);
+
+  const bool match = mutt_pattern_exec(SLIST_FIRST(pat), flags, m, e, NULL);
+  me->gens[idx] = gen;
+  if (match)
+    me->matches[idx / 64] |= bit;
+  else
+    me->matches[idx / 64] &= ~bit;
+
+  return match;
+}
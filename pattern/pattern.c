@@ -330,6 +330,10 @@ int mutt_pattern_func(struct MailboxView *mv, int op, char *prompt)
   if ((m->type == MUTT_IMAP) && (!imap_search(m, pat)))
     goto bail;
 
+  if (!mv->memo)
+    mv->memo = mutt_pattern_memo_new();
+  struct MemoEntry *me = memo_get(mv->memo, m, buf_string(buf), pat);
+
   progress = progress_new(MUTT_PROGRESS_READ, (op == MUTT_LIMIT) ? m->msg_count : m->vcount);
   progress_set_message(progress, _("Executing command on matching messages..."));
 
@@ -348,16 +352,15 @@ int mutt_pattern_func(struct MailboxView *mv, int op, char *prompt)
 
       progress_update(progress, i, -1);
       /* new limit pattern implicitly uncollapses all threads */
-      e->vnum = -1;
+      mailbox_vnum_set(m, e, -1);
       e->visible = false;
       e->limit_visited = true;
       e->collapsed = false;
       e->num_hidden = 0;
 
-      if (match_all ||
-          mutt_pattern_exec(SLIST_FIRST(pat), MUTT_MATCH_FULL_ADDRESS, m, e, NULL))
+      if (match_all || memo_exec(me, pat, MUTT_MATCH_FULL_ADDRESS, m, e))
       {
-        e->vnum = m->vcount;
+        mailbox_vnum_set(m, e, m->vcount);
         e->visible = true;
         m->v2r[m->vcount] = i;
         m->vcount++;
@@ -368,13 +371,16 @@ int mutt_pattern_func(struct MailboxView *mv, int op, char *prompt)
   }
   else
   {
+    // Send one notification, not one per Email
+    notify_batch_begin(m->notify, NT_MAILBOX, NT_MAILBOX_CHANGE);
+
     for (int i = 0; i < m->vcount; i++)
     {
       struct Email *e = mutt_get_virt_email(m, i);
       if (!e)
         continue;
       progress_update(progress, i, -1);
-      if (mutt_pattern_exec(SLIST_FIRST(pat), MUTT_MATCH_FULL_ADDRESS, m, e, NULL))
+      if (memo_exec(me, pat, MUTT_MATCH_FULL_ADDRESS, m, e))
       {
         switch (op)
         {
@@ -392,6 +398,9 @@ int mutt_pattern_func(struct MailboxView *mv, int op, char *prompt)
         }
       }
     }
+
+    struct EventMailbox ev_m = { m };
+    notify_batch_end(m->notify, &ev_m);
   }
   progress_free(&progress);
 
@@ -29,6 +29,8 @@
 #include "lib.h"
 
 struct MailboxView;
+struct MemoEntry;
+struct PatternMemo;
 
 /**
  * struct PatternEntry - A line in the Pattern Completion menu
@@ -144,6 +146,9 @@ extern const struct PatternFlags Flags[];
 
 const struct PatternFlags *lookup_op(int op);
 const struct PatternFlags *lookup_tag(char tag);
+struct MemoEntry *memo_get(struct PatternMemo *memo, struct Mailbox *m, const char *str, const struct PatternList *pat);
+bool memo_exec(struct MemoEntry *me, struct PatternList *pat, PatternExecFlags flags, struct Mailbox *m, struct Email *e);
+
 bool eval_date_minmax(struct Pattern *pat, const char *s, struct Buffer *err);
 bool eat_message_range(struct Pattern *pat, PatternCompFlags flags, struct Buffer *s, struct Buffer *err, struct MailboxView *mv);
 
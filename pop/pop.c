@@ -381,6 +381,7 @@ static int pop_fetch_headers(struct Mailbox *m)
       if (edata->refno == -1)
       {
         m->emails[i]->deleted = true;
+        mailbox_email_changed(m, m->emails[i]);
         deleted++;
       }
     }
@@ -48,8 +48,11 @@
 #include "mx.h"
 #include "score.h"
 
+/// Time spent sorting the index
+static struct StatsEntry StatsSortHeaders = STATS_ENTRY("mutt_sort_headers");
+
 /**
- * struct EmailCompare - Context for compare_email_shim()
+ * struct EmailCompare - Context for compare_sort_key_shim()
  */
 struct EmailCompare
 {
@@ -58,17 +61,6 @@ struct EmailCompare
   short sort_aux;        ///< Secondary sort
 };
 
-/**
- * compare_email_shim - Helper to sort emails - Implements ::sort_t - @ingroup sort_api
- */
-static int compare_email_shim(const void *a, const void *b, void *sdata)
-{
-  const struct Email *ea = *(struct Email const *const *) a;
-  const struct Email *eb = *(struct Email const *const *) b;
-  const struct EmailCompare *cmp = sdata;
-  return mutt_compare_emails(ea, eb, cmp->type, cmp->sort, cmp->sort_aux);
-}
-
 /**
  * compare_score - Compare two emails using their scores - Implements ::sort_mail_t - @ingroup sort_mail_api
  */
@@ -114,6 +106,11 @@ static int compare_subject(const struct Email *a, const struct Email *b, bool re
   {
     rc = 1;
   }
+  else if (a->env->real_subj == b->env->real_subj)
+  {
+    /* Subjects are interned, so identical ones share a pointer */
+    rc = 0;
+  }
   else
   {
     rc = mutt_istr_cmp(a->env->real_subj, b->env->real_subj);
@@ -265,6 +262,10 @@ static int compare_label(const struct Email *a, const struct Email *b, bool reve
   if (!ahas && !bhas)
     return 0;
 
+  /* Labels are interned, so identical labels share a pointer */
+  if (a->env->x_label == b->env->x_label)
+    return 0;
+
   /* If both have a label, we just do a lexical compare. */
   result = mutt_istr_cmp(a->env->x_label, b->env->x_label);
   return reverse ? -result : result;
@@ -342,6 +343,179 @@ int mutt_compare_emails(const struct Email *a, const struct Email *b,
   return rc;
 }
 
+/**
+ * struct EmailSortKey - Sort keys for one Email, gathered before sorting
+ *
+ * Sorting calls the compare function O(n log n) times.  Gathering the keys
+ * once keeps them together in one compact array and avoids repeating
+ * expensive work, e.g. alias lookups and IDN conversion for `$sort=from`.
+ */
+struct EmailSortKey
+{
+  struct Email *email; ///< Email
+  long long num[2];    ///< Numeric keys for the primary and secondary sorts
+  const char *str[2];  ///< String keys for the primary and secondary sorts
+};
+
+/**
+ * sort_key_init - Gather the sort key for an Email
+ * @param key    Sort keys to fill
+ * @param i      Which key, 0 (primary) or 1 (secondary)
+ * @param method Sort type, see #SortType
+ * @param type   Mailbox type
+ *
+ * @note Keys for SORT_FROM and SORT_TO are allocated and must be freed
+ */
+static void sort_key_init(struct EmailSortKey *key, int i, enum SortType method,
+                          enum MailboxType type)
+{
+  const struct Email *e = key->email;
+
+  switch (method)
+  {
+    case SORT_DATE:
+      key->num[i] = e->date_sent;
+      break;
+    case SORT_RECEIVED:
+      key->num[i] = e->received;
+      break;
+    case SORT_SCORE:
+      key->num[i] = e->score;
+      break;
+    case SORT_SIZE:
+      key->num[i] = e->body->length;
+      break;
+    case SORT_ORDER:
+      key->num[i] = e->index;
+      break;
+    case SORT_SUBJECT:
+      key->num[i] = e->date_sent;
+      key->str[i] = e->env->real_subj;
+      break;
+    case SORT_FROM:
+      // Match the 128 char limit of compare_from()
+      key->str[i] = mutt_strn_dup(mutt_get_name(TAILQ_FIRST(&e->env->from)), 127);
+      break;
+    case SORT_TO:
+      key->str[i] = mutt_strn_dup(mutt_get_name(TAILQ_FIRST(&e->env->to)), 127);
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * sort_key_cmp - Compare two Emails using their gathered keys
+ * @param a      First Email's keys
+ * @param b      Second Email's keys
+ * @param i      Which key, 0 (primary) or 1 (secondary)
+ * @param sort   Sort method, including #SORT_REVERSE
+ * @param type   Mailbox type
+ * @retval <0 a precedes b
+ * @retval  0 a and b are identical
+ * @retval >0 b precedes a
+ *
+ * This mirrors the sort_mail_t functions.  Sorts without a gathered key fall
+ * back to them.
+ */
+static int sort_key_cmp(const struct EmailSortKey *a, const struct EmailSortKey *b,
+                        int i, short sort, enum MailboxType type)
+{
+  const enum SortType method = sort & SORT_MASK;
+  const bool reverse = (sort & SORT_REVERSE);
+  int rc = 0;
+
+  switch (method)
+  {
+    case SORT_DATE:
+    case SORT_RECEIVED:
+    case SORT_SIZE:
+      rc = mutt_numeric_cmp(a->num[i], b->num[i]);
+      break;
+    case SORT_ORDER:
+      if (type == MUTT_NNTP)
+        return nntp_compare_order(a->email, b->email, reverse);
+      rc = mutt_numeric_cmp(a->num[i], b->num[i]);
+      break;
+    case SORT_SCORE:
+      rc = mutt_numeric_cmp(b->num[i], a->num[i]); /* note that this is reverse */
+      break;
+    case SORT_SUBJECT:
+      if (!a->str[i])
+        rc = b->str[i] ? -1 : mutt_numeric_cmp(a->num[i], b->num[i]);
+      else if (!b->str[i])
+        rc = 1;
+      else
+        rc = mutt_istr_cmp(a->str[i], b->str[i]);
+      break;
+    case SORT_FROM:
+    case SORT_TO:
+      rc = mutt_istrn_cmp(a->str[i], b->str[i], 128);
+      break;
+    default:
+    {
+      sort_mail_t func = get_sort_func(method, type);
+      return func(a->email, b->email, reverse);
+    }
+  }
+
+  return reverse ? -rc : rc;
+}
+
+/**
+ * compare_sort_key_shim - Helper to sort emails by their keys - Implements ::sort_t - @ingroup sort_api
+ */
+static int compare_sort_key_shim(const void *a, const void *b, void *sdata)
+{
+  const struct EmailSortKey *ka = a;
+  const struct EmailSortKey *kb = b;
+  const struct EmailCompare *cmp = sdata;
+
+  int rc = sort_key_cmp(ka, kb, 0, cmp->sort, cmp->type);
+  if (rc == 0)
+    rc = sort_key_cmp(ka, kb, 1, cmp->sort_aux, cmp->type);
+  if (rc == 0)
+    rc = compare_order(ka->email, kb->email, false);
+  return rc;
+}
+
+/**
+ * sort_emails - Sort the Emails of a Mailbox
+ * @param m   Mailbox
+ * @param cmp Sort methods
+ *
+ * Equivalent to sorting m->emails with mutt_compare_emails(), but the keys
+ * are gathered first.
+ */
+static void sort_emails(struct Mailbox *m, const struct EmailCompare *cmp)
+{
+  const short sorts[2] = { cmp->sort, cmp->sort_aux };
+  struct EmailSortKey *keys = mutt_mem_calloc(m->msg_count, sizeof(struct EmailSortKey));
+
+  for (int i = 0; i < m->msg_count; i++)
+  {
+    keys[i].email = m->emails[i];
+    for (int j = 0; j < 2; j++)
+      sort_key_init(&keys[i], j, sorts[j] & SORT_MASK, cmp->type);
+  }
+
+  mutt_qsort_r(keys, m->msg_count, sizeof(struct EmailSortKey),
+               compare_sort_key_shim, (void *) cmp);
+
+  for (int i = 0; i < m->msg_count; i++)
+  {
+    m->emails[i] = keys[i].email;
+    for (int j = 0; j < 2; j++)
+    {
+      const enum SortType method = sorts[j] & SORT_MASK;
+      if ((method == SORT_FROM) || (method == SORT_TO))
+        FREE(&keys[i].str[j]);
+    }
+  }
+
+  FREE(&keys);
+}
+
 /**
  * mutt_sort_headers - Sort emails by their headers
  * @param mv    Mailbox View
@@ -372,6 +546,8 @@ void mutt_sort_headers(struct MailboxView *mv, bool init)
   if (m->verbose)
     mutt_message(_("Sorting mailbox..."));
 
+  const uint64_t start = stats_timer_start();
+
   const bool c_score = cs_subset_bool(NeoMutt->sub, "score");
   if (OptNeedRescore && c_score)
   {
@@ -405,25 +581,32 @@ void mutt_sort_headers(struct MailboxView *mv, bool init)
     cmp.type = mx_type(m);
     cmp.sort = cs_subset_sort(NeoMutt->sub, "sort");
     cmp.sort_aux = cs_subset_sort(NeoMutt->sub, "sort_aux");
-    mutt_qsort_r((void *) m->emails, m->msg_count, sizeof(struct Email *),
-                 compare_email_shim, &cmp);
+    sort_emails(m, &cmp);
   }
 
   /* adjust the virtual message numbers */
   m->vcount = 0;
+  mailbox_bits_resize(m);
   for (int i = 0; i < m->msg_count; i++)
   {
     struct Email *e_cur = m->emails[i];
     if (!e_cur)
       break;
 
+    e_cur->msgno = i;
     if ((e_cur->vnum != -1) || (e_cur->collapsed && e_cur->visible))
     {
-      e_cur->vnum = m->vcount;
+      mailbox_vnum_set(m, e_cur, m->vcount);
       m->v2r[m->vcount] = i;
       m->vcount++;
     }
-    e_cur->msgno = i;
+    else
+    {
+      mailbox_vnum_set(m, e_cur, -1);
+    }
+
+    // The Emails may have moved
+    mailbox_bits_set(m, e_cur);
   }
 
   /* re-collapse threads marked as collapsed */
@@ -433,6 +616,8 @@ void mutt_sort_headers(struct MailboxView *mv, bool init)
     mv->vsize = mutt_set_vnum(m);
   }
 
+  stats_timer_stop(&StatsSortHeaders, start);
+
   if (m->verbose)
     mutt_clear_error();
 
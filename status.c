@@ -38,6 +38,7 @@
 #include "mutt/lib.h"
 #include "config/lib.h"
 #include "core/lib.h"
+#include "gui/lib.h"
 #include "status.h"
 #include "index/lib.h"
 #include "menu/lib.h"
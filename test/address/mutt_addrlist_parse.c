@@ -163,4 +163,36 @@ void test_mutt_addrlist_parse(void)
     TEST_CHECK(a == NULL);
     mutt_addrlist_clear(&alist);
   }
+
+  {
+    // Plain addresses take a shortcut, the rest don't
+    struct AddressList alist = TAILQ_HEAD_INITIALIZER(alist);
+    int parsed = mutt_addrlist_parse(&alist, " john.doe@example.com ,jane@example.com (Jane);"
+                                             "a@b@c, Bob <bob@example.com>, x @ y.org");
+    TEST_CHECK(parsed == 4);
+
+    const struct Address *a = TAILQ_FIRST(&alist);
+    TEST_CHECK(a->personal == NULL);
+    TEST_CHECK_STR_EQ(buf_string(a->mailbox), "john.doe@example.com");
+
+    a = TAILQ_NEXT(a, entries);
+    TEST_CHECK_STR_EQ(buf_string(a->personal), "Jane");
+    TEST_CHECK_STR_EQ(buf_string(a->mailbox), "jane@example.com");
+
+    a = TAILQ_NEXT(a, entries);
+    TEST_CHECK(a->mailbox == NULL);
+    TEST_CHECK(a->group == false);
+
+    a = TAILQ_NEXT(a, entries);
+    TEST_CHECK_STR_EQ(buf_string(a->personal), "Bob");
+    TEST_CHECK_STR_EQ(buf_string(a->mailbox), "bob@example.com");
+
+    a = TAILQ_NEXT(a, entries);
+    TEST_CHECK(a->personal == NULL);
+    TEST_CHECK_STR_EQ(buf_string(a->mailbox), "x@y.org");
+
+    a = TAILQ_NEXT(a, entries);
+    TEST_CHECK(a == NULL);
+    mutt_addrlist_clear(&alist);
+  }
 }
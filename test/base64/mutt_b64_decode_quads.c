@@ -0,0 +1,93 @@
+/**
+ * @file
+ * Test code for mutt_b64_decode_quads()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stddef.h>
+#include <string.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+void test_mutt_b64_decode_quads(void)
+{
+  // size_t mutt_b64_decode_quads(const char *in, size_t inlen, char *out);
+
+  {
+    char out[16] = { 0 };
+    TEST_CHECK(mutt_b64_decode_quads(NULL, 4, out) == 0);
+  }
+
+  {
+    TEST_CHECK(mutt_b64_decode_quads("SGVs", 4, NULL) == 0);
+  }
+
+  {
+    // Complete groups
+    char out[16] = { 0 };
+    TEST_CHECK(mutt_b64_decode_quads("SGVsbG8h", 8, out) == 8);
+    TEST_CHECK(memcmp(out, "Hello!", 6) == 0);
+  }
+
+  {
+    // Nothing to decode
+    char out[16] = { 0 };
+    TEST_CHECK(mutt_b64_decode_quads("", 0, out) == 0);
+    TEST_CHECK(mutt_b64_decode_quads("SGVs", 0, out) == 0);
+    TEST_CHECK(out[0] == '\0');
+  }
+
+  {
+    // Stop at a padded group
+    char out[16] = { 0 };
+    TEST_CHECK(mutt_b64_decode_quads("SGVsbG8=", 8, out) == 4);
+    TEST_CHECK(memcmp(out, "Hel", 3) == 0);
+    TEST_CHECK(mutt_b64_decode_quads("SGVsbA==", 8, out) == 4);
+    TEST_CHECK(mutt_b64_decode_quads("SA==", 4, out) == 0);
+  }
+
+  {
+    // Stop at a newline, or junk, even in the middle of a group
+    static const char *const tests[] = {
+      "SGVsbG8h\nSGVs", "SGVsbG8h SGVs", "SGVsbG8h*GVs", "SGVsbG8hSGV\xff",
+    };
+
+    for (size_t i = 0; i < mutt_array_size(tests); i++)
+    {
+      char out[16] = { 0 };
+      TEST_CASE_("%zu", i);
+      TEST_CHECK(mutt_b64_decode_quads(tests[i], strlen(tests[i]), out) == 8);
+      TEST_CHECK(memcmp(out, "Hello!", 6) == 0);
+    }
+  }
+
+  {
+    // A partial group at the end is left for the caller
+    char out[16] = { 0 };
+    TEST_CHECK(mutt_b64_decode_quads("SGVsbG8hSG", 10, out) == 8);
+    TEST_CHECK(memcmp(out, "Hello!", 6) == 0);
+    TEST_CHECK(mutt_b64_decode_quads("SGV", 3, out) == 0);
+
+    // Only inlen characters are read
+    TEST_CHECK(mutt_b64_decode_quads("SGVsbG8h", 7, out) == 4);
+  }
+}
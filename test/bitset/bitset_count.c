@@ -0,0 +1,59 @@
+/**
+ * @file
+ * Test code for bitset_count()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+void test_bitset_count(void)
+{
+  // size_t bitset_count(const struct Bitset *bs);
+
+  {
+    TEST_CHECK(bitset_count(NULL) == 0);
+  }
+
+  {
+    struct Bitset bs = { 0 };
+    TEST_CHECK(bitset_count(&bs) == 0);
+  }
+
+  {
+    struct Bitset bs = { 0 };
+    bitset_resize(&bs, 200);
+    TEST_CHECK(bitset_count(&bs) == 0);
+
+    static const size_t bits[] = { 0, 1, 63, 64, 127, 150, 199 };
+    for (size_t i = 0; i < mutt_array_size(bits); i++)
+      bitset_set(&bs, bits[i], true);
+    TEST_CHECK(bitset_count(&bs) == mutt_array_size(bits));
+
+    bitset_set(&bs, 63, false);
+    TEST_CHECK(bitset_count(&bs) == mutt_array_size(bits) - 1);
+
+    bitset_free(&bs);
+  }
+}
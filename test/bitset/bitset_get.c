@@ -0,0 +1,67 @@
+/**
+ * @file
+ * Test code for bitset_get()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+void test_bitset_get(void)
+{
+  // bool bitset_get(const struct Bitset *bs, size_t idx);
+
+  {
+    TEST_CHECK(!bitset_get(NULL, 0));
+  }
+
+  {
+    struct Bitset bs = { 0 };
+    TEST_CHECK(!bitset_get(&bs, 0));
+  }
+
+  {
+    struct Bitset bs = { 0 };
+    bitset_resize(&bs, 200);
+
+    static const size_t bits[] = { 0, 1, 63, 64, 127, 150, 199 };
+    for (size_t i = 0; i < mutt_array_size(bits); i++)
+      bitset_set(&bs, bits[i], true);
+
+    for (size_t i = 0; i < mutt_array_size(bits); i++)
+    {
+      TEST_CHECK(bitset_get(&bs, bits[i]));
+      TEST_MSG("bit %zu", bits[i]);
+    }
+    TEST_CHECK(!bitset_get(&bs, 2));
+    TEST_CHECK(!bitset_get(&bs, 62));
+    TEST_CHECK(!bitset_get(&bs, 65));
+
+    // Out of range
+    TEST_CHECK(!bitset_get(&bs, 200));
+    TEST_CHECK(!bitset_get(&bs, 1000));
+
+    bitset_free(&bs);
+  }
+}
@@ -0,0 +1,53 @@
+/**
+ * @file
+ * Test code for bitset_reset()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+void test_bitset_reset(void)
+{
+  // void bitset_reset(struct Bitset *bs);
+
+  {
+    bitset_reset(NULL);
+    TEST_CHECK_(1, "bitset_reset(NULL)");
+  }
+
+  {
+    struct Bitset bs = { 0 };
+    bitset_resize(&bs, 300);
+    bitset_set(&bs, 0, true);
+    bitset_set(&bs, 299, true);
+
+    bitset_reset(&bs);
+    TEST_CHECK(bitset_count(&bs) == 0);
+    TEST_CHECK(!bitset_get(&bs, 299));
+    TEST_CHECK(bs.size == 300);
+
+    bitset_free(&bs);
+  }
+}
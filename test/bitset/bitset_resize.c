@@ -0,0 +1,75 @@
+/**
+ * @file
+ * Test code for bitset_resize()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+void test_bitset_resize(void)
+{
+  // void bitset_resize(struct Bitset *bs, size_t size);
+
+  {
+    bitset_resize(NULL, 10);
+    TEST_CHECK_(1, "bitset_resize(NULL, 10)");
+  }
+
+  {
+    struct Bitset bs = { 0 };
+    bitset_resize(&bs, 200);
+    TEST_CHECK(bs.size == 200);
+    TEST_CHECK(bitset_count(&bs) == 0);
+
+    bitset_set(&bs, 5, true);
+    bitset_set(&bs, 64, true);
+    bitset_set(&bs, 99, true);
+    bitset_set(&bs, 150, true);
+
+    // Shrinking discards the bits beyond the end
+    bitset_resize(&bs, 100);
+    TEST_CHECK(bs.size == 100);
+    TEST_CHECK(bitset_count(&bs) == 3);
+
+    // Growing again doesn't bring them back
+    bitset_resize(&bs, 300);
+    TEST_CHECK(bs.size == 300);
+    TEST_CHECK(bitset_count(&bs) == 3);
+    TEST_CHECK(!bitset_get(&bs, 150));
+    TEST_CHECK(bitset_next(&bs, 100) == 300);
+
+    // Within a word
+    bitset_resize(&bs, 70);
+    TEST_CHECK(bitset_count(&bs) == 2);
+    bitset_resize(&bs, 128);
+    TEST_CHECK(!bitset_get(&bs, 99));
+
+    bitset_resize(&bs, 0);
+    TEST_CHECK(bs.size == 0);
+    TEST_CHECK(bitset_count(&bs) == 0);
+
+    bitset_free(&bs);
+  }
+}
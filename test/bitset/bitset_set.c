@@ -0,0 +1,73 @@
+/**
+ * @file
+ * Test code for bitset_set()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+void test_bitset_set(void)
+{
+  // void bitset_set(struct Bitset *bs, size_t idx, bool value);
+
+  {
+    bitset_set(NULL, 0, true);
+    TEST_CHECK_(1, "bitset_set(NULL, 0, true)");
+  }
+
+  {
+    // The Bitset doesn't grow
+    struct Bitset bs = { 0 };
+    bitset_set(&bs, 0, true);
+    TEST_CHECK(!bitset_get(&bs, 0));
+    TEST_CHECK(bs.size == 0);
+    bitset_free(&bs);
+  }
+
+  {
+    struct Bitset bs = { 0 };
+    bitset_resize(&bs, 200);
+
+    bitset_set(&bs, 63, true);
+    bitset_set(&bs, 64, true);
+    TEST_CHECK(bitset_get(&bs, 63));
+    TEST_CHECK(bitset_get(&bs, 64));
+
+    // Setting twice
+    bitset_set(&bs, 64, true);
+    TEST_CHECK(bitset_count(&bs) == 2);
+
+    bitset_set(&bs, 63, false);
+    TEST_CHECK(!bitset_get(&bs, 63));
+    TEST_CHECK(bitset_get(&bs, 64));
+
+    // Out of range
+    bitset_set(&bs, 200, true);
+    TEST_CHECK(!bitset_get(&bs, 200));
+    TEST_CHECK(bitset_count(&bs) == 1);
+
+    bitset_free(&bs);
+  }
+}
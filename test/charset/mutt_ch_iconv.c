@@ -23,8 +23,51 @@
 #define TEST_NO_MAIN
 #include "config.h"
 #include "acutest.h"
+#include <stddef.h>
+#include <string.h>
+#include "mutt/lib.h"
+#include "test_common.h" // IWYU pragma: keep
+
+struct IconvTest
+{
+  const char *from;     ///< Source character set
+  const char *in;       ///< Text to convert
+  size_t outlen;        ///< Size of the output buffer
+  const char *expected; ///< Expected utf-8 result
+};
 
 void test_mutt_ch_iconv(void)
 {
   // size_t mutt_ch_iconv(iconv_t cd, const char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft, const char **inrepls, const char *outrepl, int *iconverrno);
+
+  // clang-format off
+  static const struct IconvTest tests[] = {
+    { "us-ascii",   "apple",                 32, "apple"                     },
+    { "us-ascii",   "caf\xe9 au lait",       32, "caf? au lait"              },
+    { "utf-8",      "caf\xc3\xa9 au lait",   32, "caf\xc3\xa9 au lait"        },
+    { "utf-8",      "caf\xe9 au lait",       32, "caf? au lait"              },
+    { "utf-8",      "\xed\xa0\x80 surrogate", 32, "??? surrogate"             },
+    { "utf-8",      "\xc0\xaf overlong",     32, "?? overlong"               },
+    { "utf-8",      "caf\xc3\xa9",           4,  "caf"                       },
+    { "iso-8859-1", "caf\xe9 au lait",       32, "caf\xc3\xa9 au lait"        },
+    { "iso-8859-1", "\xa3\xff",              32, "\xc2\xa3\xc3\xbf"            },
+    { "iso-8859-1", "caf\xe9",               4,  "caf"                       },
+  };
+  // clang-format on
+
+  for (size_t i = 0; i < mutt_array_size(tests); i++)
+  {
+    TEST_CASE(tests[i].in);
+    iconv_t cd = mutt_ch_iconv_open("utf-8", tests[i].from, MUTT_ICONV_NO_FLAGS);
+    TEST_CHECK(iconv_t_valid(cd));
+
+    char out[64] = { 0 };
+    const char *ib = tests[i].in;
+    size_t ibl = strlen(tests[i].in);
+    char *ob = out;
+    size_t obl = tests[i].outlen;
+    mutt_ch_iconv(cd, &ib, &ibl, &ob, &obl, NULL, "?", NULL);
+    *ob = '\0';
+    TEST_CHECK_STR_EQ(out, tests[i].expected);
+  }
 }
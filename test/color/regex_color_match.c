@@ -0,0 +1,140 @@
+/**
+ * @file
+ * Test code for regex_color_match()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "color/lib.h"
+#include "test_common.h"
+
+static struct RegexColor *create_rcol(const char *regex, const char *literal)
+{
+  struct RegexColor *rcol = regex_color_new();
+  TEST_CHECK(REG_COMP(&rcol->regex, regex, 0) == 0);
+  rcol->pattern = mutt_str_dup(regex);
+  rcol->literal = mutt_str_dup(literal);
+  rcol->next_match.rm_so = -1;
+  return rcol;
+}
+
+static bool check_match(struct RegexColor *rcol, const char *buf, int offset,
+                        int so, int eo)
+{
+  regmatch_t pmatch[1] = { 0 };
+  if (!TEST_CHECK(regex_color_match(rcol, buf, offset, pmatch)))
+    return false;
+
+  TEST_CHECK((pmatch[0].rm_so == so) && (pmatch[0].rm_eo == eo));
+  TEST_MSG("Expected: [%d,%d)", so, eo);
+  TEST_MSG("Actual  : [%d,%d)", (int) pmatch[0].rm_so, (int) pmatch[0].rm_eo);
+  return true;
+}
+
+void test_regex_color_match(void)
+{
+  // bool regex_color_match(struct RegexColor *rcol, const char *buf, int offset, regmatch_t *pmatch);
+
+  {
+    struct RegexColor *rcol = create_rcol("foo", NULL);
+    regmatch_t pmatch[1] = { 0 };
+    TEST_CHECK(!regex_color_match(NULL, "foo", 0, pmatch));
+    TEST_CHECK(!regex_color_match(rcol, NULL, 0, pmatch));
+    TEST_CHECK(!regex_color_match(rcol, "foo", 0, NULL));
+    regex_color_free(NULL, &rcol);
+  }
+
+  {
+    // Each match is found in turn, with offsets relative to the line
+    static const char *line = "a foo b foo c";
+    struct RegexColor *rcol = create_rcol("foo", NULL);
+    check_match(rcol, line, 0, 2, 5);
+    check_match(rcol, line, 5, 8, 11);
+
+    // Once there are no more matches, the regex isn't tried again
+    regmatch_t pmatch[1] = { 0 };
+    TEST_CHECK(!regex_color_match(rcol, line, 11, pmatch));
+    TEST_CHECK(rcol->stop_matching);
+    TEST_CHECK(!regex_color_match(rcol, line, 0, pmatch));
+    regex_color_free(NULL, &rcol);
+  }
+
+  {
+    // A match that hasn't been passed is reused, without searching again
+    static const char *line = "xx bar";
+    struct RegexColor *rcol = create_rcol("bar", NULL);
+    check_match(rcol, line, 0, 3, 6);
+    check_match(rcol, line, 3, 3, 6);
+
+    rcol->next_match.rm_so = 4;
+    rcol->next_match.rm_eo = 5;
+    check_match(rcol, line, 1, 4, 5);
+
+    // Once the offset has passed it, the regex is searched again
+    regmatch_t pmatch[1] = { 0 };
+    TEST_CHECK(!regex_color_match(rcol, line, 5, pmatch));
+    regex_color_free(NULL, &rcol);
+  }
+
+  {
+    // Another colour's match ended mid-word.  The remembered match was found
+    // in the context of the whole line, so "\<bar" doesn't match in "foobar".
+    static const char *line = "foobar bar";
+    struct RegexColor *rcol = create_rcol("\\<bar", NULL);
+    check_match(rcol, line, 0, 7, 10);
+    check_match(rcol, line, 3, 7, 10);
+    regex_color_free(NULL, &rcol);
+  }
+
+  {
+    // A line without the literal text isn't searched
+    static const char *line = "nothing urgent";
+    struct RegexColor *rcol = create_rcol("\\<urgent\\>", "urgent");
+    check_match(rcol, line, 0, 8, 14);
+    regex_color_free(NULL, &rcol);
+
+    rcol = create_rcol("\\<urgent\\>", "urgent");
+    regmatch_t pmatch[1] = { 0 };
+    TEST_CHECK(!regex_color_match(rcol, "nothing to see", 0, pmatch));
+    TEST_CHECK(rcol->stop_matching);
+    regex_color_free(NULL, &rcol);
+
+    // Only the rest of the line is checked
+    rcol = create_rcol("\\<urgent\\>", "urgent");
+    TEST_CHECK(!regex_color_match(rcol, "urgent stuff", 6, pmatch));
+    regex_color_free(NULL, &rcol);
+
+    // The literal may ignore case
+    rcol = create_rcol("\\<urgent\\>", "urgent");
+    TEST_CHECK(!regex_color_match(rcol, "URGENT", 0, pmatch));
+    regex_color_free(NULL, &rcol);
+
+    rcol = create_rcol("urgent", "urgent");
+    regfree(&rcol->regex);
+    TEST_CHECK(REG_COMP(&rcol->regex, "urgent", REG_ICASE) == 0);
+    rcol->literal_icase = true;
+    check_match(rcol, "very URGENT", 0, 5, 11);
+    regex_color_free(NULL, &rcol);
+  }
+}
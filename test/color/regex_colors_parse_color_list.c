@@ -0,0 +1,108 @@
+/**
+ * @file
+ * Test code for regex_colors_parse_color_list()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "gui/lib.h"
+#include "color/lib.h"
+#include "test_common.h"
+
+void test_regex_colors_parse_color_list(void)
+{
+  // bool regex_colors_parse_color_list(enum ColorId cid, const char *pat, struct AttrColor *ac, int *rc, struct Buffer *err);
+
+  MuttLogger = log_disp_null;
+
+  // The literal text of simple body colours
+  static const struct
+  {
+    const char *pattern;
+    const char *literal;
+    bool icase;
+  } tests[] = {
+    // clang-format off
+    { "urgent",             "urgent",    true  },
+    { "Urgent",             "Urgent",    false },
+    { "\\<urgent\\>",       "urgent",    true  },
+    { "\\burgent\\b",       "urgent",    true  },
+    { "^urgent",            "urgent",    true  },
+    { "urgent$",            "urgent",    true  },
+    { "^\\<urgent\\>$",     "urgent",    true  },
+    { "two words",          "two words", true  },
+    { "^-- $",              "-- ",       true  },
+    { "<user@example>",     "<user@example>", true },
+    // Metacharacters need the regex engine
+    { "urgen.",             NULL,        true  },
+    { "a+b",                NULL,        true  },
+    { "[0-9]+",             NULL,        true  },
+    { "(https?|ftp)",       NULL,        true  },
+    { "x{2}",               NULL,        true  },
+    { "a\\.b",              NULL,        true  },
+    { "a\\<b",              NULL,        true  },
+    { "\\<",                NULL,        true  },
+    { "^$",                 NULL,        true  },
+    { "caf\xc3\xa9",        NULL,        true  },
+    // clang-format on
+  };
+
+  regex_colors_init();
+
+  struct Buffer *err = buf_pool_get();
+  struct AttrColor ac = { 0 };
+  ac.fg.color = COLOR_DEFAULT;
+  ac.bg.color = COLOR_DEFAULT;
+  ac.attrs = A_BOLD;
+
+  for (size_t i = 0; i < mutt_array_size(tests); i++)
+  {
+    TEST_CASE(tests[i].pattern);
+    int rc = 0;
+    buf_reset(err);
+    TEST_CHECK(regex_colors_parse_color_list(MT_COLOR_BODY, tests[i].pattern, &ac, &rc, err));
+    if (!TEST_CHECK(rc == MUTT_CMD_SUCCESS))
+    {
+      TEST_MSG("Error: %s", buf_string(err));
+      continue;
+    }
+
+    struct RegexColorList *rcl = regex_colors_get_list(MT_COLOR_BODY);
+    struct RegexColor *rcol = NULL;
+    STAILQ_FOREACH(rcol, rcl, entries)
+    {
+      if (mutt_str_equal(rcol->pattern, tests[i].pattern))
+        break;
+    }
+    if (!TEST_CHECK(rcol != NULL))
+      continue;
+
+    TEST_CHECK_STR_EQ(rcol->literal, tests[i].literal);
+    if (tests[i].literal)
+      TEST_CHECK(rcol->literal_icase == tests[i].icase);
+  }
+
+  buf_pool_release(&err);
+  regex_colors_cleanup();
+}
@@ -49,5 +49,21 @@ void test_config_cache(void)
     TEST_CHECK(CSR_RESULT(rc) == CSR_SUCCESS);
   }
 
+  {
+    struct ConfigHandle ch = CONFIG_HANDLE("charset");
+    TEST_CHECK_STR_EQ(cc_string(&ch), "us-ascii");
+    TEST_CHECK(ch.he != NULL);
+
+    int rc = cs_subset_str_string_set(sub, "charset", "utf-8", NULL);
+    TEST_CHECK(CSR_RESULT(rc) == CSR_SUCCESS);
+    TEST_CHECK_STR_EQ(cc_string(&ch), "utf-8");
+    TEST_CHECK(cc_string(&ch) == cs_subset_string(sub, "charset"));
+
+    config_cache_cleanup();
+    TEST_CHECK(ch.he == NULL);
+    TEST_CHECK_STR_EQ(cc_string(&ch), "utf-8");
+    config_cache_cleanup();
+  }
+
   log_line(__func__);
 }
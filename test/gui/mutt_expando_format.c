@@ -0,0 +1,259 @@
+/**
+ * @file
+ * Test code for mutt_expando_format()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "mutt/lib.h"
+#include "config/lib.h"
+#include "core/lib.h"
+#include "gui/lib.h"
+#include "format_flags.h"
+#include "test_common.h"
+
+static struct ConfigDef Vars[] = {
+  // clang-format off
+  { "arrow_cursor", DT_BOOL, false, 0, NULL, },
+  { "arrow_string", DT_STRING|D_NOT_EMPTY, IP "->", 0, NULL, },
+  { NULL },
+  // clang-format on
+};
+
+/**
+ * struct ExpandoTest - Values for the test expandos
+ */
+struct ExpandoTest
+{
+  bool a;       ///< Truth of `%a`
+  bool b;       ///< Truth of `%b`
+  bool consume; ///< `%D` reads a `{...}` argument
+  int recurse;  ///< Number of formats `%r` expands
+};
+
+/**
+ * test_format_str - Format a string for the tests - Implements ::format_t - @ingroup expando_api
+ *
+ * | Expando | Description
+ * | :------ | :----------------------------------------------
+ * | \%a     | "apple", true if ExpandoTest.a
+ * | \%A     | "APPLE"
+ * | \%b     | "banana", true if ExpandoTest.b
+ * | \%D     | Contents of a `{...}` argument, if ExpandoTest.consume, else "D"
+ * | \%n     | The number 42, using the precision
+ * | \%r     | "R", after expanding ExpandoTest.recurse other formats
+ * | \%v     | "1.2.3"
+ */
+static const char *test_format_str(char *buf, size_t buflen, size_t col, int cols,
+                                   char op, const char *src, const char *prec,
+                                   const char *if_str, const char *else_str,
+                                   intptr_t data, MuttFormatFlags flags)
+{
+  struct ExpandoTest *et = (struct ExpandoTest *) data;
+  const bool optional = (flags & MUTT_FORMAT_OPTIONAL);
+  bool truth = true;
+  char fmt[128] = { 0 };
+
+  switch (op)
+  {
+    case 'a':
+      truth = et->a;
+      mutt_str_copy(buf, "apple", buflen);
+      break;
+    case 'A':
+      mutt_str_copy(buf, "APPLE", buflen);
+      break;
+    case 'b':
+      truth = et->b;
+      mutt_str_copy(buf, "banana", buflen);
+      break;
+    case 'D':
+      if (et->consume && (*src == '{'))
+      {
+        const char *end = strchr(src, '}');
+        if (end)
+        {
+          mutt_strn_copy(buf, src + 1, end - src - 1, buflen);
+          src = end + 1;
+          break;
+        }
+      }
+      mutt_str_copy(buf, "D", buflen);
+      break;
+    case 'n':
+      snprintf(fmt, sizeof(fmt), "%%%sd", prec);
+      snprintf(buf, buflen, fmt, 42);
+      break;
+    case 'r':
+      for (int i = 0; i < et->recurse; i++)
+      {
+        char tmp[128] = { 0 };
+        snprintf(fmt, sizeof(fmt), "%%n-%d", i);
+        mutt_expando_format(tmp, sizeof(tmp), 0, cols, fmt, test_format_str,
+                            data, MUTT_FORMAT_NO_FLAGS);
+      }
+      mutt_str_copy(buf, "R", buflen);
+      break;
+    case 'v':
+      mutt_str_copy(buf, "1.2.3", buflen);
+      break;
+    default:
+      *buf = '\0';
+      break;
+  }
+
+  if (optional)
+  {
+    mutt_expando_format(buf, buflen, col, cols, truth ? if_str : else_str,
+                        test_format_str, data, MUTT_FORMAT_NO_FLAGS);
+  }
+
+  return src;
+}
+
+static void check_format(const char *src, int cols, size_t buflen,
+                         struct ExpandoTest *et, const char *expected)
+{
+  char buf[1024] = { 0 };
+  mutt_expando_format(buf, buflen, 0, cols, src, test_format_str,
+                      IP et, MUTT_FORMAT_NO_FLAGS);
+  TEST_CHECK_STR_EQ(buf, expected);
+  TEST_MSG("Format: '%s', cols %d, buflen %zu", NONULL(src), cols, buflen);
+}
+
+void test_mutt_expando_format(void)
+{
+  // void mutt_expando_format(char *buf, size_t buflen, size_t col, int cols, const char *src, format_t callback, intptr_t data, MuttFormatFlags flags);
+
+  TEST_CHECK(cs_register_variables(NeoMutt->sub->cs, Vars));
+
+  struct ExpandoTest et = { 0 };
+
+  // Text, escapes and simple expandos
+  {
+    check_format(NULL, 80, 256, &et, "");
+    check_format("", 80, 256, &et, "");
+    check_format("hello", 80, 256, &et, "hello");
+    check_format("a\\tb%%c", 80, 256, &et, "a\tb%c");
+    check_format("[%n]", 80, 256, &et, "[42]");
+    check_format("[%5n]", 80, 256, &et, "[   42]");
+    check_format("[%-5n]", 80, 256, &et, "[42   ]");
+    check_format("%_A", 80, 256, &et, "apple");
+    check_format("%:v", 80, 256, &et, "1_2_3");
+  }
+
+  // Conditionals
+  {
+    et.a = true;
+    check_format("%<a?yes&no>", 80, 256, &et, "yes");
+    et.a = false;
+    check_format("%<a?yes&no>", 80, 256, &et, "no");
+    check_format("%<a?yes>", 80, 256, &et, "");
+  }
+
+  // Nested conditionals
+  {
+    static const char *const fmt = "(%<a?A%<b?B&b>&a>)";
+    et.a = true;
+    et.b = true;
+    check_format(fmt, 80, 256, &et, "(AB)");
+    et.b = false;
+    check_format(fmt, 80, 256, &et, "(Ab)");
+    et.a = false;
+    check_format(fmt, 80, 256, &et, "(a)");
+  }
+
+  // The old `%?` syntax is rewritten to `%<`, in place, in the cached copy
+  {
+    static const char *const fmt = "%?a?<yes>&no?!";
+    for (int i = 0; i < 2; i++)
+    {
+      et.a = true;
+      check_format(fmt, 80, 256, &et, "<yes>!");
+      et.a = false;
+      check_format(fmt, 80, 256, &et, "no!");
+    }
+  }
+
+  // Padding
+  {
+    check_format("ab%>.cd", 10, 256, &et, "ab......cd");
+    check_format("ab%> %n", 10, 256, &et, "ab      42");
+    check_format("abcdefghijkl%>.xy", 10, 256, &et, "abcdefghijkl");
+    check_format("ab%*.cd", 10, 256, &et, "ab......cd");
+    check_format("abcdefghijkl%*.xy", 10, 256, &et, "abcdefghxy");
+    check_format("ab%|-", 10, 256, &et, "ab--------");
+    check_format("abcdefghijkl%|-", 10, 256, &et, "abcdefghijkl");
+  }
+
+  // A callback that reads a variable amount of the format string
+  {
+    static const char *const fmt = "x%D{ab}y";
+    et.consume = true;
+    check_format(fmt, 80, 256, &et, "xaby");
+    et.consume = false;
+    check_format(fmt, 80, 256, &et, "xD{ab}y");
+    et.consume = true;
+    check_format(fmt, 80, 256, &et, "xaby");
+    et.consume = false;
+  }
+
+  // A buffer that's exactly full
+  {
+    check_format("hello%n", 80, 8, &et, "hello42");
+    check_format("hello%n", 80, 7, &et, "hello4");
+    check_format("hello", 80, 7, &et, "hello");
+    check_format("%n", 80, 3, &et, "42");
+  }
+
+  // The rest of the format is parsed when there's room for it
+  {
+    static const char *const fmt = "abc%ndef";
+    check_format(fmt, 80, 4, &et, "ab");
+    check_format(fmt, 80, 256, &et, "abc42def");
+    check_format(fmt, 80, 6, &et, "abc42");
+    check_format(fmt, 80, 256, &et, "abc42def");
+  }
+
+  // More formats than the cache holds
+  {
+    char fmt[64] = { 0 };
+    char expected[64] = { 0 };
+    for (int i = 0; i < 600; i++)
+    {
+      snprintf(fmt, sizeof(fmt), "%%n:%d", i % 300);
+      snprintf(expected, sizeof(expected), "42:%d", i % 300);
+      check_format(fmt, 80, 256, &et, expected);
+    }
+
+    // The cache isn't cleared while a Program is running
+    et.recurse = 300;
+    check_format("<%r>%n", 80, 256, &et, "<R>42");
+    check_format("%n:0", 80, 256, &et, "42:0");
+    et.recurse = 0;
+  }
+
+  mutt_expando_cleanup();
+}
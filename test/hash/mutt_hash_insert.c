@@ -24,6 +24,7 @@
 #include "config.h"
 #include "acutest.h"
 #include <stddef.h>
+#include <stdio.h>
 #include "mutt/lib.h"
 
 void test_mutt_hash_insert(void)
@@ -51,4 +52,45 @@ void test_mutt_hash_insert(void)
     TEST_CHECK(mutt_hash_insert(table, "", NULL) != NULL);
     mutt_hash_free(&table);
   }
+
+  {
+    // The table grows to fit
+    struct HashTable *table = mutt_hash_new(4, MUTT_HASH_STRDUP_KEYS);
+    char key[32] = { 0 };
+    for (int i = 0; i < 10000; i++)
+    {
+      snprintf(key, sizeof(key), "key-%d", i);
+      TEST_CHECK(mutt_hash_insert(table, key, table) != NULL);
+    }
+    TEST_CHECK(table->num_items == 10000);
+    TEST_CHECK(table->num_elems >= 10000);
+
+    TEST_CHECK(mutt_hash_insert(table, "key-1234", NULL) == NULL);
+    TEST_CHECK(table->num_items == 10000);
+
+    for (int i = 0; i < 10000; i++)
+    {
+      snprintf(key, sizeof(key), "key-%d", i);
+      if (!TEST_CHECK(mutt_hash_find(table, key) == table))
+        TEST_MSG("Missing key: %s", key);
+    }
+    mutt_hash_free(&table);
+  }
+
+  {
+    // Duplicates are returned newest first, even after the table grows
+    struct HashTable *table = mutt_hash_new(2, MUTT_HASH_ALLOW_DUPS);
+    static const char *values[] = { "one", "two", "three", "four", "five" };
+    for (size_t i = 0; i < mutt_array_size(values); i++)
+      TEST_CHECK(mutt_hash_insert(table, "apple", (void *) values[i]) != NULL);
+
+    size_t idx = mutt_array_size(values);
+    for (struct HashElem *he = mutt_hash_find_bucket(table, "apple"); he; he = he->next)
+    {
+      if (mutt_str_equal(he->key.strkey, "apple"))
+        TEST_CHECK(he->data == values[--idx]);
+    }
+    TEST_CHECK(idx == 0);
+    mutt_hash_free(&table);
+  }
 }
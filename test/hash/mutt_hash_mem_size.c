@@ -0,0 +1,56 @@
+/**
+ * @file
+ * Test code for mutt_hash_mem_size()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stddef.h>
+#include "mutt/lib.h"
+
+void test_mutt_hash_mem_size(void)
+{
+  // size_t mutt_hash_mem_size(const struct HashTable *table);
+
+  {
+    TEST_CHECK(mutt_hash_mem_size(NULL) == 0);
+  }
+
+  {
+    struct HashTable *table = mutt_hash_new(32, MUTT_HASH_NO_FLAGS);
+    const size_t empty = mutt_hash_mem_size(table);
+    TEST_CHECK(empty >= (sizeof(struct HashTable) + (32 * sizeof(struct HashElem *))));
+
+    mutt_hash_insert(table, "apple", NULL);
+    mutt_hash_insert(table, "banana", NULL);
+    TEST_CHECK(mutt_hash_mem_size(table) == (empty + (2 * sizeof(struct HashElem))));
+    mutt_hash_free(&table);
+  }
+
+  {
+    struct HashTable *table = mutt_hash_new(32, MUTT_HASH_STRDUP_KEYS);
+    const size_t empty = mutt_hash_mem_size(table);
+
+    mutt_hash_insert(table, "apple", NULL);
+    TEST_CHECK(mutt_hash_mem_size(table) == (empty + sizeof(struct HashElem) + 6));
+    mutt_hash_free(&table);
+  }
+}
@@ -0,0 +1,76 @@
+/**
+ * @file
+ * Test code for index_format_is_cacheable()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "index/line_cache.h"
+
+void test_index_format_is_cacheable(void)
+{
+  // bool index_format_is_cacheable(const char *fmt);
+
+  {
+    TEST_CHECK(!index_format_is_cacheable(NULL));
+  }
+
+  {
+    static const char *const Cacheable[] = {
+      "",
+      "plain text",
+      "%4C %Z %{%b %d} %-15.15L (%<l?%4l&%4c>) %s",
+      "%4C %Z %D %-15.15F %s",
+      "%?M?(#%03M)&(%4l)? %s",
+      "%[%H:%M] %(%H:%M)",
+      "100%% %<{?x&y>",
+    };
+
+    for (size_t i = 0; i < mutt_array_size(Cacheable); i++)
+    {
+      TEST_CASE(Cacheable[i]);
+      TEST_CHECK(index_format_is_cacheable(Cacheable[i]));
+    }
+  }
+
+  {
+    // Formats that depend on the current time, or on index-format-hook
+    static const char *const NotCacheable[] = {
+      "%4C %<[1d?%[%H:%M]&%[%m/%d]> %s",
+      "%4C %<(1w?new&old> %s",
+      "%?[1d?today&older? %s",
+      "%?(>2m?old&recent? %s",
+      "%4C %10<%H:%M> %s",
+      "%-8<%H:%M>",
+      "%4C %@date@ %s",
+      "%-10@date@",
+    };
+
+    for (size_t i = 0; i < mutt_array_size(NotCacheable); i++)
+    {
+      TEST_CASE(NotCacheable[i]);
+      TEST_CHECK(!index_format_is_cacheable(NotCacheable[i]));
+    }
+  }
+}
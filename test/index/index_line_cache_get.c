@@ -0,0 +1,100 @@
+/**
+ * @file
+ * Test code for index_line_cache_get()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "index/line_cache.h"
+#include "format_flags.h"
+#include "test_common.h"
+
+static void check_miss(struct IndexLineCache *lc, struct Email *e, int cols,
+                       MuttFormatFlags flags, bool in_pager, const char *name)
+{
+  TEST_CASE(name);
+  TEST_CHECK(index_line_cache_get(lc, e, cols, flags, in_pager) == NULL);
+  index_line_cache_set(lc, e, cols, flags, in_pager, "line");
+  TEST_CHECK_STR_EQ(index_line_cache_get(lc, e, cols, flags, in_pager), "line");
+}
+
+void test_index_line_cache_get(void)
+{
+  // const char *index_line_cache_get(struct IndexLineCache *lc, const struct Email *e, int cols, MuttFormatFlags flags, bool in_pager);
+
+  {
+    struct IndexLineCache *lc = index_line_cache_new();
+    struct Email *e = email_new();
+    TEST_CHECK(index_line_cache_get(NULL, e, 80, MUTT_FORMAT_NO_FLAGS, false) == NULL);
+    TEST_CHECK(index_line_cache_get(lc, NULL, 80, MUTT_FORMAT_NO_FLAGS, false) == NULL);
+    TEST_CHECK(index_line_cache_get(lc, e, 80, MUTT_FORMAT_NO_FLAGS, false) == NULL);
+    email_free(&e);
+    index_line_cache_free(&lc);
+  }
+
+  {
+    struct IndexLineCache *lc = index_line_cache_new();
+    struct Email *e1 = email_new();
+    struct Email *e2 = email_new();
+    const MuttFormatFlags flags = MUTT_FORMAT_TREE | MUTT_FORMAT_INDEX;
+
+    index_line_cache_set(lc, e1, 80, flags, false, "one");
+    index_line_cache_set(lc, e2, 80, flags, false, "two");
+    TEST_CHECK_STR_EQ(index_line_cache_get(lc, e1, 80, flags, false), "one");
+    TEST_CHECK_STR_EQ(index_line_cache_get(lc, e2, 80, flags, false), "two");
+
+    // Replacing a line
+    index_line_cache_set(lc, e1, 80, flags, false, "uno");
+    TEST_CHECK_STR_EQ(index_line_cache_get(lc, e1, 80, flags, false), "uno");
+
+    // Any change to the key invalidates the line
+    e1->generation++;
+    check_miss(lc, e1, 80, flags, false, "generation");
+    check_miss(lc, e1, 100, flags, false, "cols");
+    check_miss(lc, e1, 100, MUTT_FORMAT_INDEX, false, "flags");
+    check_miss(lc, e1, 100, MUTT_FORMAT_INDEX, true, "in_pager");
+    e1->msgno = 5;
+    check_miss(lc, e1, 100, MUTT_FORMAT_INDEX, true, "msgno");
+    e1->score = 10;
+    check_miss(lc, e1, 100, MUTT_FORMAT_INDEX, true, "score");
+    e1->num_hidden = 3;
+    check_miss(lc, e1, 100, MUTT_FORMAT_INDEX, true, "num_hidden");
+    e1->collapsed = true;
+    check_miss(lc, e1, 100, MUTT_FORMAT_INDEX, true, "collapsed");
+    e1->subject_changed = true;
+    check_miss(lc, e1, 100, MUTT_FORMAT_INDEX, true, "subject_changed");
+    e1->tree = mutt_str_dup("`->");
+    check_miss(lc, e1, 100, MUTT_FORMAT_INDEX, true, "tree");
+    mutt_str_replace(&e1->tree, "|->");
+    check_miss(lc, e1, 100, MUTT_FORMAT_INDEX, true, "tree text");
+
+    // The other Email is untouched
+    TEST_CHECK_STR_EQ(index_line_cache_get(lc, e2, 80, flags, false), "two");
+
+    email_free(&e1);
+    email_free(&e2);
+    index_line_cache_free(&lc);
+  }
+}
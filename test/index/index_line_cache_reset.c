@@ -0,0 +1,78 @@
+/**
+ * @file
+ * Test code for index_line_cache_reset()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "core/lib.h"
+#include "index/line_cache.h"
+#include "format_flags.h"
+#include "test_common.h"
+
+void test_index_line_cache_reset(void)
+{
+  // void index_line_cache_reset(struct IndexLineCache *lc);
+
+  {
+    index_line_cache_reset(NULL);
+    TEST_CHECK_(1, "index_line_cache_reset(NULL)");
+  }
+
+  {
+    struct IndexLineCache *lc = index_line_cache_new();
+    struct Email *e = email_new();
+
+    index_line_cache_set(lc, e, 80, MUTT_FORMAT_INDEX, false, "line");
+    TEST_CHECK_STR_EQ(index_line_cache_get(lc, e, 80, MUTT_FORMAT_INDEX, false), "line");
+
+    index_line_cache_reset(lc);
+    TEST_CHECK(index_line_cache_get(lc, e, 80, MUTT_FORMAT_INDEX, false) == NULL);
+
+    // The cache is still usable
+    index_line_cache_set(lc, e, 80, MUTT_FORMAT_INDEX, false, "line");
+    TEST_CHECK_STR_EQ(index_line_cache_get(lc, e, 80, MUTT_FORMAT_INDEX, false), "line");
+
+    email_free(&e);
+    index_line_cache_free(&lc);
+  }
+
+  {
+    // A change to the Aliases, e.g. <create-alias>, changes the names in the
+    // lines, e.g. %F, %L, %n
+    struct IndexLineCache *lc = index_line_cache_new();
+    struct Email *e = email_new();
+
+    index_line_cache_set(lc, e, 80, MUTT_FORMAT_INDEX, false, "line");
+    notify_send(NeoMutt->notify, NT_ALIAS, 0, NULL);
+    TEST_CHECK(index_line_cache_get(lc, e, 80, MUTT_FORMAT_INDEX, false) == NULL);
+
+    // Once freed, the cache no longer listens
+    index_line_cache_free(&lc);
+    notify_send(NeoMutt->notify, NT_ALIAS, 0, NULL);
+
+    email_free(&e);
+  }
+}
@@ -0,0 +1,68 @@
+/**
+ * @file
+ * Test code for mutt_intern_get()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+void test_mutt_intern_get(void)
+{
+  // const char *mutt_intern_get(const char *str);
+
+  {
+    TEST_CHECK(mutt_intern_get(NULL) == NULL);
+  }
+
+  {
+    // Like mutt_str_dup(), an empty string isn't stored
+    const size_t count = mutt_intern_count();
+    TEST_CHECK(mutt_intern_get("") == NULL);
+    TEST_CHECK(mutt_intern_count() == count);
+  }
+
+  {
+    char apple[] = "apple";
+
+    const char *a1 = mutt_intern_get(apple);
+    const char *a2 = mutt_intern_get("apple");
+    const char *b = mutt_intern_get("banana");
+
+    // The string is copied, once
+    TEST_CHECK(a1 != NULL);
+    TEST_CHECK(a1 != apple);
+    TEST_CHECK(a1 == a2);
+    TEST_CHECK(a1 != b);
+    TEST_CHECK_STR_EQ(a1, "apple");
+    TEST_CHECK_STR_EQ(b, "banana");
+
+    // Changing the original doesn't affect the copy
+    apple[0] = 'A';
+    TEST_CHECK_STR_EQ(a1, "apple");
+
+    mutt_intern_release(&a1);
+    mutt_intern_release(&a2);
+    mutt_intern_release(&b);
+  }
+}
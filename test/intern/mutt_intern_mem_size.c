@@ -0,0 +1,60 @@
+/**
+ * @file
+ * Test code for mutt_intern_mem_size()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+void test_mutt_intern_mem_size(void)
+{
+  // size_t mutt_intern_mem_size(void);
+
+  {
+    mutt_intern_cleanup();
+    TEST_CHECK(mutt_intern_mem_size() == 0);
+  }
+
+  {
+    const char *a1 = mutt_intern_get("apple");
+    const size_t size = mutt_intern_mem_size();
+    TEST_CHECK(size > sizeof("apple"));
+
+    // Another reference doesn't use any more memory
+    const char *a2 = mutt_intern_get("apple");
+    TEST_CHECK(mutt_intern_mem_size() == size);
+
+    const char *b = mutt_intern_get("banana");
+    TEST_CHECK(mutt_intern_mem_size() > size);
+
+    mutt_intern_release(&b);
+    TEST_CHECK(mutt_intern_mem_size() == size);
+    mutt_intern_release(&a1);
+    mutt_intern_release(&a2);
+    TEST_CHECK(mutt_intern_mem_size() < size);
+
+    mutt_intern_cleanup();
+    TEST_CHECK(mutt_intern_mem_size() == 0);
+  }
+}
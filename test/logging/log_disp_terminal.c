@@ -37,4 +37,10 @@ void test_log_disp_terminal(void)
   {
     TEST_CHECK(log_disp_terminal(0, "apple", 0, NULL, 0, "fmt") != 0);
   }
+
+  {
+    // Debug lines are dropped without a log file
+    TEST_CHECK(!log_file_running());
+    TEST_CHECK(log_disp_terminal(0, "apple", 0, "banana", LL_DEBUG1, "fmt") == 0);
+  }
 }
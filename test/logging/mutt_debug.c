@@ -0,0 +1,81 @@
+/**
+ * @file
+ * Test code for mutt_debug()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stddef.h>
+#include <time.h>
+#include "mutt/lib.h"
+
+static int NumLines = 0;
+static int NumArgs = 0;
+
+static int log_disp_count(time_t stamp, const char *file, int line,
+                          const char *function, enum LogLevel level, const char *format, ...)
+{
+  NumLines++;
+  return 0;
+}
+
+static int arg(void)
+{
+  NumArgs++;
+  return 0;
+}
+
+void test_mutt_debug(void)
+{
+  // #define mutt_debug(LEVEL, ...)
+
+  log_dispatcher_t old_logger = MuttLogger;
+  enum LogLevel old_level = MuttLogLevel;
+  MuttLogger = log_disp_count;
+
+  {
+    MuttLogLevel = LL_DEBUG2;
+    mutt_debug(LL_DEBUG1, "%d", arg());
+    mutt_debug(LL_DEBUG2, "%d", arg());
+    TEST_CHECK(NumLines == 2);
+    TEST_CHECK(NumArgs == 2);
+  }
+
+  {
+    // Arguments aren't evaluated if the level is disabled
+    NumLines = 0;
+    NumArgs = 0;
+    mutt_debug(LL_DEBUG3, "%d", arg());
+    mutt_debug(LL_NOTIFY, "%d", arg());
+    TEST_CHECK(NumLines == 0);
+    TEST_CHECK(NumArgs == 0);
+  }
+
+  {
+    // Other messages aren't affected
+    MuttLogLevel = LL_MESSAGE;
+    mutt_message("%d", arg());
+    TEST_CHECK(NumLines == 1);
+  }
+
+  MuttLogger = old_logger;
+  MuttLogLevel = old_level;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file
+ * Test code for mailbox_bits_rebuild()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "core/lib.h"
+
+static struct Mailbox *create_mailbox(int num)
+{
+  struct Mailbox *m = mailbox_new();
+  m->email_max = num;
+  m->emails = mutt_mem_calloc(num, sizeof(struct Email *));
+  m->v2r = mutt_mem_calloc(num, sizeof(int));
+  for (int i = 0; i < num; i++)
+  {
+    struct Email *e = email_new();
+    e->msgno = i;
+    m->emails[i] = e;
+  }
+  m->msg_count = num;
+  return m;
+}
+
+void test_mailbox_bits_rebuild(void)
+{
+  // void mailbox_bits_rebuild(struct Mailbox *m);
+
+  {
+    mailbox_bits_rebuild(NULL);
+    TEST_CHECK_(1, "mailbox_bits_rebuild(NULL)");
+  }
+
+  {
+    struct Mailbox *m = create_mailbox(130);
+    for (int i = 0; i < m->msg_count; i++)
+    {
+      struct Email *e = m->emails[i];
+      e->read = (i % 2) == 0;
+      e->flagged = (i == 64);
+      e->tagged = (i == 129);
+      e->vnum = (i < 10) ? i : -1;
+    }
+
+    mailbox_bits_rebuild(m);
+    for (int i = 0; i < MB_MAX; i++)
+    {
+      TEST_CHECK(m->bits[i].size == 130);
+    }
+
+    TEST_CHECK(bitset_get(&m->bits[MB_UNREAD], 1));
+    TEST_CHECK(!bitset_get(&m->bits[MB_UNREAD], 2));
+    TEST_CHECK(bitset_count(&m->bits[MB_FLAGGED]) == 1);
+    TEST_CHECK(bitset_get(&m->bits[MB_FLAGGED], 64));
+    TEST_CHECK(bitset_next(&m->bits[MB_TAGGED], 0) == 129);
+    TEST_CHECK(bitset_count(&m->bits[MB_VISIBLE]) == 10);
+    TEST_CHECK(!bitset_get(&m->bits[MB_VISIBLE], 10));
+
+    // The Emails have moved
+    struct Email *e = m->emails[0];
+    m->emails[0] = m->emails[64];
+    m->emails[64] = e;
+    m->emails[0]->msgno = 0;
+    m->emails[64]->msgno = 64;
+
+    mailbox_bits_rebuild(m);
+    TEST_CHECK(bitset_get(&m->bits[MB_FLAGGED], 0));
+    TEST_CHECK(!bitset_get(&m->bits[MB_FLAGGED], 64));
+    TEST_CHECK(!bitset_get(&m->bits[MB_VISIBLE], 0));
+    TEST_CHECK(bitset_get(&m->bits[MB_VISIBLE], 64));
+
+    mailbox_free(&m);
+  }
+}
@@ -0,0 +1,81 @@
+/**
+ * @file
+ * Test code for mailbox_bits_resize()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "core/lib.h"
+
+static struct Mailbox *create_mailbox(int num)
+{
+  struct Mailbox *m = mailbox_new();
+  m->email_max = num;
+  m->emails = mutt_mem_calloc(num, sizeof(struct Email *));
+  m->v2r = mutt_mem_calloc(num, sizeof(int));
+  for (int i = 0; i < num; i++)
+  {
+    struct Email *e = email_new();
+    e->msgno = i;
+    m->emails[i] = e;
+  }
+  m->msg_count = num;
+  return m;
+}
+
+void test_mailbox_bits_resize(void)
+{
+  // void mailbox_bits_resize(struct Mailbox *m);
+
+  {
+    mailbox_bits_resize(NULL);
+    TEST_CHECK_(1, "mailbox_bits_resize(NULL)");
+  }
+
+  {
+    struct Mailbox *m = create_mailbox(100);
+
+    mailbox_bits_resize(m);
+    for (int i = 0; i < MB_MAX; i++)
+    {
+      TEST_CHECK(m->bits[i].size == 100);
+      TEST_CHECK(bitset_count(&m->bits[i]) == 0);
+    }
+
+    bitset_set(&m->bits[MB_TAGGED], 80, true);
+
+    m->msg_count = 50;
+    mailbox_bits_resize(m);
+    TEST_CHECK(m->bits[MB_TAGGED].size == 50);
+
+    // The new bits are clear
+    m->msg_count = 100;
+    mailbox_bits_resize(m);
+    TEST_CHECK(m->bits[MB_TAGGED].size == 100);
+    TEST_CHECK(bitset_count(&m->bits[MB_TAGGED]) == 0);
+
+    mailbox_free(&m);
+  }
+}
@@ -0,0 +1,98 @@
+/**
+ * @file
+ * Test code for mailbox_bits_set()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "core/lib.h"
+
+static struct Mailbox *create_mailbox(int num)
+{
+  struct Mailbox *m = mailbox_new();
+  m->email_max = num;
+  m->emails = mutt_mem_calloc(num, sizeof(struct Email *));
+  m->v2r = mutt_mem_calloc(num, sizeof(int));
+  for (int i = 0; i < num; i++)
+  {
+    struct Email *e = email_new();
+    e->msgno = i;
+    m->emails[i] = e;
+  }
+  m->msg_count = num;
+  return m;
+}
+
+void test_mailbox_bits_set(void)
+{
+  // void mailbox_bits_set(struct Mailbox *m, const struct Email *e);
+
+  {
+    struct Email e = { 0 };
+    mailbox_bits_set(NULL, &e);
+    TEST_CHECK_(1, "mailbox_bits_set(NULL, &e)");
+  }
+
+  {
+    struct Mailbox m = { { 0 } };
+    mailbox_bits_set(&m, NULL);
+    TEST_CHECK_(1, "mailbox_bits_set(&m, NULL)");
+  }
+
+  {
+    struct Mailbox *m = create_mailbox(10);
+    for (int i = 0; i < m->msg_count; i++)
+      m->emails[i]->read = true;
+    mailbox_bits_rebuild(m);
+
+    struct Email *e = m->emails[3];
+    e->read = false;
+    e->flagged = true;
+    e->tagged = true;
+    mailbox_bits_set(m, e);
+
+    TEST_CHECK(bitset_get(&m->bits[MB_UNREAD], 3));
+    TEST_CHECK(bitset_get(&m->bits[MB_NEW], 3));
+    TEST_CHECK(bitset_get(&m->bits[MB_FLAGGED], 3));
+    TEST_CHECK(!bitset_get(&m->bits[MB_DELETED], 3));
+    TEST_CHECK(bitset_get(&m->bits[MB_TAGGED], 3));
+
+    e->old = true;
+    e->tagged = false;
+    mailbox_bits_set(m, e);
+    TEST_CHECK(bitset_get(&m->bits[MB_UNREAD], 3));
+    TEST_CHECK(!bitset_get(&m->bits[MB_NEW], 3));
+    TEST_CHECK(!bitset_get(&m->bits[MB_TAGGED], 3));
+
+    // An Email that isn't where it claims to be is ignored
+    e = m->emails[5];
+    e->msgno = 6;
+    e->flagged = true;
+    mailbox_bits_set(m, e);
+    TEST_CHECK(bitset_count(&m->bits[MB_FLAGGED]) == 1);
+
+    mailbox_free(&m);
+  }
+}
@@ -0,0 +1,73 @@
+/**
+ * @file
+ * Test code for mailbox_bits_stale()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "core/lib.h"
+
+static struct Mailbox *create_mailbox(int num)
+{
+  struct Mailbox *m = mailbox_new();
+  m->email_max = num;
+  m->emails = mutt_mem_calloc(num, sizeof(struct Email *));
+  m->v2r = mutt_mem_calloc(num, sizeof(int));
+  for (int i = 0; i < num; i++)
+  {
+    struct Email *e = email_new();
+    e->msgno = i;
+    m->emails[i] = e;
+  }
+  m->msg_count = num;
+  return m;
+}
+
+void test_mailbox_bits_stale(void)
+{
+  // bool mailbox_bits_stale(const struct Mailbox *m, enum MailboxBits bit);
+
+  {
+    TEST_CHECK(!mailbox_bits_stale(NULL, MB_VISIBLE));
+  }
+
+  {
+    struct Mailbox *m = create_mailbox(10);
+    TEST_CHECK(mailbox_bits_stale(m, MB_VISIBLE));
+
+    mailbox_bits_rebuild(m);
+    TEST_CHECK(!mailbox_bits_stale(m, MB_VISIBLE));
+
+    // An Email has been removed
+    m->msg_count--;
+    TEST_CHECK(mailbox_bits_stale(m, MB_VISIBLE));
+
+    mailbox_bits_resize(m);
+    TEST_CHECK(!mailbox_bits_stale(m, MB_VISIBLE));
+
+    m->msg_count++;
+    mailbox_free(&m);
+  }
+}
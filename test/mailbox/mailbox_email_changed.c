@@ -0,0 +1,82 @@
+/**
+ * @file
+ * Test code for mailbox_email_changed()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "core/lib.h"
+#include "test_common.h"
+
+void test_mailbox_email_changed(void)
+{
+  // void mailbox_email_changed(struct Mailbox *m, struct Email *e);
+
+  {
+    struct Email e = { 0 };
+    mailbox_email_changed(NULL, &e);
+    TEST_CHECK(e.generation == 0);
+  }
+
+  {
+    struct Mailbox m = { { 0 } };
+    mailbox_email_changed(&m, NULL);
+    TEST_CHECK_(1, "mailbox_email_changed(&m, NULL)");
+  }
+
+  {
+    struct Mailbox *m = mailbox_new();
+    m->email_max = 10;
+    m->emails = mutt_mem_calloc(m->email_max, sizeof(struct Email *));
+    for (int i = 0; i < m->email_max; i++)
+    {
+      struct Email *e = email_new();
+      e->read = true;
+      e->msgno = i;
+      m->emails[i] = e;
+    }
+    m->msg_count = m->email_max;
+    mailbox_bits_rebuild(m);
+    TEST_CHECK(bitset_count(&m->bits[MB_DELETED]) == 0);
+
+    struct Email *e = m->emails[7];
+    const unsigned int gen = e->generation;
+
+    e->deleted = true;
+    e->read = false;
+    mailbox_email_changed(m, e);
+    TEST_CHECK(e->generation == (gen + 1));
+    TEST_CHECK(bitset_next(&m->bits[MB_DELETED], 0) == 7);
+    TEST_CHECK(bitset_next(&m->bits[MB_UNREAD], 0) == 7);
+    TEST_CHECK(bitset_count(&m->bits[MB_UNREAD]) == 1);
+
+    e->deleted = false;
+    mailbox_email_changed(m, e);
+    TEST_CHECK(e->generation == (gen + 2));
+    TEST_CHECK(bitset_count(&m->bits[MB_DELETED]) == 0);
+
+    mailbox_free(&m);
+  }
+}
@@ -0,0 +1,89 @@
+/**
+ * @file
+ * Test code for mailbox_vnum_set()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "core/lib.h"
+
+static struct Mailbox *create_mailbox(int num)
+{
+  struct Mailbox *m = mailbox_new();
+  m->email_max = num;
+  m->emails = mutt_mem_calloc(num, sizeof(struct Email *));
+  m->v2r = mutt_mem_calloc(num, sizeof(int));
+  for (int i = 0; i < num; i++)
+  {
+    struct Email *e = email_new();
+    e->msgno = i;
+    m->emails[i] = e;
+  }
+  m->msg_count = num;
+  return m;
+}
+
+void test_mailbox_vnum_set(void)
+{
+  // void mailbox_vnum_set(struct Mailbox *m, struct Email *e, int vnum);
+
+  {
+    struct Mailbox m = { { 0 } };
+    mailbox_vnum_set(&m, NULL, 0);
+    TEST_CHECK_(1, "mailbox_vnum_set(&m, NULL, 0)");
+  }
+
+  {
+    struct Email e = { 0 };
+    mailbox_vnum_set(NULL, &e, 5);
+    TEST_CHECK(e.vnum == 5);
+  }
+
+  {
+    struct Mailbox *m = create_mailbox(100);
+    for (int i = 0; i < m->msg_count; i++)
+      m->emails[i]->vnum = -1;
+    mailbox_bits_rebuild(m);
+    TEST_CHECK(bitset_count(&m->bits[MB_VISIBLE]) == 0);
+
+    mailbox_vnum_set(m, m->emails[70], 0);
+    TEST_CHECK(m->emails[70]->vnum == 0);
+    TEST_CHECK(bitset_next(&m->bits[MB_VISIBLE], 0) == 70);
+
+    mailbox_vnum_set(m, m->emails[70], -1);
+    TEST_CHECK(m->emails[70]->vnum == -1);
+    TEST_CHECK(bitset_count(&m->bits[MB_VISIBLE]) == 0);
+    TEST_CHECK(!mailbox_bits_stale(m, MB_VISIBLE));
+
+    // An Email that isn't where it claims to be forces a rebuild
+    struct Email *e = m->emails[20];
+    e->msgno = 21;
+    mailbox_vnum_set(m, e, 3);
+    TEST_CHECK(e->vnum == 3);
+    TEST_CHECK(mailbox_bits_stale(m, MB_VISIBLE));
+
+    mailbox_free(&m);
+  }
+}
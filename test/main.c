@@ -92,8 +92,18 @@ void test_fini(void);
   NEOMUTT_TEST_ITEM(test_mutt_b64_buffer_decode)                               \
   NEOMUTT_TEST_ITEM(test_mutt_b64_buffer_encode)                               \
   NEOMUTT_TEST_ITEM(test_mutt_b64_decode)                                      \
+  NEOMUTT_TEST_ITEM(test_mutt_b64_decode_quads)                                \
   NEOMUTT_TEST_ITEM(test_mutt_b64_encode)                                      \
                                                                                \
+  /* bitset */                                                                 \
+  NEOMUTT_TEST_ITEM(test_bitset_count)                                         \
+  NEOMUTT_TEST_ITEM(test_bitset_free)                                          \
+  NEOMUTT_TEST_ITEM(test_bitset_get)                                           \
+  NEOMUTT_TEST_ITEM(test_bitset_next)                                          \
+  NEOMUTT_TEST_ITEM(test_bitset_reset)                                         \
+  NEOMUTT_TEST_ITEM(test_bitset_resize)                                        \
+  NEOMUTT_TEST_ITEM(test_bitset_set)                                           \
+                                                                               \
   /* body */                                                                   \
   NEOMUTT_TEST_ITEM(test_mutt_body_cmp_strict)                                 \
   NEOMUTT_TEST_ITEM(test_mutt_body_free)                                       \
@@ -129,6 +139,7 @@ void test_fini(void);
   NEOMUTT_TEST_ITEM(test_buf_pool_cleanup)                                     \
   NEOMUTT_TEST_ITEM(test_buf_pool_get)                                         \
   NEOMUTT_TEST_ITEM(test_buf_pool_release)                                     \
+  NEOMUTT_TEST_ITEM(test_buf_pool_stats)                                       \
   NEOMUTT_TEST_ITEM(test_buf_printf)                                           \
   NEOMUTT_TEST_ITEM(test_buf_reset)                                            \
   NEOMUTT_TEST_ITEM(test_buf_rfind)                                            \
@@ -178,6 +189,8 @@ void test_fini(void);
   NEOMUTT_TEST_ITEM(test_parse_color_prefix)                                   \
   NEOMUTT_TEST_ITEM(test_parse_color_rrggbb)                                   \
   NEOMUTT_TEST_ITEM(test_quoted_colors)                                        \
+  NEOMUTT_TEST_ITEM(test_regex_color_match)                                    \
+  NEOMUTT_TEST_ITEM(test_regex_colors_parse_color_list)                        \
   NEOMUTT_TEST_ITEM(test_simple_colors)                                        \
                                                                                \
   /* config */                                                                 \
@@ -344,6 +357,7 @@ void test_fini(void);
   NEOMUTT_TEST_ITEM(test_mutt_pattern_group)                                   \
                                                                                \
   /* gui */                                                                    \
+  NEOMUTT_TEST_ITEM(test_mutt_expando_format)                                  \
   NEOMUTT_TEST_ITEM(test_window_reflow)                                        \
   NEOMUTT_TEST_ITEM(test_window_visible)                                       \
                                                                                \
@@ -358,6 +372,7 @@ void test_fini(void);
   NEOMUTT_TEST_ITEM(test_mutt_hash_int_find)                                   \
   NEOMUTT_TEST_ITEM(test_mutt_hash_int_insert)                                 \
   NEOMUTT_TEST_ITEM(test_mutt_hash_int_new)                                    \
+  NEOMUTT_TEST_ITEM(test_mutt_hash_mem_size)                                   \
   NEOMUTT_TEST_ITEM(test_mutt_hash_new)                                        \
   NEOMUTT_TEST_ITEM(test_mutt_hash_set_destructor)                             \
   NEOMUTT_TEST_ITEM(test_mutt_hash_typed_insert)                               \
@@ -384,6 +399,18 @@ void test_fini(void);
   /* imap */                                                                   \
   NEOMUTT_TEST_ITEM(test_imap_msg_set)                                         \
                                                                                \
+  /* index */                                                                  \
+  NEOMUTT_TEST_ITEM(test_index_format_is_cacheable)                            \
+  NEOMUTT_TEST_ITEM(test_index_line_cache_get)                                 \
+  NEOMUTT_TEST_ITEM(test_index_line_cache_reset)                               \
+                                                                               \
+  /* intern */                                                                 \
+  NEOMUTT_TEST_ITEM(test_mutt_intern_cleanup)                                  \
+  NEOMUTT_TEST_ITEM(test_mutt_intern_count)                                    \
+  NEOMUTT_TEST_ITEM(test_mutt_intern_get)                                      \
+  NEOMUTT_TEST_ITEM(test_mutt_intern_mem_size)                                 \
+  NEOMUTT_TEST_ITEM(test_mutt_intern_release)                                  \
+                                                                               \
   /* list */                                                                   \
   NEOMUTT_TEST_ITEM(test_mutt_list_clear)                                      \
   NEOMUTT_TEST_ITEM(test_mutt_list_equal)                                      \
@@ -411,9 +438,16 @@ void test_fini(void);
   NEOMUTT_TEST_ITEM(test_log_queue_flush)                                      \
   NEOMUTT_TEST_ITEM(test_log_queue_save)                                       \
   NEOMUTT_TEST_ITEM(test_log_queue_set_max_size)                               \
+  NEOMUTT_TEST_ITEM(test_mutt_debug)                                           \
                                                                                \
   /* mailbox */                                                                \
+  NEOMUTT_TEST_ITEM(test_mailbox_bits_count)                                   \
+  NEOMUTT_TEST_ITEM(test_mailbox_bits_rebuild)                                 \
+  NEOMUTT_TEST_ITEM(test_mailbox_bits_resize)                                  \
+  NEOMUTT_TEST_ITEM(test_mailbox_bits_set)                                     \
+  NEOMUTT_TEST_ITEM(test_mailbox_bits_stale)                                   \
   NEOMUTT_TEST_ITEM(test_mailbox_changed)                                      \
+  NEOMUTT_TEST_ITEM(test_mailbox_email_changed)                                \
   NEOMUTT_TEST_ITEM(test_mailbox_find)                                         \
   NEOMUTT_TEST_ITEM(test_mailbox_find_name)                                    \
   NEOMUTT_TEST_ITEM(test_mailbox_free)                                         \
@@ -422,6 +456,7 @@ void test_fini(void);
   NEOMUTT_TEST_ITEM(test_mailbox_size_add)                                     \
   NEOMUTT_TEST_ITEM(test_mailbox_size_sub)                                     \
   NEOMUTT_TEST_ITEM(test_mailbox_update)                                       \
+  NEOMUTT_TEST_ITEM(test_mailbox_vnum_set)                                     \
                                                                                \
   /* mapping */                                                                \
   NEOMUTT_TEST_ITEM(test_mutt_map_get_name)                                    \
@@ -456,6 +491,7 @@ void test_fini(void);
   NEOMUTT_TEST_ITEM(test_mutt_mem_free)                                        \
   NEOMUTT_TEST_ITEM(test_mutt_mem_malloc)                                      \
   NEOMUTT_TEST_ITEM(test_mutt_mem_realloc)                                     \
+  NEOMUTT_TEST_ITEM(test_mutt_mem_stats)                                       \
                                                                                \
   /* neomutt */                                                                \
   NEOMUTT_TEST_ITEM(test_neomutt_account_add)                                  \
@@ -466,6 +502,8 @@ void test_fini(void);
   NEOMUTT_TEST_ITEM(test_neomutt_new)                                          \
                                                                                \
   /* notify */                                                                 \
+  NEOMUTT_TEST_ITEM(test_notify_batch_begin)                                   \
+  NEOMUTT_TEST_ITEM(test_notify_batch_end)                                     \
   NEOMUTT_TEST_ITEM(test_notify_free)                                          \
   NEOMUTT_TEST_ITEM(test_notify_new)                                           \
   NEOMUTT_TEST_ITEM(test_notify_observer_add)                                  \
@@ -497,6 +535,7 @@ void test_fini(void);
   NEOMUTT_TEST_ITEM(test_mutt_read_mime_header)                                \
   NEOMUTT_TEST_ITEM(test_mutt_rfc822_parse_line)                               \
   NEOMUTT_TEST_ITEM(test_mutt_rfc822_parse_message)                            \
+  NEOMUTT_TEST_ITEM(test_mutt_rfc822_read_field)                               \
   NEOMUTT_TEST_ITEM(test_mutt_rfc822_read_header)                              \
   NEOMUTT_TEST_ITEM(test_mutt_rfc822_read_line)                                \
   NEOMUTT_TEST_ITEM(test_parse_extract_token)                                  \
@@ -519,7 +558,9 @@ void test_fini(void);
                                                                                \
   /* pattern */                                                                \
   NEOMUTT_TEST_ITEM(test_mutt_pattern_comp)                                    \
+  NEOMUTT_TEST_ITEM(test_mutt_pattern_deps)                                    \
   NEOMUTT_TEST_ITEM(test_mutt_pattern_leak)                                    \
+  NEOMUTT_TEST_ITEM(test_mutt_pattern_memo)                                    \
                                                                                \
   /* prex */                                                                   \
   NEOMUTT_TEST_ITEM(test_mutt_prex_capture)                                    \
@@ -549,6 +590,7 @@ void test_fini(void);
                                                                                \
   /* rfc2047 */                                                                \
   NEOMUTT_TEST_ITEM(test_rfc2047_decode)                                       \
+  NEOMUTT_TEST_ITEM(test_rfc2047_decode_buf)                                   \
   NEOMUTT_TEST_ITEM(test_rfc2047_decode_addrlist)                              \
   NEOMUTT_TEST_ITEM(test_rfc2047_decode_envelope)                              \
   NEOMUTT_TEST_ITEM(test_rfc2047_encode)                                       \
@@ -569,6 +611,10 @@ void test_fini(void);
   NEOMUTT_TEST_ITEM(test_mutt_sig_unblock)                                     \
   NEOMUTT_TEST_ITEM(test_mutt_sig_unblock_system)                              \
                                                                                \
+  /* slab */                                                                   \
+  NEOMUTT_TEST_ITEM(test_slab_alloc)                                           \
+  NEOMUTT_TEST_ITEM(test_slab_free)                                            \
+                                                                               \
   /* slist */                                                                  \
   NEOMUTT_TEST_ITEM(test_slist_add_string)                                     \
   NEOMUTT_TEST_ITEM(test_slist_dup)                                            \
@@ -583,6 +629,14 @@ void test_fini(void);
   /* sort */                                                                   \
   NEOMUTT_TEST_ITEM(test_mutt_qsort_r)                                         \
                                                                                \
+  /* stats */                                                                  \
+  NEOMUTT_TEST_ITEM(test_stats_count)                                          \
+  NEOMUTT_TEST_ITEM(test_stats_dump_json)                                      \
+  NEOMUTT_TEST_ITEM(test_stats_dump_text)                                      \
+  NEOMUTT_TEST_ITEM(test_stats_reset)                                          \
+  NEOMUTT_TEST_ITEM(test_stats_timer_start)                                    \
+  NEOMUTT_TEST_ITEM(test_stats_timer_stop)                                     \
+                                                                               \
   /* string */                                                                 \
   NEOMUTT_TEST_ITEM(test_mutt_istr_equal)                                      \
   NEOMUTT_TEST_ITEM(test_mutt_istr_find)                                       \
@@ -0,0 +1,72 @@
+/**
+ * @file
+ * Test code for mutt_mem_stats()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stddef.h>
+#include "mutt/lib.h"
+
+void test_mutt_mem_stats(void)
+{
+  // void mutt_mem_stats(struct MemoryStats *stats);
+
+  {
+    mutt_mem_stats(NULL);
+    TEST_CHECK_(1, "mutt_mem_stats(NULL)");
+  }
+
+  {
+    struct MemoryStats before = { 0 };
+    struct MemoryStats after = { 0 };
+
+    mutt_mem_stats(&before);
+    void *ptr = mutt_mem_malloc(100);
+    mutt_mem_realloc(&ptr, 200);
+    mutt_mem_free(&ptr);
+    ptr = mutt_mem_calloc(10, 10);
+    mutt_mem_free(&ptr);
+    mutt_mem_stats(&after);
+
+    TEST_CHECK(after.allocs == (before.allocs + 2));
+    TEST_CHECK(after.reallocs == (before.reallocs + 1));
+    TEST_CHECK(after.frees == (before.frees + 2));
+    TEST_CHECK(after.bytes == (before.bytes + 400));
+  }
+
+  {
+    struct MemoryStats before = { 0 };
+    struct MemoryStats after = { 0 };
+
+    mutt_mem_stats(&before);
+    void *ptr = NULL;
+    mutt_mem_realloc(&ptr, 50);
+    mutt_mem_realloc(&ptr, 0);
+    mutt_mem_stats(&after);
+
+    TEST_CHECK(ptr == NULL);
+    TEST_CHECK(after.allocs == (before.allocs + 1));
+    TEST_CHECK(after.reallocs == before.reallocs);
+    TEST_CHECK(after.frees == (before.frees + 1));
+    TEST_CHECK(after.bytes == (before.bytes + 50));
+  }
+}
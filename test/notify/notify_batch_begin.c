@@ -0,0 +1,66 @@
+/**
+ * @file
+ * Test code for notify_batch_begin()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "core/lib.h"
+
+static int batch_begin_observer(struct NotifyCallback *nc)
+{
+  int *count = nc->global_data;
+  (*count)++;
+  return 0;
+}
+
+void test_notify_batch_begin(void)
+{
+  // void notify_batch_begin(struct Notify *notify, enum NotifyType event_type, int event_subtype);
+
+  {
+    notify_batch_begin(NULL, NT_MAILBOX, NT_MAILBOX_CHANGE);
+    TEST_CHECK_(1, "notify_batch_begin(NULL, NT_MAILBOX, NT_MAILBOX_CHANGE)");
+  }
+
+  {
+    int count = 0;
+    struct Notify *notify = notify_new();
+    notify_observer_add(notify, NT_ALL, batch_begin_observer, &count);
+
+    notify_batch_begin(notify, NT_MAILBOX, NT_MAILBOX_CHANGE);
+
+    // Matching events are held back
+    TEST_CHECK(notify_send(notify, NT_MAILBOX, NT_MAILBOX_CHANGE, NULL));
+    TEST_CHECK(notify_send(notify, NT_MAILBOX, NT_MAILBOX_CHANGE, NULL));
+    TEST_CHECK(count == 0);
+
+    // Other events are sent
+    TEST_CHECK(notify_send(notify, NT_MAILBOX, NT_MAILBOX_INVALID, NULL));
+    TEST_CHECK(notify_send(notify, NT_ACCOUNT, NT_ACCOUNT_ADD, NULL));
+    TEST_CHECK(count == 2);
+
+    notify_batch_end(notify, NULL);
+    notify_free(&notify);
+  }
+}
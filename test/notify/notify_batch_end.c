@@ -0,0 +1,73 @@
+/**
+ * @file
+ * Test code for notify_batch_end()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "core/lib.h"
+
+static int batch_end_observer(struct NotifyCallback *nc)
+{
+  int *count = nc->global_data;
+  (*count)++;
+  return 0;
+}
+
+void test_notify_batch_end(void)
+{
+  // bool notify_batch_end(struct Notify *notify, void *event_data);
+
+  {
+    TEST_CHECK(!notify_batch_end(NULL, NULL));
+  }
+
+  {
+    int count = 0;
+    struct Notify *parent = notify_new();
+    struct Notify *notify = notify_new();
+    notify_set_parent(notify, parent);
+    notify_observer_add(parent, NT_MAILBOX, batch_end_observer, &count);
+
+    // Not in a batch
+    TEST_CHECK(!notify_batch_end(notify, NULL));
+
+    // Nothing was held back
+    notify_batch_begin(notify, NT_MAILBOX, NT_MAILBOX_CHANGE);
+    TEST_CHECK(!notify_batch_end(notify, NULL));
+    TEST_CHECK(count == 0);
+
+    // Nested batches send one event, at the end
+    notify_batch_begin(notify, NT_MAILBOX, NT_MAILBOX_CHANGE);
+    notify_batch_begin(notify, NT_MAILBOX, NT_MAILBOX_CHANGE);
+    for (int i = 0; i < 100; i++)
+      notify_send(notify, NT_MAILBOX, NT_MAILBOX_CHANGE, NULL);
+    TEST_CHECK(!notify_batch_end(notify, NULL));
+    TEST_CHECK(count == 0);
+    TEST_CHECK(notify_batch_end(notify, NULL));
+    TEST_CHECK(count == 1);
+
+    notify_free(&notify);
+    notify_free(&parent);
+  }
+}
@@ -0,0 +1,107 @@
+/**
+ * @file
+ * Test code for mutt_rfc822_read_field()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <string.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "test_common.h"
+
+static struct Rfc822ReadFieldTestData
+{
+  const char *input;
+  const char *output;
+  size_t read;
+} test_data[] = {
+  // clang-format off
+  { "Subject: basic stuff\n",                 "Subject: basic stuff",  21 },
+  { "Subject: basic stuff\n\n  ",             "Subject: basic stuff",  21 },
+  { "Subject: long\n subject\n",              "Subject: long subject", 23 },
+  { "Subject: long\n      subject\n",         "Subject: long subject", 28 },
+  { "Subject: long\r\n\tsubject\r\n",         "Subject: long subject", 25 },
+  { "Subject: one\nAnother: two\n",           "Subject: one",          13 },
+  { "Subject: one    \n",                     "Subject: one",          17 },
+  { "Subject: no newline",                    "Subject: no newline",   19 },
+  { "Subject: one\n   \n two\n",              "Subject: one two",      22 },
+  // A blank line ends the header, even if the body is indented
+  { "\n  indented body: line\n",               "",                      1  },
+  { "\r\n  indented body: line\r\n",           "",                      2  },
+  { "  indented: line\nSubject: one\n",        "",                      17 },
+  { "",                                       "",                      0  },
+  // clang-format on
+};
+
+void test_mutt_rfc822_read_field(void)
+{
+  // size_t mutt_rfc822_read_field(const char *span, size_t len, struct Buffer *buf);
+
+  {
+    struct Buffer *buf = buf_pool_get();
+    TEST_CHECK(mutt_rfc822_read_field(NULL, 10, buf) == 0);
+    TEST_CHECK(mutt_rfc822_read_field("Subject: one\n", 13, NULL) == 0);
+    buf_pool_release(&buf);
+  }
+
+  {
+    static const char *const input = "Head1: val1.1\n  val1.2\nHead2: val2.1\n val2.2\n\nbody\n";
+    const size_t len = strlen(input);
+    struct Buffer *buf = buf_pool_get();
+
+    size_t pos = mutt_rfc822_read_field(input, len, buf);
+    TEST_CHECK_STR_EQ(buf_string(buf), "Head1: val1.1 val1.2");
+
+    pos += mutt_rfc822_read_field(input + pos, len - pos, buf);
+    TEST_CHECK_STR_EQ(buf_string(buf), "Head2: val2.1 val2.2");
+
+    pos += mutt_rfc822_read_field(input + pos, len - pos, buf);
+    TEST_CHECK_STR_EQ(buf_string(buf), "");
+    TEST_CHECK_STR_EQ(input + pos, "body\n");
+
+    buf_pool_release(&buf);
+  }
+
+  // The span needn't be terminated
+  {
+    static const char *const input = "Subject: one\n two\nFrom: me\n";
+    struct Buffer *buf = buf_pool_get();
+    TEST_CHECK(mutt_rfc822_read_field(input, 15, buf) == 15);
+    TEST_CHECK_STR_EQ(buf_string(buf), "Subject: one t");
+    buf_pool_release(&buf);
+  }
+
+  for (size_t i = 0; i < mutt_array_size(test_data); i++)
+  {
+    TEST_CASE(test_data[i].input);
+    struct Buffer *buf = buf_pool_get();
+    const size_t read = mutt_rfc822_read_field(test_data[i].input,
+                                               strlen(test_data[i].input), buf);
+    if (!TEST_CHECK(read == test_data[i].read))
+    {
+      TEST_MSG("Expected: %zu", test_data[i].read);
+      TEST_MSG("Actual  : %zu", read);
+    }
+    TEST_CHECK_STR_EQ(buf_string(buf), test_data[i].output);
+    buf_pool_release(&buf);
+  }
+}
@@ -25,7 +25,18 @@
 #include "acutest.h"
 #include <stdbool.h>
 #include <stdio.h>
+#include "mutt/lib.h"
+#include "config/lib.h"
 #include "email/lib.h"
+#include "core/lib.h"
+#include "test_common.h"
+
+static struct ConfigDef Vars[] = {
+  // clang-format off
+  { "weed", DT_BOOL, true, 0, NULL, },
+  { NULL },
+  // clang-format on
+};
 
 void test_mutt_rfc822_read_header(void)
 {
@@ -43,4 +54,30 @@ void test_mutt_rfc822_read_header(void)
     mutt_env_free(&env);
     fclose(fp);
   }
+
+  TEST_CHECK(cs_register_variables(NeoMutt->sub->cs, Vars));
+
+  // A blank line ends the header
+  {
+    char input[] = "X-Foo: long\n subject\nMessage-ID: <a@b>\n\nbody: line\n";
+    FILE *fp = test_make_file_with_contents(input, sizeof(input) - 1);
+    struct Envelope *env = mutt_rfc822_read_header(fp, NULL, true, false);
+    TEST_CHECK_STR_EQ(STAILQ_FIRST(&env->userhdrs)->data, "X-Foo: long subject");
+    TEST_CHECK_STR_EQ(env->message_id, "<a@b>");
+    TEST_CHECK(ftell(fp) == 40);
+    mutt_env_free(&env);
+    fclose(fp);
+  }
+
+  // A line that isn't a header field starts the body
+  {
+    char input[] = "X-Foo: one\n>From me\nnot a header\nMessage-ID: <a@b>\n";
+    FILE *fp = test_make_file_with_contents(input, sizeof(input) - 1);
+    struct Envelope *env = mutt_rfc822_read_header(fp, NULL, true, false);
+    TEST_CHECK_STR_EQ(STAILQ_FIRST(&env->userhdrs)->data, "X-Foo: one");
+    TEST_CHECK(env->message_id == NULL);
+    TEST_CHECK(ftell(fp) == 20);
+    mutt_env_free(&env);
+    fclose(fp);
+  }
 }
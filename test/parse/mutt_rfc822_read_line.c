@@ -70,6 +70,17 @@ static struct Rfc822ReadLineTestData
     "Subject: long subject",
     28
   },
+  {
+    /* A blank line ends the header, even if the body is indented */
+    "\n  indented body: line\n",
+    "",
+    1
+  },
+  {
+    "\r\n  indented body: line\r\n",
+    "",
+    2
+  },
   {
     /*
      123456789012\3
@@ -138,6 +149,22 @@ void test_mutt_rfc822_read_line(void)
     fclose(fp);
   }
 
+  {
+    char input[] = "Subject: hi\n\n  indented body: line\n";
+    FILE *fp = test_make_file_with_contents(input, sizeof(input) - 1);
+    struct Buffer *buf = buf_pool_get();
+
+    TEST_CHECK(mutt_rfc822_read_line(fp, buf) == 12);
+    TEST_CHECK_STR_EQ(buf_string(buf), "Subject: hi");
+
+    TEST_CHECK(mutt_rfc822_read_line(fp, buf) == 1);
+    TEST_CHECK_STR_EQ(buf_string(buf), "");
+    TEST_CHECK(ftell(fp) == 13);
+
+    buf_pool_release(&buf);
+    fclose(fp);
+  }
+
   for (size_t i = 0; i < mutt_array_size(test_data); ++i)
   {
     FILE *fp = test_make_file_with_contents(test_data[i].input,
@@ -30,6 +30,7 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include "mutt/lib.h"
+#include "email/lib.h"
 #include "pattern/lib.h"
 #include "test_common.h"
 
@@ -729,5 +730,110 @@ void test_mutt_pattern_comp(void)
     mutt_pattern_free(&pat);
   }
 
+  { /* plain regexes are compiled to literals */
+    static const struct
+    {
+      const char *pattern;
+      bool literal;
+      bool anchored;
+      bool ign_case;
+      const char *str;
+    } tests[] = {
+      // clang-format off
+      { "~s foobar",        true,  false, true,  "foobar"  },
+      { "~s FooBar",        true,  false, false, "FooBar"  },
+      { "~s ^re:",          true,  true,  true,  "re:"     },
+      { "~s 'foo\\.bar'", true,  false, true,  "foo.bar" },
+      { "~s fo+bar",        false, false, true,  NULL      },
+      { "~s foo$",          false, false, true,  NULL      },
+      { "~s ^",             false, false, true,  NULL      },
+      // clang-format on
+    };
+
+    for (size_t i = 0; i < mutt_array_size(tests); i++)
+    {
+      TEST_CASE(tests[i].pattern);
+      buf_reset(err);
+      struct PatternList *pat = mutt_pattern_comp(NULL, NULL, tests[i].pattern, 0, err);
+      if (!TEST_CHECK(pat != NULL))
+      {
+        TEST_MSG("Error: %s", buf_string(err));
+        continue;
+      }
+
+      struct Pattern *e = SLIST_FIRST(pat);
+      TEST_CHECK(e->literal == tests[i].literal);
+      if (tests[i].literal)
+      {
+        TEST_CHECK(e->ign_case == tests[i].ign_case);
+        TEST_CHECK(e->anchored == tests[i].anchored);
+        TEST_CHECK_STR_EQ(e->p.str, tests[i].str);
+      }
+      else
+      {
+        TEST_CHECK(e->p.regex != NULL);
+      }
+
+      mutt_pattern_free(&pat);
+    }
+  }
+
+  { /* literals match the same strings as the regexes they replace */
+    static const struct
+    {
+      const char *literal;
+      const char *regex;
+      const char *subject;
+      bool match;
+    } tests[] = {
+      // clang-format off
+      { "~s foobar", "~s [f]oobar", "A FOOBAR b",         true  },
+      { "~s foobar", "~s [f]oobar", "xfOObArx",           true  },
+      { "~s foobar", "~s [f]oobar", "nothing to see",     false },
+      { "~s foobar", "~s [f]oobar", "",                   false },
+      { "~s FooBar", "~s [F]ooBar", "a FooBar b",         true  },
+      { "~s FooBar", "~s [F]ooBar", "a foobar b",         false },
+      { "~s ^re:",   "~s ^[r]e:",   "Re: hello",          true  },
+      { "~s ^re:",   "~s ^[r]e:",   "hello\nRE: world",   true  },
+      { "~s ^re:",   "~s ^[r]e:",   "Fwd: re: hello",     false },
+      { "~s ^re:",   "~s ^[r]e:",   "hello\n\nfwd: re:", false },
+      // clang-format on
+    };
+
+    struct Email *e = email_new();
+    e->env = mutt_env_new();
+
+    for (size_t i = 0; i < mutt_array_size(tests); i++)
+    {
+      TEST_CASE_("%s, '%s'", tests[i].literal, tests[i].subject);
+      mutt_intern_release((const char **) &e->env->subject);
+      *(const char **) &e->env->subject = mutt_intern_get(tests[i].subject);
+
+      buf_reset(err);
+      struct PatternList *lit = mutt_pattern_comp(NULL, NULL, tests[i].literal, 0, err);
+      struct PatternList *re = mutt_pattern_comp(NULL, NULL, tests[i].regex, 0, err);
+      if (!TEST_CHECK((lit != NULL) && (re != NULL)))
+      {
+        TEST_MSG("Error: %s", buf_string(err));
+        mutt_pattern_free(&lit);
+        mutt_pattern_free(&re);
+        continue;
+      }
+
+      TEST_CHECK(SLIST_FIRST(lit)->literal);
+      TEST_CHECK(!SLIST_FIRST(re)->literal);
+
+      const bool lit_match = mutt_pattern_exec(SLIST_FIRST(lit), 0, NULL, e, NULL);
+      const bool re_match = mutt_pattern_exec(SLIST_FIRST(re), 0, NULL, e, NULL);
+      TEST_CHECK(lit_match == tests[i].match);
+      TEST_CHECK(re_match == tests[i].match);
+
+      mutt_pattern_free(&lit);
+      mutt_pattern_free(&re);
+    }
+
+    email_free(&e);
+  }
+
   buf_pool_release(&err);
 }
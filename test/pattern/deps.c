@@ -0,0 +1,103 @@
+/**
+ * @file
+ * Test code for mutt_pattern_deps()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "address/lib.h"
+#include "core/lib.h"
+#include "pattern/lib.h"
+#include "test_common.h"
+
+static PatternDeps pattern_deps(const char *str, PatternCompFlags flags)
+{
+  struct Buffer *err = buf_pool_get();
+  struct PatternList *pat = mutt_pattern_comp(NULL, NULL, str, flags, err);
+  TEST_CHECK(pat != NULL);
+  TEST_MSG("%s: %s", str, buf_string(err));
+
+  PatternDeps deps = mutt_pattern_deps(pat);
+
+  mutt_pattern_free(&pat);
+  buf_pool_release(&err);
+  return deps;
+}
+
+void test_mutt_pattern_deps(void)
+{
+  // PatternDeps mutt_pattern_deps(const struct PatternList *pat);
+
+  MuttLogger = log_disp_null;
+  mutt_grouplist_init();
+
+  {
+    TEST_CHECK(mutt_pattern_deps(NULL) == MUTT_PAT_DEP_NONE);
+  }
+
+  {
+    static const struct {
+      const char *pattern;
+      PatternCompFlags flags;
+      PatternDeps deps;
+    } Tests[] = {
+      // clang-format off
+      { "~A",              MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_NONE },
+      { "~N",              MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_FLAGS },
+      { "!~F",             MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_FLAGS },
+      { "~D | ~T",         MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_FLAGS },
+      { "~f alice",        MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_HEADERS },
+      { "~s meeting",      MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_HEADERS },
+      { "~y work",         MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_HEADERS },
+      { "~Y inbox",        MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_OTHER },
+      { "@~f alice",       MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_OTHER },
+      { "@~L alice",       MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_OTHER },
+      { "%f friends",      MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_OTHER },
+      { "%t friends",      MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_OTHER },
+      { "%c friends",      MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_OTHER },
+      { "%C friends",      MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_OTHER },
+      { "%e friends",      MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_OTHER },
+      { "~N %f friends",   MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_FLAGS | MUTT_PAT_DEP_OTHER },
+      { "~N ~f alice",     MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_FLAGS | MUTT_PAT_DEP_HEADERS },
+      { "~F | (~s x ~A)",  MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_FLAGS | MUTT_PAT_DEP_HEADERS },
+      { "~d 01/01/2020-",  MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_HEADERS },
+      { "~d <1d",          MUTT_PC_PATTERN_DYNAMIC, MUTT_PAT_DEP_OTHER },
+      { "~b body",         MUTT_PC_FULL_MSG,        MUTT_PAT_DEP_OTHER },
+      { "~(~N)",           MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_OTHER },
+      { "~l",              MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_OTHER },
+      { "~n 5-",           MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_OTHER },
+      { "~N | ~(~F)",      MUTT_PC_NO_FLAGS,        MUTT_PAT_DEP_FLAGS | MUTT_PAT_DEP_OTHER },
+      // clang-format on
+    };
+
+    for (size_t i = 0; i < mutt_array_size(Tests); i++)
+    {
+      TEST_CASE(Tests[i].pattern);
+      PatternDeps deps = pattern_deps(Tests[i].pattern, Tests[i].flags);
+      TEST_CHECK(deps == Tests[i].deps);
+      TEST_MSG("Expected: %d, Got: %d", Tests[i].deps, deps);
+    }
+  }
+
+  mutt_grouplist_cleanup();
+}
@@ -107,16 +107,10 @@ const struct MenuFuncOp OpPostponed = { 0 };
 const struct MenuFuncOp OpQuery = { 0 };
 const struct MenuFuncOp OpSmime = { 0 };
 
-typedef uint8_t MuttFormatFlags;
 typedef uint16_t CompletionFlags;
 typedef uint16_t PagerFlags;
 typedef uint8_t SelectFileFlags;
 
-typedef const char *(*format_t)(char *buf, size_t buflen, size_t col, int cols,
-                                char op, const char *src, const char *prec,
-                                const char *if_str, const char *else_str,
-                                intptr_t data, MuttFormatFlags flags);
-
 struct Address *alias_reverse_lookup(const struct Address *addr)
 {
   return NULL;
@@ -224,11 +218,6 @@ int mutt_rfc822_write_header(FILE *fp, struct Envelope *env, struct Body *attach
   return 0;
 }
 
-void mutt_expando_format(char *buf, size_t buflen, size_t col, int cols, const char *src,
-                         format_t *callback, intptr_t data, MuttFormatFlags flags)
-{
-}
-
 void menu_pop_current(struct Menu *menu)
 {
 }
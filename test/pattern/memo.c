@@ -0,0 +1,154 @@
+/**
+ * @file
+ * Test code for the Pattern memo
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "core/lib.h"
+#include "pattern/lib.h"
+#include "pattern/private.h"
+#include "test_common.h"
+
+#define NUM_EMAILS 3
+
+static struct PatternList *memo_comp(const char *str)
+{
+  struct Buffer *err = buf_pool_get();
+  struct PatternList *pat = mutt_pattern_comp(NULL, NULL, str, MUTT_PC_FULL_MSG, err);
+  TEST_CHECK(pat != NULL);
+  TEST_MSG("%s: %s", str, buf_string(err));
+  buf_pool_release(&err);
+  return pat;
+}
+
+static struct Mailbox *memo_mailbox(void)
+{
+  struct Mailbox *m = mailbox_new();
+  m->email_max = NUM_EMAILS;
+  m->emails = mutt_mem_calloc(m->email_max, sizeof(struct Email *));
+  for (int i = 0; i < NUM_EMAILS; i++)
+  {
+    struct Email *e = email_new();
+    e->env = mutt_env_new();
+    e->flagged = (i == 1);
+    m->emails[i] = e;
+  }
+  m->msg_count = NUM_EMAILS;
+  return m;
+}
+
+void test_mutt_pattern_memo(void)
+{
+  // struct MemoEntry *memo_get(struct PatternMemo *memo, struct Mailbox *m, const char *str, const struct PatternList *pat);
+  // bool memo_exec(struct MemoEntry *me, struct PatternList *pat, PatternExecFlags flags, struct Mailbox *m, struct Email *e);
+
+  MuttLogger = log_disp_null;
+
+  {
+    struct PatternMemo *memo = mutt_pattern_memo_new();
+    struct Mailbox *m = memo_mailbox();
+    struct PatternList *pat = memo_comp("~F");
+
+    TEST_CHECK(memo_get(NULL, m, "~F", pat) == NULL);
+    TEST_CHECK(memo_get(memo, NULL, "~F", pat) == NULL);
+    TEST_CHECK(memo_get(memo, m, NULL, pat) == NULL);
+    TEST_CHECK(memo_get(memo, m, "~F", NULL) == NULL);
+
+    // Without an entry, the Pattern is simply executed
+    TEST_CHECK(memo_exec(NULL, pat, MUTT_MATCH_FULL_ADDRESS, m, m->emails[1]));
+    TEST_CHECK(!memo_exec(NULL, pat, MUTT_MATCH_FULL_ADDRESS, m, m->emails[0]));
+
+    mutt_pattern_free(&pat);
+    mailbox_free(&m);
+    mutt_pattern_memo_free(&memo);
+  }
+
+  {
+    // Cache hits, and generation bumps
+    struct PatternMemo *memo = mutt_pattern_memo_new();
+    struct Mailbox *m = memo_mailbox();
+    struct PatternList *pat = memo_comp("~F");
+
+    struct MemoEntry *me = memo_get(memo, m, "~F", pat);
+    TEST_CHECK(me != NULL);
+    TEST_CHECK(memo_get(memo, m, "~F", pat) == me);
+
+    for (int i = 0; i < NUM_EMAILS; i++)
+    {
+      TEST_CHECK(memo_exec(me, pat, MUTT_MATCH_FULL_ADDRESS, m, m->emails[i]) == (i == 1));
+    }
+
+    // Flags changed behind the memo's back: the cached results are used
+    m->emails[0]->flagged = true;
+    m->emails[1]->flagged = false;
+    TEST_CHECK(!memo_exec(me, pat, MUTT_MATCH_FULL_ADDRESS, m, m->emails[0]));
+    TEST_CHECK(memo_exec(me, pat, MUTT_MATCH_FULL_ADDRESS, m, m->emails[1]));
+
+    // Bumping the generation causes the Email to be checked again
+    m->emails[0]->generation++;
+    TEST_CHECK(memo_exec(me, pat, MUTT_MATCH_FULL_ADDRESS, m, m->emails[0]));
+    TEST_CHECK(memo_exec(me, pat, MUTT_MATCH_FULL_ADDRESS, m, m->emails[1]));
+    m->emails[1]->generation++;
+    TEST_CHECK(!memo_exec(me, pat, MUTT_MATCH_FULL_ADDRESS, m, m->emails[1]));
+
+    // A reset forgets everything
+    mutt_pattern_memo_reset(memo);
+    me = memo_get(memo, m, "~F", pat);
+    TEST_CHECK(me != NULL);
+    m->emails[2]->flagged = true;
+    TEST_CHECK(memo_exec(me, pat, MUTT_MATCH_FULL_ADDRESS, m, m->emails[2]));
+
+    mutt_pattern_free(&pat);
+    mailbox_free(&m);
+    mutt_pattern_memo_free(&memo);
+  }
+
+  {
+    // Patterns whose results can change without the Email changing
+    static const char *const NotMemoisable[] = {
+      // Dates
+      "~d <1d", "~r <2h", "~d 01/01/2020-", "~F | ~d >1w", "!~r <1m",
+      // Other Emails, the view, outside data
+      "~=", "~$", "~(~F)", "~v", "~n 5", "~l",
+      // Groups and aliases
+      "%f friends", "@~f bob",
+    };
+
+    struct PatternMemo *memo = mutt_pattern_memo_new();
+    struct Mailbox *m = memo_mailbox();
+
+    for (size_t i = 0; i < mutt_array_size(NotMemoisable); i++)
+    {
+      struct PatternList *pat = memo_comp(NotMemoisable[i]);
+      TEST_CHECK(memo_get(memo, m, NotMemoisable[i], pat) == NULL);
+      TEST_MSG("%s", NotMemoisable[i]);
+      mutt_pattern_free(&pat);
+    }
+
+    mailbox_free(&m);
+    mutt_pattern_memo_free(&memo);
+  }
+}
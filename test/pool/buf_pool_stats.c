@@ -0,0 +1,77 @@
+/**
+ * @file
+ * Test code for buf_pool_stats()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stddef.h>
+#include "mutt/lib.h"
+
+void test_buf_pool_stats(void)
+{
+  // void buf_pool_stats(struct BufferPoolStats *stats);
+
+  {
+    buf_pool_stats(NULL);
+    TEST_CHECK_(1, "buf_pool_stats(NULL)");
+  }
+
+  {
+    buf_pool_cleanup();
+
+    struct BufferPoolStats stats = { 0 };
+    struct Buffer *buf1 = buf_pool_get();
+    struct Buffer *buf2 = buf_pool_get();
+
+    buf_pool_stats(&stats);
+    TEST_CHECK(stats.gets == 2);
+    TEST_CHECK(stats.allocs == 2);
+    TEST_CHECK(stats.in_use == 2);
+    TEST_CHECK(stats.max_in_use == 2);
+    TEST_CHECK(stats.pooled == 0);
+
+    // A large Buffer keeps its memory
+    buf_alloc(buf1, 5000);
+    const size_t size = buf1->dsize;
+    buf_pool_release(&buf1);
+    buf_pool_release(&buf2);
+
+    buf_pool_stats(&stats);
+    TEST_CHECK(stats.in_use == 0);
+    TEST_CHECK(stats.pooled == 2);
+    TEST_CHECK(stats.resizes == 0);
+
+    // ...and is handed out first
+    buf1 = buf_pool_get();
+    TEST_CHECK(buf1->dsize == size);
+    TEST_CHECK(buf_is_empty(buf1));
+
+    // A huge Buffer is trimmed
+    buf_alloc(buf1, 100000);
+    buf_pool_release(&buf1);
+    buf_pool_stats(&stats);
+    TEST_CHECK(stats.resizes == 1);
+    TEST_CHECK(stats.allocs == 2);
+
+    buf_pool_cleanup();
+  }
+}
@@ -0,0 +1,77 @@
+/**
+ * @file
+ * Test code for rfc2047_decode_buf()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include "mutt/lib.h"
+#include "email/lib.h"
+#include "common.h"
+#include "test_common.h"
+
+void test_rfc2047_decode_buf(void)
+{
+  // bool rfc2047_decode_buf(const char *str, struct Buffer *buf);
+
+  {
+    struct Buffer *buf = buf_pool_get();
+    TEST_CHECK(!rfc2047_decode_buf(NULL, buf));
+    TEST_CHECK(!rfc2047_decode_buf("apple", NULL));
+    buf_pool_release(&buf);
+  }
+
+  {
+    struct Buffer *buf = buf_pool_get();
+    for (size_t i = 0; rfc2047_test_data[i].original; i++)
+    {
+      TEST_CASE(rfc2047_test_data[i].original);
+      TEST_CHECK(rfc2047_decode_buf(rfc2047_test_data[i].original, buf));
+      TEST_CHECK_STR_EQ(buf_string(buf), rfc2047_test_data[i].decoded);
+
+      TEST_CHECK(rfc2047_decode_buf(rfc2047_test_data[i].encoded, buf));
+      TEST_CHECK_STR_EQ(buf_string(buf), rfc2047_test_data[i].decoded);
+    }
+    buf_pool_release(&buf);
+  }
+
+  {
+    // Invalid base64 leaves the input alone
+    static const char *str = "=?utf-8?B?QU!C?=";
+    char *s = mutt_str_dup(str);
+    struct Buffer *buf = buf_pool_get();
+    TEST_CHECK(!rfc2047_decode_buf(s, buf));
+    rfc2047_decode(&s);
+    TEST_CHECK_STR_EQ(s, str);
+    buf_pool_release(&buf);
+    FREE(&s);
+  }
+
+  {
+    // Adjacent words in the same charset are converted together
+    struct Buffer *buf = buf_pool_get();
+    TEST_CHECK(rfc2047_decode_buf("=?utf-8?Q?caf=C3?= =?utf-8?Q?=A9?= au lait", buf));
+    TEST_CHECK_STR_EQ(buf_string(buf), "caf\xc3\xa9 au lait");
+    buf_pool_release(&buf);
+  }
+}
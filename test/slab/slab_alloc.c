@@ -0,0 +1,82 @@
+/**
+ * @file
+ * Test code for slab_alloc()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stddef.h>
+#include <stdio.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+/**
+ * struct SlabTest - Test object
+ */
+struct SlabTest
+{
+  int num;
+  char name[20];
+};
+
+void test_slab_alloc(void)
+{
+  // void *slab_alloc(struct Slab *slab);
+
+  {
+    TEST_CHECK(slab_alloc(NULL) == NULL);
+  }
+
+  {
+    struct Slab slab = SLAB_INIT(struct SlabTest);
+    struct SlabTest *objs[1000] = { 0 };
+
+    for (size_t i = 0; i < mutt_array_size(objs); i++)
+    {
+      objs[i] = slab_alloc(&slab);
+      TEST_CHECK(objs[i] != NULL);
+      TEST_CHECK(objs[i]->num == 0);
+      TEST_CHECK(objs[i]->name[0] == '\0');
+      objs[i]->num = i;
+      snprintf(objs[i]->name, sizeof(objs[i]->name), "object %zu", i);
+    }
+    TEST_CHECK(slab.num_used == 1000);
+    TEST_CHECK(slab.num_chunks == 4);
+
+    // The objects don't overlap
+    for (size_t i = 0; i < mutt_array_size(objs); i++)
+    {
+      TEST_CHECK(objs[i]->num == (int) i);
+    }
+
+    // Freed objects are reused, zeroed
+    slab_free(&slab, objs[500]);
+    objs[500] = slab_alloc(&slab);
+    TEST_CHECK(objs[500]->num == 0);
+    TEST_CHECK(objs[499]->num == 499);
+    TEST_CHECK(objs[501]->num == 501);
+    TEST_CHECK(slab.num_used == 1000);
+    TEST_CHECK(slab.num_chunks == 4);
+
+    for (size_t i = 0; i < mutt_array_size(objs); i++)
+      slab_free(&slab, objs[i]);
+  }
+}
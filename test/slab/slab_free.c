@@ -0,0 +1,112 @@
+/**
+ * @file
+ * Test code for slab_free()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stddef.h>
+#include <stdio.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+/**
+ * struct SlabTest - Test object
+ */
+struct SlabTest
+{
+  int num;
+  char name[20];
+};
+
+void test_slab_free(void)
+{
+  // void slab_free(struct Slab *slab, void *ptr);
+
+  {
+    slab_free(NULL, NULL);
+    TEST_CHECK_(1, "slab_free(NULL, NULL)");
+  }
+
+  {
+    struct Slab slab = SLAB_INIT(struct SlabTest);
+    slab_free(&slab, NULL);
+    TEST_CHECK(slab.num_used == 0);
+  }
+
+  {
+    struct Slab slab = SLAB_INIT(struct SlabTest);
+    struct SlabTest *objs[1000] = { 0 };
+
+    for (size_t i = 0; i < mutt_array_size(objs); i++)
+      objs[i] = slab_alloc(&slab);
+
+    slab_free(&slab, objs[500]);
+    TEST_CHECK(slab.num_used == 999);
+    objs[500] = NULL;
+
+    for (size_t i = 0; i < mutt_array_size(objs); i++)
+      slab_free(&slab, objs[i]);
+
+    // All the memory is released
+    TEST_CHECK(slab.num_used == 0);
+    TEST_CHECK(slab.chunks == NULL);
+    TEST_CHECK(slab.num_chunks == 0);
+  }
+
+  {
+    // Empty chunks are released while other objects are still in use
+    struct Slab slab = SLAB_INIT(struct SlabTest);
+    struct SlabTest *objs[1024] = { 0 };
+
+    for (size_t i = 0; i < mutt_array_size(objs); i++)
+      objs[i] = slab_alloc(&slab);
+    TEST_CHECK(slab.num_chunks == 4);
+
+    // The first empty chunk is kept back
+    for (size_t i = 0; i < 256; i++)
+      slab_free(&slab, objs[i]);
+    TEST_CHECK(slab.num_used == 768);
+    TEST_CHECK(slab.num_chunks == 4);
+
+    // Others are released
+    for (size_t i = 256; i < 768; i++)
+      slab_free(&slab, objs[i]);
+    TEST_CHECK(slab.num_used == 256);
+    TEST_CHECK(slab.num_chunks == 2);
+
+    // The spare chunk is used before a new one is allocated
+    for (size_t i = 0; i < 256; i++)
+      objs[i] = slab_alloc(&slab);
+    TEST_CHECK(slab.num_chunks == 2);
+    objs[256] = slab_alloc(&slab);
+    TEST_CHECK(slab.num_chunks == 3);
+
+    for (size_t i = 0; i < mutt_array_size(objs); i++)
+    {
+      if ((i < 257) || (i >= 768))
+        slab_free(&slab, objs[i]);
+    }
+    TEST_CHECK(slab.num_used == 0);
+    TEST_CHECK(slab.chunks == NULL);
+    TEST_CHECK(slab.num_chunks == 0);
+  }
+}
@@ -0,0 +1,49 @@
+/**
+ * @file
+ * Test code for stats_count()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdint.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+void test_stats_count(void)
+{
+  // void stats_count(struct StatsEntry *se, uint64_t num);
+
+  {
+    stats_count(NULL, 1);
+    TEST_CHECK_(1, "stats_count(NULL, 1)");
+  }
+
+  {
+    static struct StatsEntry counter = STATS_ENTRY("test_counter");
+    stats_count(&counter, 3);
+    TEST_CHECK(counter.registered);
+    stats_count(&counter, 4);
+    TEST_CHECK(counter.count == 7);
+    TEST_CHECK(counter.total_ns == 0);
+    TEST_CHECK(counter.max_ns == 0);
+    stats_reset();
+  }
+}
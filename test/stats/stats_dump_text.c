@@ -0,0 +1,61 @@
+/**
+ * @file
+ * Test code for stats_dump_text()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+void test_stats_dump_text(void)
+{
+  // void stats_dump_text(FILE *fp);
+
+  {
+    stats_dump_text(NULL);
+    TEST_CHECK_(1, "stats_dump_text(NULL)");
+  }
+
+  {
+    static struct StatsEntry timer = STATS_ENTRY("test_timer");
+    static struct StatsEntry counter = STATS_ENTRY("test_counter");
+
+    uint64_t start = stats_timer_start();
+    stats_timer_stop(&timer, start);
+    stats_count(&counter, 7);
+
+    char buf[1024] = { 0 };
+    FILE *fp = fmemopen(buf, sizeof(buf), "w");
+    stats_dump_text(fp);
+    fclose(fp);
+
+    TEST_CHECK(strncmp(buf, "name ", 5) == 0);
+    TEST_CHECK(strstr(buf, "test_timer") != NULL);
+    TEST_CHECK(strstr(buf, "test_counter") != NULL);
+    TEST_CHECK(strstr(buf, "test_counter") < strstr(buf, "test_timer"));
+    TEST_MSG("%s", buf);
+    stats_reset();
+  }
+}
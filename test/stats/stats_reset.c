@@ -0,0 +1,62 @@
+/**
+ * @file
+ * Test code for stats_reset()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdint.h>
+#include <stdio.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+void test_stats_reset(void)
+{
+  // void stats_reset(void);
+
+  {
+    static struct StatsEntry timer = STATS_ENTRY("test_timer");
+    static struct StatsEntry counter = STATS_ENTRY("test_counter");
+
+    stats_timer_stop(&timer, stats_timer_start());
+    stats_count(&counter, 7);
+
+    stats_reset();
+    TEST_CHECK(!timer.registered);
+    TEST_CHECK(timer.count == 0);
+    TEST_CHECK(timer.total_ns == 0);
+    TEST_CHECK(timer.max_ns == 0);
+    TEST_CHECK(!counter.registered);
+    TEST_CHECK(counter.count == 0);
+
+    char buf[64] = { 0 };
+    FILE *fp = fmemopen(buf, sizeof(buf), "w");
+    stats_dump_json(fp);
+    fclose(fp);
+    TEST_CHECK_STR_EQ(buf, "{\n}\n");
+
+    // The entries can be used again
+    stats_count(&counter, 2);
+    TEST_CHECK(counter.registered);
+    TEST_CHECK(counter.count == 2);
+    stats_reset();
+  }
+}
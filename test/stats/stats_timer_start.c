@@ -0,0 +1,40 @@
+/**
+ * @file
+ * Test code for stats_timer_start()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdint.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+void test_stats_timer_start(void)
+{
+  // uint64_t stats_timer_start(void);
+
+  {
+    uint64_t start = stats_timer_start();
+    uint64_t end = stats_timer_start();
+    TEST_CHECK(start != 0);
+    TEST_CHECK(end >= start);
+  }
+}
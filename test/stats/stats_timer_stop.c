@@ -0,0 +1,51 @@
+/**
+ * @file
+ * Test code for stats_timer_stop()
+ *
+ * @authors
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * @copyright
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 2 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define TEST_NO_MAIN
+#include "config.h"
+#include "acutest.h"
+#include <stdint.h>
+#include "mutt/lib.h"
+#include "test_common.h"
+
+void test_stats_timer_stop(void)
+{
+  // void stats_timer_stop(struct StatsEntry *se, uint64_t start);
+
+  {
+    stats_timer_stop(NULL, 0);
+    TEST_CHECK_(1, "stats_timer_stop(NULL, 0)");
+  }
+
+  {
+    static struct StatsEntry timer = STATS_ENTRY("test_timer");
+    uint64_t start = stats_timer_start();
+    stats_timer_stop(&timer, start);
+    TEST_CHECK(timer.registered);
+    TEST_CHECK(timer.count == 1);
+
+    stats_timer_stop(&timer, start);
+    TEST_CHECK(timer.count == 2);
+    TEST_CHECK(timer.max_ns <= timer.total_ns);
+    stats_reset();
+  }
+}